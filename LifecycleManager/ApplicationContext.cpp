@@ -19,6 +19,10 @@
 
 #include "ApplicationContext.h"
 #include "State.h"
+#include "ApplicationRegistry.h"
+#include <boost/uuid/uuid.hpp>
+#include <boost/uuid/uuid_generators.hpp>
+#include <boost/uuid/uuid_io.hpp>
 
 namespace WPEFramework
 {
@@ -28,15 +32,23 @@ namespace WPEFramework
         {
 	}
 
+        const ApplicationContext::InternedId ApplicationContext::sEmptyId = { EMPTY_ATOM, std::string() };
+
         ApplicationContext::ApplicationContext (std::string appId)
         : mPendingStateTransition(false) 
         , mPendingStates()
         , mPendingOldState(Exchange::ILifecycleManager::LifecycleState::UNLOADED)
         , mPendingEventName("")
-        , mAppInstanceId("")
+        , mHopInProgress(false)
+        , mHopOldState(Exchange::ILifecycleManager::LifecycleState::UNLOADED)
+        , mHopNewState(Exchange::ILifecycleManager::LifecycleState::UNLOADED)
+        , mHopStartTime()
+        , mAppInstanceId(&sEmptyId)
+        , mRegistry(nullptr)
         , mAppId(std::move(appId))
+        , mAppIdAtom(EMPTY_ATOM)
         , mLastLifecycleStateChangeTime{0, 0}
-        , mActiveSessionId("")
+        , mActiveSessionId(&sEmptyId)
         , mTargetLifecycleState()
         , mMostRecentIntent("")
         , mState(nullptr)
@@ -45,8 +57,11 @@ namespace WPEFramework
         , mRequestType(REQUEST_TYPE_NONE)
         , mTerminated(false)
         , mUnexpectedTermination(false)
+        , mRetiredIdsLock()
+        , mRetiredIds()
         {
-            mState = new UnloadedState(this);
+            mState = State::getInstance(Exchange::ILifecycleManager::LifecycleState::UNLOADED);
+            mAppIdAtom = AtomTable::getInstance().intern(mAppId);
             sem_init(&mReachedLoadingStateSemaphore, 0, 0);
             sem_init(&mFirstFrameAfterResumeSemaphore, 0, 0);
         }
@@ -57,26 +72,68 @@ namespace WPEFramework
 
         ApplicationContext::~ApplicationContext()
         {
-            if (nullptr != mState)
-	    {
-                delete mState;
-	    }
+            // States are shared flyweights and are not owned by the context
 	    mState = nullptr;
 
 	    //Destroy the semaphores that are initialized in the constructor to ensure proper resource cleanup.
 	    sem_destroy(&mReachedLoadingStateSemaphore);
 	    sem_destroy(&mFirstFrameAfterResumeSemaphore);
 
+            AtomTable& atomTable = AtomTable::getInstance();
+            atomTable.release(mAppIdAtom);
+            mRetiredIds.push_back(mAppInstanceId.load());
+            mRetiredIds.push_back(mActiveSessionId.load());
+            for (const InternedId* internedId : mRetiredIds)
+            {
+                if (&sEmptyId != internedId)
+                {
+                    atomTable.release(internedId->mAtom);
+                    delete internedId;
+                }
+            }
+        }
+
+        std::string ApplicationContext::generateAppInstanceId()
+        {
+            // Seeding the generator is the expensive part, keep one per thread
+            static thread_local boost::uuids::random_generator generator;
+            return boost::uuids::to_string(generator());
         }
 
         void ApplicationContext::setAppInstanceId(std::string& id)
         {
-            mAppInstanceId = id;
+            Atom previousAppInstanceId = EMPTY_ATOM;
+            setInternedId(mAppInstanceId, id, &previousAppInstanceId);
+            ApplicationRegistry* registry = mRegistry.load();
+            if (nullptr != registry)
+            {
+                registry->reindex(this, previousAppInstanceId);
+            }
         }
 
         void ApplicationContext::setActiveSessionId(std::string& id)
         {
-            mActiveSessionId = id;
+            setInternedId(mActiveSessionId, id, nullptr);
+        }
+
+        void ApplicationContext::setInternedId(std::atomic<const InternedId*>& internedId, const std::string& id, Atom* previousAtom)
+        {
+            const InternedId* replacement = &sEmptyId;
+            if (false == id.empty())
+            {
+                replacement = new InternedId{ AtomTable::getInstance().intern(id), id };
+            }
+            const InternedId* previous = internedId.exchange(replacement);
+            if (nullptr != previousAtom)
+            {
+                *previousAtom = previous->mAtom;
+            }
+            // Callers may still hold the name returned by a getter, it must not be freed yet
+            if (&sEmptyId != previous)
+            {
+                std::lock_guard<std::mutex> lock(mRetiredIdsLock);
+                mRetiredIds.push_back(previous);
+            }
         }
 
         void ApplicationContext::setMostRecentIntent(const std::string& intent)
@@ -134,16 +191,26 @@ namespace WPEFramework
             mPendingEventName = "";
         }
 
-	std::string ApplicationContext::getAppId()
+	const std::string& ApplicationContext::getAppId() const
 	{
             return mAppId;
 	}
 
-	std::string ApplicationContext::getAppInstanceId()
+	const std::string& ApplicationContext::getAppInstanceId() const
 	{
-            return mAppInstanceId;
+            return mAppInstanceId.load()->mName;
 	}
 
+        Atom ApplicationContext::getAppIdAtom() const
+        {
+            return mAppIdAtom;
+        }
+
+        Atom ApplicationContext::getAppInstanceIdAtom() const
+        {
+            return mAppInstanceId.load()->mAtom;
+        }
+
 	Exchange::ILifecycleManager::LifecycleState ApplicationContext::getCurrentLifecycleState()
 	{
             return mState->getValue();
@@ -154,17 +221,22 @@ namespace WPEFramework
 	    return mLastLifecycleStateChangeTime;	
 	}
 
-        std::string ApplicationContext::getActiveSessionId()
+        const std::string& ApplicationContext::getActiveSessionId() const
 	{
-            return mActiveSessionId;
+            return mActiveSessionId.load()->mName;
 	}
 
+        Atom ApplicationContext::getActiveSessionIdAtom() const
+        {
+            return mActiveSessionId.load()->mAtom;
+        }
+
 	Exchange::ILifecycleManager::LifecycleState ApplicationContext::getTargetLifecycleState()
 	{
             return mTargetLifecycleState;
         }
 
-        std::string ApplicationContext::getMostRecentIntent()
+        const std::string& ApplicationContext::getMostRecentIntent() const
         {
             return mMostRecentIntent;
         }
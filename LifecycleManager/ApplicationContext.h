@@ -20,8 +20,12 @@
 #pragma once
 
 #include <interfaces/ILifecycleManager.h>
+#include "AtomTable.h"
+#include <atomic>
+#include <chrono>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <time.h>
 #include <string>
 #include <semaphore>
@@ -32,6 +36,7 @@ namespace WPEFramework
     namespace Plugin
     {
         class State;
+        class ApplicationRegistry;
         struct ApplicationLaunchParams
 	{
             ApplicationLaunchParams();
@@ -65,6 +70,8 @@ namespace WPEFramework
                 ApplicationContext (std::string appId);
                 virtual ~ApplicationContext ();
 
+                static std::string generateAppInstanceId();
+
                 void setAppInstanceId(std::string& id);
                 void setActiveSessionId(std::string& id);
                 void setMostRecentIntent(const std::string& intent);
@@ -79,13 +86,17 @@ namespace WPEFramework
                 void resetPendingStates();
 
                 State* getState();
-                std::string getAppId();
-                std::string getAppInstanceId();
+                const std::string& getAppId() const;
+                /* Interned ids, the returned names stay valid for the lifetime of the context */
+                const std::string& getAppInstanceId() const;
+                Atom getAppIdAtom() const;
+                Atom getAppInstanceIdAtom() const;
 		Exchange::ILifecycleManager::LifecycleState getCurrentLifecycleState();
                 timespec getLastLifecycleStateChangeTime();
-                std::string getActiveSessionId();
+                const std::string& getActiveSessionId() const;
+                Atom getActiveSessionIdAtom() const;
 		Exchange::ILifecycleManager::LifecycleState getTargetLifecycleState();
-                std::string getMostRecentIntent();
+                const std::string& getMostRecentIntent() const;
                 uint32_t getStateChangeId();
                 ApplicationLaunchParams& getApplicationLaunchParams();
                 ApplicationKillParams& getApplicationKillParams();
@@ -102,12 +113,34 @@ namespace WPEFramework
                 std::vector<Exchange::ILifecycleManager::LifecycleState> mPendingStates; 
                 Exchange::ILifecycleManager::LifecycleState mPendingOldState; 
                 std::string mPendingEventName;
+                /* Hop being timed for the transition latency histograms */
+                bool mHopInProgress;
+                Exchange::ILifecycleManager::LifecycleState mHopOldState;
+                Exchange::ILifecycleManager::LifecycleState mHopNewState;
+                std::chrono::steady_clock::time_point mHopStartTime;
 
 	    private:
-                std::string mAppInstanceId;
+                friend class ApplicationRegistry;
+
+                /* An interned id together with its name, so getters do not go through the AtomTable */
+                struct InternedId
+                {
+                    Atom mAtom;
+                    std::string mName;
+                };
+
+                static const InternedId sEmptyId;
+
+                void setInternedId(std::atomic<const InternedId*>& internedId, const std::string& id, Atom* previousAtom);
+
+                // Identifiers are interned, the context holds a reference on each atom
+                std::atomic<const InternedId*> mAppInstanceId;
+                // Registry holding the context, told when the appInstanceId changes
+                std::atomic<ApplicationRegistry*> mRegistry;
 		std::string mAppId;
+                Atom mAppIdAtom;
                 timespec mLastLifecycleStateChangeTime;
-                std::string mActiveSessionId;
+                std::atomic<const InternedId*> mActiveSessionId;
                 Exchange::ILifecycleManager::LifecycleState mTargetLifecycleState;
                 std::string mMostRecentIntent;
                 State* mState;
@@ -118,6 +151,9 @@ namespace WPEFramework
                 RequestType mRequestType;
                 bool mTerminated;
                 bool mUnexpectedTermination;
+                // Replaced ids stay pinned until the context is destroyed, so names read earlier remain valid
+                std::mutex mRetiredIdsLock;
+                std::vector<const InternedId*> mRetiredIds;
         };
     } /* namespace Plugin */
 } /* namespace WPEFramework */
@@ -0,0 +1,219 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include "ApplicationRegistry.h"
+#include "UtilsLogging.h"
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        namespace {
+            class ReadGuard
+            {
+                public:
+                    explicit ReadGuard(pthread_rwlock_t& lock): mLock(lock) { pthread_rwlock_rdlock(&mLock); }
+                    ~ReadGuard() { pthread_rwlock_unlock(&mLock); }
+                private:
+                    pthread_rwlock_t& mLock;
+            };
+
+            class WriteGuard
+            {
+                public:
+                    explicit WriteGuard(pthread_rwlock_t& lock): mLock(lock) { pthread_rwlock_wrlock(&mLock); }
+                    ~WriteGuard() { pthread_rwlock_unlock(&mLock); }
+                private:
+                    pthread_rwlock_t& mLock;
+            };
+        }
+
+        ApplicationRegistry::ApplicationRegistry(): mApplications(), mAppIdIndex(), mAppInstanceIdIndex()
+        {
+            pthread_rwlock_init(&mLock, nullptr);
+        }
+
+        ApplicationRegistry::~ApplicationRegistry()
+        {
+            clear();
+            pthread_rwlock_destroy(&mLock);
+        }
+
+        void ApplicationRegistry::add(const std::shared_ptr<ApplicationContext>& context)
+        {
+            if (nullptr == context)
+            {
+                return;
+            }
+            WriteGuard guard(mLock);
+            auto iter = mApplications.insert(mApplications.end(), context);
+            context->mRegistry.store(this);
+            const Atom appId = context->getAppIdAtom();
+            if (mAppIdIndex.find(appId) == mAppIdIndex.end())
+            {
+                mAppIdIndex[appId] = iter;
+            }
+            const Atom appInstanceId = context->getAppInstanceIdAtom();
+            if (EMPTY_ATOM != appInstanceId)
+            {
+                mAppInstanceIdIndex[appInstanceId] = iter;
+            }
+        }
+
+        void ApplicationRegistry::reindex(ApplicationContext* context, Atom previousAppInstanceId)
+        {
+            WriteGuard guard(mLock);
+            auto iter = mApplications.end();
+            auto indexIter = mAppInstanceIdIndex.find(previousAppInstanceId);
+            if ((indexIter != mAppInstanceIdIndex.end()) && (indexIter->second->get() == context))
+            {
+                iter = indexIter->second;
+                mAppInstanceIdIndex.erase(indexIter);
+            }
+            else
+            {
+                // First id of the context, or it was removed while the id was being replaced
+                for (auto nextIter = mApplications.begin(); nextIter != mApplications.end(); nextIter++)
+                {
+                    if (nextIter->get() == context)
+                    {
+                        iter = nextIter;
+                        break;
+                    }
+                }
+            }
+            // Read the id again under the lock, a concurrent replacement may have overtaken this one
+            const Atom appInstanceId = context->getAppInstanceIdAtom();
+            if ((iter != mApplications.end()) && (EMPTY_ATOM != appInstanceId))
+            {
+                mAppInstanceIdIndex[appInstanceId] = iter;
+            }
+        }
+
+        bool ApplicationRegistry::remove(const string& appInstanceId)
+        {
+            const Atom appInstanceIdAtom = AtomTable::getInstance().find(appInstanceId);
+            if ((EMPTY_ATOM == appInstanceIdAtom) || (INVALID_ATOM == appInstanceIdAtom))
+            {
+                return false;
+            }
+            WriteGuard guard(mLock);
+            auto indexIter = mAppInstanceIdIndex.find(appInstanceIdAtom);
+            if (indexIter == mAppInstanceIdIndex.end())
+            {
+                return false;
+            }
+
+            auto iter = indexIter->second;
+            if ((*iter)->getAppInstanceIdAtom() != appInstanceIdAtom)
+            {
+                return false;
+            }
+            const Atom appId = (*iter)->getAppIdAtom();
+            mAppInstanceIdIndex.erase(indexIter);
+            (*iter)->mRegistry.store(nullptr);
+            auto appIdIter = mAppIdIndex.find(appId);
+            bool reindex = ((appIdIter != mAppIdIndex.end()) && (appIdIter->second == iter));
+            mApplications.erase(iter);
+            if (true == reindex)
+            {
+                // Keep lookups by appId returning the earliest remaining entry, as a scan would
+                mAppIdIndex.erase(appIdIter);
+                for (auto nextIter = mApplications.begin(); nextIter != mApplications.end(); nextIter++)
+                {
+                    if ((*nextIter)->getAppIdAtom() == appId)
+                    {
+                        mAppIdIndex[appId] = nextIter;
+                        break;
+                    }
+                }
+            }
+            return true;
+        }
+
+        void ApplicationRegistry::clear()
+        {
+            WriteGuard guard(mLock);
+            for (auto& context : mApplications)
+            {
+                context->mRegistry.store(nullptr);
+            }
+            mAppInstanceIdIndex.clear();
+            mAppIdIndex.clear();
+            mApplications.clear();
+        }
+
+        std::shared_ptr<ApplicationContext> ApplicationRegistry::findByAppInstanceId(const string& appInstanceId) const
+        {
+            // An id that was never interned cannot belong to a loaded application
+            const Atom appInstanceIdAtom = AtomTable::getInstance().find(appInstanceId);
+            std::shared_ptr<ApplicationContext> context = (INVALID_ATOM != appInstanceIdAtom) ? findByAppInstanceIdAtom(appInstanceIdAtom) : nullptr;
+            // The atom may have been released and reused since it was looked up
+            return ((nullptr != context) && (context->getAppInstanceId() == appInstanceId)) ? context : nullptr;
+        }
+
+        std::shared_ptr<ApplicationContext> ApplicationRegistry::findByAppInstanceIdAtom(Atom appInstanceId) const
+        {
+            if ((EMPTY_ATOM == appInstanceId) || (INVALID_ATOM == appInstanceId))
+            {
+                return nullptr;
+            }
+            ReadGuard guard(mLock);
+            auto iter = mAppInstanceIdIndex.find(appInstanceId);
+            // The entry is stale for the moment between an id being replaced and reindexed
+            return ((iter != mAppInstanceIdIndex.end()) && ((*(iter->second))->getAppInstanceIdAtom() == appInstanceId)) ? *(iter->second) : nullptr;
+        }
+
+        std::shared_ptr<ApplicationContext> ApplicationRegistry::findByAppId(const string& appId) const
+        {
+            const Atom appIdAtom = AtomTable::getInstance().find(appId);
+            std::shared_ptr<ApplicationContext> context = (INVALID_ATOM != appIdAtom) ? findByAppIdAtom(appIdAtom) : nullptr;
+            return ((nullptr != context) && (context->getAppId() == appId)) ? context : nullptr;
+        }
+
+        std::shared_ptr<ApplicationContext> ApplicationRegistry::findByAppIdAtom(Atom appId) const
+        {
+            if ((EMPTY_ATOM == appId) || (INVALID_ATOM == appId))
+            {
+                return nullptr;
+            }
+            ReadGuard guard(mLock);
+            auto iter = mAppIdIndex.find(appId);
+            return (iter != mAppIdIndex.end()) ? *(iter->second) : nullptr;
+        }
+
+        std::vector<std::shared_ptr<ApplicationContext>> ApplicationRegistry::getApplications() const
+        {
+            ReadGuard guard(mLock);
+            return std::vector<std::shared_ptr<ApplicationContext>>(mApplications.begin(), mApplications.end());
+        }
+
+        size_t ApplicationRegistry::size() const
+        {
+            ReadGuard guard(mLock);
+            return mApplications.size();
+        }
+
+        bool ApplicationRegistry::empty() const
+        {
+            ReadGuard guard(mLock);
+            return mApplications.empty();
+        }
+    } /* namespace Plugin */
+} /* namespace WPEFramework */
@@ -0,0 +1,76 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include "ApplicationContext.h"
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <pthread.h>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /*
+         * Loaded applications indexed by appId and by appInstanceId. Lookups take a shared
+         * read lock, so frequent queries do not wait for launches or unloads in progress.
+         * Iteration order is the order in which applications were added. Both indexes are
+         * keyed by interned atoms, so lookups compare integers and do not allocate. A held
+         * context reports a new appInstanceId through reindex(), lookups never write.
+         */
+        class ApplicationRegistry
+        {
+            public:
+                ApplicationRegistry();
+                ~ApplicationRegistry();
+                ApplicationRegistry(const ApplicationRegistry&) = delete;
+                ApplicationRegistry& operator=(const ApplicationRegistry&) = delete;
+
+                void add(const std::shared_ptr<ApplicationContext>& context);
+                bool remove(const string& appInstanceId);
+                void clear();
+
+                std::shared_ptr<ApplicationContext> findByAppInstanceId(const string& appInstanceId) const;
+                std::shared_ptr<ApplicationContext> findByAppId(const string& appId) const;
+                std::shared_ptr<ApplicationContext> findByAppInstanceIdAtom(Atom appInstanceId) const;
+                std::shared_ptr<ApplicationContext> findByAppIdAtom(Atom appId) const;
+                std::vector<std::shared_ptr<ApplicationContext>> getApplications() const;
+                size_t size() const;
+                bool empty() const;
+
+            private:
+                friend class ApplicationContext;
+
+                // Called by a held context once its appInstanceId has been replaced
+                void reindex(ApplicationContext* context, Atom previousAppInstanceId);
+
+            private: /* members */
+                typedef std::list<std::shared_ptr<ApplicationContext>> ApplicationList;
+
+                mutable pthread_rwlock_t mLock;
+                ApplicationList mApplications;
+                std::unordered_map<Atom, ApplicationList::iterator> mAppIdIndex;
+                std::unordered_map<Atom, ApplicationList::iterator> mAppInstanceIdIndex;
+        };
+    } /* namespace Plugin */
+} /* namespace WPEFramework */
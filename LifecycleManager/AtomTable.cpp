@@ -0,0 +1,128 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include "AtomTable.h"
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        AtomTable& AtomTable::getInstance()
+        {
+            // Never destroyed, contexts may still release atoms during static destruction
+            static AtomTable* instance = new AtomTable();
+            return *instance;
+        }
+
+        AtomTable::AtomTable(): mLock(), mEntries(), mIndex(), mFreeAtoms()
+        {
+            Entry empty;
+            empty.mRefCount = 1;
+            mEntries.push_back(empty);
+            mIndex[std::string()] = EMPTY_ATOM;
+        }
+
+        Atom AtomTable::intern(const std::string& name)
+        {
+            if (name.empty())
+            {
+                return EMPTY_ATOM;
+            }
+            std::lock_guard<std::mutex> lock(mLock);
+            auto iter = mIndex.find(name);
+            if (iter != mIndex.end())
+            {
+                mEntries[iter->second].mRefCount++;
+                return iter->second;
+            }
+
+            Atom atom = EMPTY_ATOM;
+            if (false == mFreeAtoms.empty())
+            {
+                atom = mFreeAtoms.back();
+                mFreeAtoms.pop_back();
+            }
+            else
+            {
+                atom = static_cast<Atom>(mEntries.size());
+                mEntries.push_back(Entry());
+            }
+            mEntries[atom].mName = name;
+            mEntries[atom].mRefCount = 1;
+            mIndex[name] = atom;
+            return atom;
+        }
+
+        void AtomTable::addRef(Atom atom)
+        {
+            if (EMPTY_ATOM == atom)
+            {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(mLock);
+            if ((atom < mEntries.size()) && (0 < mEntries[atom].mRefCount))
+            {
+                mEntries[atom].mRefCount++;
+            }
+        }
+
+        void AtomTable::release(Atom atom)
+        {
+            if (EMPTY_ATOM == atom)
+            {
+                return;
+            }
+            std::lock_guard<std::mutex> lock(mLock);
+            if ((atom >= mEntries.size()) || (0 == mEntries[atom].mRefCount))
+            {
+                return;
+            }
+            Entry& entry = mEntries[atom];
+            if (0 == --entry.mRefCount)
+            {
+                mIndex.erase(entry.mName);
+                entry.mName.clear();
+                mFreeAtoms.push_back(atom);
+            }
+        }
+
+        Atom AtomTable::find(const std::string& name) const
+        {
+            if (name.empty())
+            {
+                return EMPTY_ATOM;
+            }
+            std::lock_guard<std::mutex> lock(mLock);
+            auto iter = mIndex.find(name);
+            return (iter != mIndex.end()) ? iter->second : INVALID_ATOM;
+        }
+
+        const std::string& AtomTable::name(Atom atom) const
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            return (atom < mEntries.size()) ? mEntries[atom].mName : mEntries[EMPTY_ATOM].mName;
+        }
+
+        size_t AtomTable::size() const
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            return mIndex.size() - 1;
+        }
+    } /* namespace Plugin */
+} /* namespace WPEFramework */
@@ -0,0 +1,80 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        typedef uint32_t Atom;
+
+        /* Atom of the empty string, always valid and never released */
+        #define EMPTY_ATOM 0
+        /* Returned by AtomTable::find for strings that are not interned */
+        #define INVALID_ATOM 0xFFFFFFFF
+
+        /*
+         * Interns identifiers (appId, appInstanceId, session ids) so they can be compared
+         * and used as map keys as plain integers. Every intern() takes a reference that is
+         * dropped with release(); an atom and its name stay valid until the last reference
+         * is released, after which the slot is reused. The reference returned by name() is
+         * therefore only valid while the caller, or an object it holds, keeps a reference on
+         * the atom. Looking up an existing string and reading the name of an atom do not
+         * allocate.
+         */
+        class AtomTable
+        {
+            public:
+                AtomTable(const AtomTable&) = delete;
+                AtomTable& operator=(const AtomTable&) = delete;
+                static AtomTable& getInstance();
+
+                Atom intern(const std::string& name);
+                void addRef(Atom atom);
+                void release(Atom atom);
+                Atom find(const std::string& name) const;
+                const std::string& name(Atom atom) const;
+                size_t size() const;
+
+            private: /* methods */
+                AtomTable();
+
+            private: /* members */
+                struct Entry
+                {
+                    std::string mName;
+                    uint32_t mRefCount;
+                };
+
+                mutable std::mutex mLock;
+                // A deque keeps names at a fixed address while the table grows
+                std::deque<Entry> mEntries;
+                std::unordered_map<std::string, Atom> mIndex;
+                std::vector<Atom> mFreeAtoms;
+        };
+    } /* namespace Plugin */
+} /* namespace WPEFramework */
@@ -0,0 +1,66 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+
+#pragma once
+
+#include "Module.h"
+#include <interfaces/ILifecycleManager.h>
+#include <functional>
+#include <vector>
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /*
+         * Methods of LifecycleManagerImplementation that the plugin reaches through
+         * QueryInterface when the implementation runs in its process. The interface has
+         * no proxy/stub, so the query fails when the implementation is remote.
+         */
+        struct EXTERNAL ILifecycleManagerLocal : virtual public Core::IUnknown
+        {
+            // Outside the ranges of the shared interface definitions, never marshalled
+            enum { ID = RPC::ID_EXTERNAL_INTERFACE_OFFSET + 0x0FFF0000 };
+
+            struct TargetAppState
+            {
+                TargetAppState()
+                : mAppInstanceId()
+                , mTargetLifecycleState(Exchange::ILifecycleManager::LifecycleState::UNLOADED)
+                , mLaunchIntent()
+                {
+                }
+
+                string mAppInstanceId;
+                Exchange::ILifecycleManager::LifecycleState mTargetLifecycleState;
+                string mLaunchIntent;
+            };
+
+            /* Called once every app of a SetTargetAppStates batch reached its target, failed or timed out */
+            typedef std::function<void(uint32_t batchId, const JsonArray& results)> TargetAppStatesCompletion;
+
+            /** Validates all requests under one lock and moves the apps in parallel; completion of the whole batch is reported once */
+            virtual Core::hresult SetTargetAppStates(const std::vector<TargetAppState>& targetAppStates, const TargetAppStatesCompletion& completion, uint32_t& batchId, string& errorReason) = 0;
+            /** Per-hop latency histograms of one appId, or of all apps when appId is empty, and the scheduler lane stats */
+            virtual Core::hresult GetTransitionLatencies(const string& appId, JsonObject& latencies) = 0;
+            virtual Core::hresult ResetTransitionLatencies() = 0;
+        };
+    } /* namespace Plugin */
+} /* namespace WPEFramework */
@@ -20,6 +20,7 @@
 #include "LifecycleManager.h"
 #include "LifecycleManagerTelemetryReporting.h"
 #include "UtilsAppManagerTelemetry.h"
+#include "UtilsJsonRpc.h"
 #include <interfaces/IConfiguration.h>
 
 const string WPEFramework::Plugin::LifecycleManager::SERVICE_NAME = "org.rdk.LifecycleManager";
@@ -49,7 +50,7 @@ namespace WPEFramework
 
         LifecycleManager* LifecycleManager::sInstance = nullptr;
 
-        LifecycleManager::LifecycleManager(): _service(nullptr), mConnectionId(0), mLifecycleManagerImplementation(nullptr), mLifecycleManagerState(nullptr), mLifecycleManagerStateNotification(this)
+        LifecycleManager::LifecycleManager(): _service(nullptr), mConnectionId(0), mLifecycleManagerImplementation(nullptr), mLifecycleManagerState(nullptr), mLifecycleManagerLocal(nullptr), mTargetAppStatesNotifier(), mLifecycleManagerStateNotification(this)
         {
             SYSLOG(Logging::Startup, (_T("LifecycleManager Constructor")));
             LifecycleManager::sInstance = this;
@@ -59,6 +60,11 @@ namespace WPEFramework
         {
             SYSLOG(Logging::Startup, (_T("LifecycleManager Destructor")));
             LifecycleManager::sInstance = nullptr;
+            if (mLifecycleManagerLocal != nullptr)
+            {
+                mLifecycleManagerLocal->Release();
+                mLifecycleManagerLocal = nullptr;
+            }
 	    if (mLifecycleManagerState != nullptr)
             {
                 mLifecycleManagerState->Release();
@@ -107,6 +113,12 @@ namespace WPEFramework
 	    ASSERT(mLifecycleManagerState != nullptr);
             mLifecycleManagerState->Register(&mLifecycleManagerStateNotification);
             Exchange::JLifecycleManagerState::Register(*this, mLifecycleManagerState);
+            // Only found when the implementation runs in this process, the interface is never marshalled
+            mLifecycleManagerLocal = mLifecycleManagerImplementation->QueryInterface<ILifecycleManagerLocal>();
+            mTargetAppStatesNotifier = std::make_shared<TargetAppStatesNotifier>(this);
+            Register("getTransitionLatencies", &LifecycleManager::getTransitionLatencies, this);
+            Register("resetTransitionLatencies", &LifecycleManager::resetTransitionLatencies, this);
+            Register("setTargetAppStates", &LifecycleManager::setTargetAppStates, this);
 
             return retStatus;
         }
@@ -117,6 +129,19 @@ namespace WPEFramework
             ASSERT(_service == service);
             if (mLifecycleManagerState != nullptr)
 	    {
+                Unregister("getTransitionLatencies");
+                Unregister("resetTransitionLatencies");
+                Unregister("setTargetAppStates");
+                if (nullptr != mTargetAppStatesNotifier)
+                {
+                    mTargetAppStatesNotifier->detach();
+                    mTargetAppStatesNotifier.reset();
+                }
+                if (nullptr != mLifecycleManagerLocal)
+                {
+                    mLifecycleManagerLocal->Release();
+                    mLifecycleManagerLocal = nullptr;
+                }
                 mLifecycleManagerState->Unregister(&mLifecycleManagerStateNotification);
                 Exchange::JLifecycleManagerState::Unregister(*this);
 	        mLifecycleManagerState->Release();
@@ -165,5 +190,63 @@ namespace WPEFramework
         {
             return(string("{\"service\": \"") + SERVICE_NAME + string("\"}"));
         }
+
+        uint32_t LifecycleManager::getTransitionLatencies(const JsonObject& parameters, JsonObject& response)
+        {
+            LOGINFOMETHOD();
+            // Latencies are recorded next to the implementation, a remote one cannot hand them over
+            if (nullptr == mLifecycleManagerLocal)
+            {
+                return Core::ERROR_UNAVAILABLE;
+            }
+            string appId = parameters.HasLabel("appId") ? parameters["appId"].String() : "";
+            returnResponse(Core::ERROR_NONE == mLifecycleManagerLocal->GetTransitionLatencies(appId, response));
+        }
+
+        uint32_t LifecycleManager::resetTransitionLatencies(const JsonObject& parameters, JsonObject& response)
+        {
+            LOGINFOMETHOD();
+            if (nullptr == mLifecycleManagerLocal)
+            {
+                return Core::ERROR_UNAVAILABLE;
+            }
+            returnResponse(Core::ERROR_NONE == mLifecycleManagerLocal->ResetTransitionLatencies());
+        }
+
+        uint32_t LifecycleManager::setTargetAppStates(const JsonObject& parameters, JsonObject& response)
+        {
+            LOGINFOMETHOD();
+            returnIfParamNotFound(parameters, "targetAppStates");
+            if (nullptr == mLifecycleManagerLocal)
+            {
+                response["errorReason"] = "setTargetAppStates is only available when LifecycleManager runs in process";
+                returnResponse(false);
+            }
+
+            std::vector<ILifecycleManagerLocal::TargetAppState> targetAppStates;
+            JsonArray requests = parameters["targetAppStates"].Array();
+            for (uint16_t index = 0; index < requests.Length(); index++)
+            {
+                JsonObject request = requests[index].Object();
+                ILifecycleManagerLocal::TargetAppState targetAppState;
+                targetAppState.mAppInstanceId = request["appInstanceId"].String();
+                targetAppState.mTargetLifecycleState = static_cast<Exchange::ILifecycleManager::LifecycleState>(request["targetLifecycleState"].Number());
+                targetAppState.mLaunchIntent = request.HasLabel("launchIntent") ? request["launchIntent"].String() : "";
+                targetAppStates.push_back(targetAppState);
+            }
+
+            uint32_t batchId = 0;
+            string errorReason("");
+            std::shared_ptr<TargetAppStatesNotifier> notifier = mTargetAppStatesNotifier;
+            Core::hresult status = mLifecycleManagerLocal->SetTargetAppStates(targetAppStates, [notifier](uint32_t completedBatchId, const JsonArray& results) {
+                notifier->notify(completedBatchId, results);
+            }, batchId, errorReason);
+            response["batchId"] = batchId;
+            if (Core::ERROR_NONE != status)
+            {
+                response["errorReason"] = errorReason;
+            }
+            returnResponse(Core::ERROR_NONE == status);
+        }
     } /* namespace Plugin */
 } /* namespace WPEFramework */
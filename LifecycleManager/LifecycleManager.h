@@ -24,8 +24,10 @@
 #include <interfaces/json/JsonData_LifecycleManagerState.h>
 #include <interfaces/json/JLifecycleManagerState.h>
 #include <interfaces/ILifecycleManagerState.h>
+#include "ILifecycleManagerLocal.h"
 #include "UtilsLogging.h"
 #include "tracing/Logging.h"
+#include <memory>
 #include <mutex>
 
 namespace WPEFramework
@@ -86,6 +88,39 @@ namespace WPEFramework
                     LifecycleManager& _parent;
             };
 
+            /* Batch completions hold this instead of the plugin, they may arrive after Deinitialize */
+            class TargetAppStatesNotifier
+            {
+                public:
+                    explicit TargetAppStatesNotifier(LifecycleManager* parent)
+                        : mLock()
+                        , mParent(parent)
+                    {
+                    }
+
+                    void notify(uint32_t batchId, const JsonArray& results)
+                    {
+                        std::lock_guard<std::mutex> lock(mLock);
+                        if (nullptr != mParent)
+                        {
+                            JsonObject params;
+                            params["batchId"] = batchId;
+                            params["results"] = results;
+                            mParent->Notify(_T("onTargetAppStatesComplete"), params);
+                        }
+                    }
+
+                    void detach()
+                    {
+                        std::lock_guard<std::mutex> lock(mLock);
+                        mParent = nullptr;
+                    }
+
+                private:
+                    std::mutex mLock;
+                    LifecycleManager* mParent;
+            };
+
             public:
                 LifecycleManager(const LifecycleManager&) = delete;
                 LifecycleManager& operator=(const LifecycleManager&) = delete;
@@ -138,11 +173,18 @@ namespace WPEFramework
             }
 #endif
 
+	    private: /* JSON-RPC methods */
+                uint32_t getTransitionLatencies(const JsonObject& parameters, JsonObject& response);
+                uint32_t resetTransitionLatencies(const JsonObject& parameters, JsonObject& response);
+                uint32_t setTargetAppStates(const JsonObject& parameters, JsonObject& response);
+
 	    private: /* members */
                 PluginHost::IShell* _service{};
                 uint32_t mConnectionId;
                 Exchange::ILifecycleManager* mLifecycleManagerImplementation;
                 Exchange::ILifecycleManagerState* mLifecycleManagerState;
+                ILifecycleManagerLocal* mLifecycleManagerLocal;
+                std::shared_ptr<TargetAppStatesNotifier> mTargetAppStatesNotifier;
                 Core::Sink<Notification> mLifecycleManagerStateNotification;
         };
     } /* namespace Plugin */
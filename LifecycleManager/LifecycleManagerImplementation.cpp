@@ -30,11 +30,29 @@ namespace WPEFramework
 {
     namespace Plugin
     {
+        namespace {
+            void addTargetAppStateResult(JsonArray& results, const string& appInstanceId, Exchange::ILifecycleManager::LifecycleState lifecycleState, bool success, const string& errorReason)
+            {
+                JsonObject result;
+                result["appInstanceId"] = appInstanceId;
+                result["lifecycleState"] = static_cast<uint32_t>(lifecycleState);
+                result["success"] = success;
+                result["errorReason"] = errorReason;
+                results.Add(result);
+            }
+
+            // Batch deadlines share the timer wheel with app deadlines, the prefix keeps them apart
+            string targetAppStatesDeadlineKey(uint32_t batchId)
+            {
+                return "batch-" + std::to_string(batchId);
+            }
+        }
+
         RDKAM_DEFINE_TELEMETRY_CLIENT(WPEFramework::Plugin::LifecycleManagerTelemetryReporting, "lifecycleManagerBootstrapTime")
 
         SERVICE_REGISTRATION(LifecycleManagerImplementation, 1, 0);
 
-        LifecycleManagerImplementation::LifecycleManagerImplementation(): mLifecycleManagerNotification(), mLifecycleManagerStateNotification(), mLoadedApplications(), mPendingRespawns(), mService(nullptr)
+        LifecycleManagerImplementation::LifecycleManagerImplementation(): mLifecycleManagerNotification(), mLifecycleManagerStateNotification(), mLoadedApplications(), mPendingRespawns(), mRespawnGovernor(), mTargetAppStatesBatches(), mNextBatchId(1), mService(nullptr)
         {
             LOGINFO("Create LifecycleManagerImplementation Instance");
         }
@@ -47,7 +65,26 @@ namespace WPEFramework
 
         bool LifecycleManagerImplementation::initialize(PluginHost::IShell* service)
         {
-            bool ret = RequestHandler::getInstance()->initialize(service, this);
+            LifecycleManagerImplementation::Configuration config;
+            config.FromString(service->ConfigLine());
+            uint32_t transitionWorkers = config.transitionWorkers.Value();
+            LOGINFO("transitionWorkers=%u", transitionWorkers);
+            mRuntimeStatsCollector.setCacheTtl(config.runtimeStatsCacheTtl.Value());
+            LOGINFO("runtimeStatsCacheTtl=%u ms", mRuntimeStatsCollector.getCacheTtl());
+            PendingEventTimer* pendingEventTimer = PendingEventTimer::getInstance();
+            pendingEventTimer->setTimeout("onAppRunning", config.onAppRunningTimeout.Value());
+            pendingEventTimer->setTimeout("onAppReady", config.onAppReadyTimeout.Value());
+            pendingEventTimer->setTimeout("onFirstFrame", config.onFirstFrameTimeout.Value());
+            pendingEventTimer->setTimeout("onAppTerminating", config.onAppTerminatingTimeout.Value());
+            LOGINFO("onAppRunningTimeout=%u onAppReadyTimeout=%u onFirstFrameTimeout=%u onAppTerminatingTimeout=%u ms", config.onAppRunningTimeout.Value(), config.onAppReadyTimeout.Value(), config.onFirstFrameTimeout.Value(), config.onAppTerminatingTimeout.Value());
+            pendingEventTimer->setTimeout(TARGET_APP_STATES_DEADLINE, config.targetAppStatesTimeout.Value());
+            LOGINFO("targetAppStatesTimeout=%u ms", config.targetAppStatesTimeout.Value());
+            pendingEventTimer->initialize([this](const string& appInstanceId, const string& eventName) {
+                handlePendingEventTimeout(appInstanceId, eventName);
+            });
+            mRespawnGovernor.configure(config.respawnBackoffInitial.Value(), config.respawnBackoffMax.Value(), config.respawnCrashWindow.Value(), config.respawnCrashLimit.Value());
+            LOGINFO("respawnBackoffInitial=%u respawnBackoffMax=%u respawnCrashWindow=%u ms respawnCrashLimit=%u", config.respawnBackoffInitial.Value(), config.respawnBackoffMax.Value(), config.respawnCrashWindow.Value(), config.respawnCrashLimit.Value());
+            bool ret = RequestHandler::getInstance()->initialize(service, this, transitionWorkers);
             RDKAM_TELEMETRY_INIT(service);
 	    return ret;
         }
@@ -56,6 +93,8 @@ namespace WPEFramework
         {
             try
             {
+                mRespawnGovernor.terminate();
+                PendingEventTimer::getInstance()->terminate();
                 RequestHandler::getInstance()->terminate();
             }
             catch(const std::exception& e)
@@ -123,8 +162,14 @@ namespace WPEFramework
         void LifecycleManagerImplementation::Dispatch(EventNames event, const JsonValue params)
         {
              JsonObject obj = params.Object();
+             if (LIFECYCLE_MANAGER_EVENT_PENDINGEVENTKILL == event)
+             {
+                 killStalledApp(obj["appInstanceId"].String(), obj["eventName"].String());
+                 return;
+             }
                PendingRespawnRequest pendingRespawn;
                bool shouldRespawn = false;
+               std::vector<TargetAppStatesBatch> completedBatches;
 
              //below is for ILifecycleManager notification
              string appId(obj["appId"].String());
@@ -149,6 +194,7 @@ namespace WPEFramework
                  {
                      LifecycleManagerTelemetryReporting::getInstance().reportTelemetryDataOnStateChange(context, obj);
                      handleStateChangeEvent(obj);
+                     updateTargetAppStatesBatches(appInstanceId, static_cast<Exchange::ILifecycleManager::LifecycleState>(oldLifecycleState), static_cast<Exchange::ILifecycleManager::LifecycleState>(newLifecycleState), errorReason, completedBatches);
                      if (Exchange::ILifecycleManager::LifecycleState::UNLOADED == static_cast<Exchange::ILifecycleManager::LifecycleState>(newLifecycleState))
                      {
                          shouldRespawn = tryGetPendingRespawn(appInstanceId, pendingRespawn);
@@ -191,9 +237,19 @@ namespace WPEFramework
         
              mAdminLock.Unlock();
 
+             for (auto& batch : completedBatches)
+             {
+                 LOGINFO("SetTargetAppStates batchId=%u completed", batch.mBatchId);
+                 PendingEventTimer::getInstance()->cancel(targetAppStatesDeadlineKey(batch.mBatchId));
+                 if (nullptr != batch.mCompletion)
+                 {
+                     batch.mCompletion(batch.mBatchId, batch.mResults);
+                 }
+             }
+
              if (shouldRespawn)
              {
-                 handlePendingRespawn(pendingRespawn);
+                 scheduleRespawn(appInstanceId, pendingRespawn);
              }
         }
         
@@ -201,14 +257,27 @@ namespace WPEFramework
         {
             Core::hresult status = Core::ERROR_NONE;
             JsonArray appsInformation;
-            Core::SafeSyncType<Core::CriticalSection> adminLock(mAdminLock);
-            auto iter = mLoadedApplications.end();
-            for (iter = mLoadedApplications.begin(); iter != mLoadedApplications.end(); iter++)
+            // Work on a snapshot so running launches are not blocked while the list is built
+            std::vector<std::shared_ptr<ApplicationContext>> loadedApplications = mLoadedApplications.getApplications();
+            std::vector<RuntimeStats> runtimeStats;
+            RuntimeManagerHandler* runtimeManagerHandler = verbose ? RequestHandler::getInstance()->getRuntimeManagerHandler() : nullptr;
+            if (nullptr != runtimeManagerHandler)
             {
-                if (nullptr != *iter)
+                std::vector<string> appInstanceIds;
+                for (auto iter = loadedApplications.begin(); iter != loadedApplications.end(); iter++)
+                {
+                    appInstanceIds.push_back((nullptr != *iter) ? (*iter)->getAppInstanceId() : string());
+                }
+                mRuntimeStatsCollector.collect(appInstanceIds, [runtimeManagerHandler](const string& appInstanceId, string& stats) {
+                    return runtimeManagerHandler->getRuntimeStats(appInstanceId, stats);
+                }, runtimeStats);
+            }
+            for (size_t index = 0; index < loadedApplications.size(); index++)
+            {
+                if (nullptr != loadedApplications[index])
                 {
                     JsonObject appData;
-                    ApplicationContext* context = (*iter).get();
+                    ApplicationContext* context = loadedApplications[index].get();
                     appData["appInstanceID"] = context->getAppInstanceId();
                     appData["appId"] = context->getAppId();
                     struct timespec lastStateChangeTime = context->getLastLifecycleStateChangeTime();
@@ -223,21 +292,15 @@ namespace WPEFramework
                     appData["activeSessionId"] = context->getActiveSessionId();
                     appData["targetLifecycleState"] = (uint32_t) context->getTargetLifecycleState();
                     appData["mostRecentIntent"] = context->getMostRecentIntent();
-                    if (verbose)
+                    if (index < runtimeStats.size())
                     {
-                        RuntimeManagerHandler* runtimeManagerHandler = RequestHandler::getInstance()->getRuntimeManagerHandler();
-                        if (nullptr != runtimeManagerHandler)
+                        if (true == runtimeStats[index].mAvailable)
                         {
-                            string runtimeStats("");
-                            bool runtimeStatsResult = runtimeManagerHandler->getRuntimeStats(context->getAppInstanceId(), runtimeStats);
-                            if (true == runtimeStatsResult)
-                            {
-                                appData["runtimeStats"] = runtimeStats;
-                            }
-                            else
-                            {
-                                LOGWARN("Unable to get runtime status for appInstanceId=%s", context->getAppInstanceId().c_str());
-                            }
+                            appData["runtimeStats"] = runtimeStats[index].mStats;
+                        }
+                        else
+                        {
+                            LOGWARN("Unable to get runtime status for appInstanceId=%s", context->getAppInstanceId().c_str());
                         }
                     }
                     appsInformation.Add(appData);
@@ -263,18 +326,41 @@ namespace WPEFramework
         {
 	    // Launches an app.  This will be an asynchronous call.
             // Notifies appropriate API Gateway when an app is about to be loaded
-            // Lifecycle manager will create the appInstanceId once the app is loaded.  Ripple is responsible for creating a token. 
+            // Lifecycle manager creates the appInstanceId before queuing the launch and returns it once the app is loaded.  Ripple is responsible for creating a token. 
+            return spawnApp(appId, launchIntent, targetLifecycleState, runtimeConfigObject, launchArgs, true, appInstanceId, errorReason, success);
+        }
+
+        Core::hresult LifecycleManagerImplementation::SpawnAppAsync(const string& appId, const string& launchIntent, const LifecycleState targetLifecycleState, const WPEFramework::Exchange::RuntimeConfig& runtimeConfigObject, const string& launchArgs, string& appInstanceId, string& errorReason, bool& success)
+        {
+            return spawnApp(appId, launchIntent, targetLifecycleState, runtimeConfigObject, launchArgs, false, appInstanceId, errorReason, success);
+        }
+
+        Core::hresult LifecycleManagerImplementation::spawnApp(const string& appId, const string& launchIntent, const LifecycleState targetLifecycleState, const WPEFramework::Exchange::RuntimeConfig& runtimeConfigObject, const string& launchArgs, bool waitForLoading, string& appInstanceId, string& errorReason, bool& success)
+        {
             Core::hresult status = Core::ERROR_NONE;
             bool firstLaunch = false;
             time_t requestTime = 0;
             requestTime = LifecycleManagerTelemetryReporting::getInstance().getCurrentTimestampMs();
             auto context = getContext("", appId);
+            std::shared_ptr<ApplicationContext> newContext;
+            if (nullptr == context)
+            {
+                // Prepare the context and its appInstanceId before taking the lock
+                newContext = std::make_shared<ApplicationContext>(appId);
+                string generatedInstanceId = ApplicationContext::generateAppInstanceId();
+                newContext->setAppInstanceId(generatedInstanceId);
+                newContext->setApplicationLaunchParams(appId, launchIntent, launchArgs, targetLifecycleState, runtimeConfigObject);
+            }
             mAdminLock.Lock();
             if (nullptr == context)
 	    {
-                context = std::make_shared<ApplicationContext>(appId);
-                context->setApplicationLaunchParams(appId, launchIntent, launchArgs, targetLifecycleState, runtimeConfigObject);
-		mLoadedApplications.push_back(context);
+                // Another launch of the same app may have won the race
+                context = getContext("", appId);
+            }
+            if (nullptr == context)
+	    {
+                context = newContext;
+		mLoadedApplications.add(context);
                 firstLaunch = true;
 	    }
             else if (context->mPendingStateTransition)
@@ -288,19 +374,20 @@ namespace WPEFramework
             context->setMostRecentIntent(launchIntent);
             context->resetPendingStates();
             success = RequestHandler::getInstance()->launch(context.get(), launchIntent, targetLifecycleState, errorReason);
+            mAdminLock.Unlock();
+
             if (!success)
 	    {
                 status = Core::ERROR_GENERAL;
 	    }
             else
 	    {
-                if (firstLaunch)
+                if (firstLaunch && waitForLoading)
 		{
                     sem_wait(&context->mReachedLoadingStateSemaphore);
 		}
                 appInstanceId = context->getAppInstanceId();
             }
-            mAdminLock.Unlock();
             return status;
         }
         
@@ -329,6 +416,21 @@ namespace WPEFramework
                 status = Core::ERROR_GENERAL;
                 return status;
             }
+            string errorReason("");
+            prepareTargetState(context.get(), targetLifecycleState, launchIntent, requestTime);
+            bool success = RequestHandler::getInstance()->updateState(context.get(), targetLifecycleState, errorReason);
+            mAdminLock.Unlock();
+            if (false == success)
+            {
+                LOGERR("SetTargetAppState failed: updateState returned false appInstanceId=%s appId=%s targetState=%d errorReason=%s", appInstanceId.c_str(), context->getAppId().c_str(), static_cast<int>(targetLifecycleState), errorReason.c_str());
+                status = Core::ERROR_GENERAL;
+                return status;
+            }
+            return status;
+        }
+
+        void LifecycleManagerImplementation::prepareTargetState(ApplicationContext* context, const Exchange::ILifecycleManager::LifecycleState targetLifecycleState, const string& launchIntent, time_t requestTime)
+        {
             switch(targetLifecycleState)
             {
                 case Exchange::ILifecycleManager::LifecycleState::PAUSED:        //before SUSPEND or HIBERNATE app will be PAUSED
@@ -357,21 +459,206 @@ namespace WPEFramework
                     LOGERR("Invalid targetLifecycleState=%d for appId=%s currentState=%d", static_cast<int>(targetLifecycleState), context->getAppId().c_str(), static_cast<int>(context->getCurrentLifecycleState()));
                 break;
             }
-            string errorReason("");
             context->setTargetLifecycleState(targetLifecycleState);
             context->setMostRecentIntent(launchIntent);
             context->resetPendingStates();
-            bool success = RequestHandler::getInstance()->updateState(context.get(), targetLifecycleState, errorReason);
+        }
+
+        Core::hresult LifecycleManagerImplementation::SetTargetAppStates(const std::vector<TargetAppState>& targetAppStates, const TargetAppStatesCompletion& completion, uint32_t& batchId, string& errorReason)
+        {
+            time_t requestTime = LifecycleManagerTelemetryReporting::getInstance().getCurrentTimestampMs();
+            std::vector<std::shared_ptr<ApplicationContext>> contexts;
+            std::set<string> appInstanceIds;
+            batchId = 0;
+            if (targetAppStates.empty())
+            {
+                errorReason = "No target app states given";
+                return Core::ERROR_GENERAL;
+            }
+
+            // Lookups only need the registry lock, the admin lock is taken once for the whole batch
+            for (auto iter = targetAppStates.begin(); iter != targetAppStates.end(); iter++)
+            {
+                auto context = getContext(iter->mAppInstanceId, "");
+                if (nullptr == context)
+                {
+                    errorReason = "Unknown appInstanceId " + iter->mAppInstanceId;
+                }
+                else if (false == appInstanceIds.insert(iter->mAppInstanceId).second)
+                {
+                    errorReason = "Duplicate appInstanceId " + iter->mAppInstanceId;
+                }
+                else if ((Exchange::ILifecycleManager::LifecycleState::PAUSED != iter->mTargetLifecycleState) &&
+                         (Exchange::ILifecycleManager::LifecycleState::SUSPENDED != iter->mTargetLifecycleState) &&
+                         (Exchange::ILifecycleManager::LifecycleState::HIBERNATED != iter->mTargetLifecycleState) &&
+                         (Exchange::ILifecycleManager::LifecycleState::ACTIVE != iter->mTargetLifecycleState))
+                {
+                    errorReason = "Invalid targetLifecycleState for appInstanceId " + iter->mAppInstanceId;
+                }
+                if (!errorReason.empty())
+                {
+                    LOGERR("SetTargetAppStates rejected: %s", errorReason.c_str());
+                    return Core::ERROR_GENERAL;
+                }
+                contexts.push_back(context);
+            }
+
+            TargetAppStatesBatch batch;
+            batch.mCompletion = completion;
+            mAdminLock.Lock();
+            for (size_t index = 0; index < contexts.size(); index++)
+            {
+                if (contexts[index]->mPendingStateTransition)
+                {
+                    mAdminLock.Unlock();
+                    errorReason = "State transition pending for appInstanceId " + targetAppStates[index].mAppInstanceId;
+                    LOGERR("SetTargetAppStates rejected: %s", errorReason.c_str());
+                    return Core::ERROR_GENERAL;
+                }
+            }
+
+            batchId = mNextBatchId++;
+            batch.mBatchId = batchId;
+            for (size_t index = 0; index < contexts.size(); index++)
+            {
+                ApplicationContext* context = contexts[index].get();
+                const TargetAppState& targetAppState = targetAppStates[index];
+                Exchange::ILifecycleManager::LifecycleState currentLifecycleState = context->getCurrentLifecycleState();
+                if (targetAppState.mTargetLifecycleState == currentLifecycleState)
+                {
+                    addTargetAppStateResult(batch.mResults, targetAppState.mAppInstanceId, currentLifecycleState, true, "");
+                    continue;
+                }
+                string updateError("");
+                prepareTargetState(context, targetAppState.mTargetLifecycleState, targetAppState.mLaunchIntent, requestTime);
+                // Transitions of different apps run in parallel on the state transition workers
+                if (RequestHandler::getInstance()->updateState(context, targetAppState.mTargetLifecycleState, updateError))
+                {
+                    batch.mPending[targetAppState.mAppInstanceId] = targetAppState.mTargetLifecycleState;
+                }
+                else
+                {
+                    addTargetAppStateResult(batch.mResults, targetAppState.mAppInstanceId, currentLifecycleState, false, updateError);
+                }
+            }
+            bool completed = batch.mPending.empty();
+            if (!completed)
+            {
+                mTargetAppStatesBatches[batchId] = batch;
+                // An app that never reports its new state must not keep the batch open forever
+                PendingEventTimer::getInstance()->schedule(targetAppStatesDeadlineKey(batchId), TARGET_APP_STATES_DEADLINE);
+            }
             mAdminLock.Unlock();
-            if (false == success)
+
+            LOGINFO("SetTargetAppStates batchId=%u apps=%zu inProgress=%zu", batchId, targetAppStates.size(), batch.mPending.size());
+            if (completed && (nullptr != completion))
             {
-                LOGERR("SetTargetAppState failed: updateState returned false appInstanceId=%s appId=%s targetState=%d errorReason=%s", appInstanceId.c_str(), context->getAppId().c_str(), static_cast<int>(targetLifecycleState), errorReason.c_str());
-                status = Core::ERROR_GENERAL;
-                return status;
+                completion(batchId, batch.mResults);
+            }
+            return Core::ERROR_NONE;
+        }
+
+        void LifecycleManagerImplementation::expireTargetAppStatesBatch(const string& deadlineKey)
+        {
+            TargetAppStatesBatch batch;
+            bool expired = false;
+            mAdminLock.Lock();
+            for (auto batchIter = mTargetAppStatesBatches.begin(); batchIter != mTargetAppStatesBatches.end(); batchIter++)
+            {
+                if (targetAppStatesDeadlineKey(batchIter->first) == deadlineKey)
+                {
+                    batch = batchIter->second;
+                    mTargetAppStatesBatches.erase(batchIter);
+                    expired = true;
+                    break;
+                }
+            }
+            if (expired)
+            {
+                for (auto pending = batch.mPending.begin(); pending != batch.mPending.end(); pending++)
+                {
+                    auto context = getContext(pending->first, "");
+                    Exchange::ILifecycleManager::LifecycleState lifecycleState = (nullptr != context) ? context->getCurrentLifecycleState() : Exchange::ILifecycleManager::LifecycleState::UNLOADED;
+                    addTargetAppStateResult(batch.mResults, pending->first, lifecycleState, false, "Timed out");
+                }
+            }
+            mAdminLock.Unlock();
+
+            if (!expired)
+            {
+                LOGINFO("Ignoring stale deadline of %s", deadlineKey.c_str());
+                return;
+            }
+            LOGERR("SetTargetAppStates batchId=%u timed out with %zu apps still moving", batch.mBatchId, batch.mPending.size());
+            if (nullptr != batch.mCompletion)
+            {
+                batch.mCompletion(batch.mBatchId, batch.mResults);
+            }
+        }
+
+        void LifecycleManagerImplementation::updateTargetAppStatesBatches(const string& appInstanceId, Exchange::ILifecycleManager::LifecycleState oldLifecycleState, Exchange::ILifecycleManager::LifecycleState newLifecycleState, const string& errorReason, std::vector<TargetAppStatesBatch>& completedBatches)
+        {
+            if (mTargetAppStatesBatches.empty())
+            {
+                return;
+            }
+            auto context = getContext(appInstanceId, "");
+            for (auto batchIter = mTargetAppStatesBatches.begin(); batchIter != mTargetAppStatesBatches.end();)
+            {
+                TargetAppStatesBatch& batch = batchIter->second;
+                auto pending = batch.mPending.find(appInstanceId);
+                if (pending != batch.mPending.end())
+                {
+                    bool reached = (pending->second == newLifecycleState);
+                    // Failed hops are reported as old -> old; a new target set meanwhile supersedes the batch
+                    bool failed = !reached && ((oldLifecycleState == newLifecycleState) ||
+                                               (Exchange::ILifecycleManager::LifecycleState::UNLOADED == newLifecycleState) ||
+                                               ((nullptr != context) && (context->getTargetLifecycleState() != pending->second)));
+                    if (reached || failed)
+                    {
+                        addTargetAppStateResult(batch.mResults, appInstanceId, newLifecycleState, reached, errorReason);
+                        batch.mPending.erase(pending);
+                    }
+                }
+                if (batch.mPending.empty())
+                {
+                    completedBatches.push_back(batch);
+                    batchIter = mTargetAppStatesBatches.erase(batchIter);
+                }
+                else
+                {
+                    batchIter++;
+                }
             }
-            return status;
         }
         
+        Core::hresult LifecycleManagerImplementation::GetTransitionLatencies(const string& appId, JsonObject& latencies)
+        {
+            LifecycleManagerTelemetryReporting::getInstance().getTransitionLatencies(appId, latencies);
+            static const char* laneNames[TRANSITION_PRIORITY_COUNT] = { "foreground", "normal", "background" };
+            JsonArray lanes;
+            for (uint32_t priority = 0; priority < TRANSITION_PRIORITY_COUNT; priority++)
+            {
+                TransitionLaneStats stats = StateTransitionHandler::getInstance()->getLaneStats(static_cast<TransitionPriority>(priority));
+                JsonObject lane;
+                lane["priority"] = laneNames[priority];
+                lane["depth"] = stats.mDepth;
+                lane["dequeued"] = stats.mDequeued;
+                lane["totalWaitMs"] = stats.mTotalWaitMs;
+                lane["maxWaitMs"] = stats.mMaxWaitMs;
+                lanes.Add(lane);
+            }
+            latencies["lanes"] = lanes;
+            return Core::ERROR_NONE;
+        }
+
+        Core::hresult LifecycleManagerImplementation::ResetTransitionLatencies()
+        {
+            LifecycleManagerTelemetryReporting::getInstance().resetTransitionLatencies();
+            StateTransitionHandler::getInstance()->resetLaneStats();
+            return Core::ERROR_NONE;
+        }
+
         Core::hresult LifecycleManagerImplementation::UnloadApp(const string& appInstanceId, string& errorReason, bool& success)
         {
             // Begins a graceful shutdown of the app.  Moves the app through the lifecycle states till it ultimately ends in app container being terminated.
@@ -636,26 +923,11 @@ namespace WPEFramework
 
         std::shared_ptr<ApplicationContext> LifecycleManagerImplementation::getContext(const string& appInstanceId, const string& appId) const
 	{
-            std::shared_ptr<ApplicationContext> context = nullptr;
-            mAdminLock.Lock();
-            auto iter = mLoadedApplications.end();
-	    for (iter = mLoadedApplications.begin(); iter != mLoadedApplications.end(); iter++)
-	    {
-                if (nullptr != *iter)
-		{
-                    if ((!appInstanceId.empty()) && ((*iter)->getAppInstanceId() == appInstanceId))
-                    {
-		        context = *iter;
-		        break;
-                    }
-		    else if ((!appId.empty()) && ((*iter)->getAppId() == appId))
-                    {
-		        context = *iter;
-		        break;
-                    }
-		}
-	    }
-            mAdminLock.Unlock();
+            std::shared_ptr<ApplicationContext> context = mLoadedApplications.findByAppInstanceId(appInstanceId);
+            if (nullptr == context)
+            {
+                context = mLoadedApplications.findByAppId(appId);
+            }
 	    return context;
 	}
 
@@ -708,6 +980,11 @@ namespace WPEFramework
                         context->setApplicationKillParams(false);
                         context->resetPendingStates();
                         context->setTerminated(true);
+                        if (mRespawnGovernor.recordCrash(context->getAppId()))
+                        {
+                            LOGERR("App [%s] keeps terminating unexpectedly, respawns are suspended", context->getAppId().c_str());
+                            notifyOnFailure(appInstanceId, "crash loop detected");
+                        }
 
                         terminated = RequestHandler::getInstance()->terminate(context.get(), false, terminateError);
                         if(terminated)
@@ -785,23 +1062,91 @@ namespace WPEFramework
 	    {
 	        return;
 	    }
-            Core::SafeSyncType<Core::CriticalSection> adminLock(mAdminLock);
-            auto iter = mLoadedApplications.end();
-	    for (iter = mLoadedApplications.begin(); iter != mLoadedApplications.end(); iter++)
-	    {
-                if (nullptr == *iter)
-		{
-                    continue;
-		}
-                if ((*iter)->getAppInstanceId() == appInstanceId)
-	        {
-	            break;	    
+            mLoadedApplications.remove(appInstanceId);
+            mRuntimeStatsCollector.invalidate(appInstanceId);
+        }
+
+        void LifecycleManagerImplementation::handlePendingEventTimeout(const string& appInstanceId, const string& eventName)
+        {
+            // Runs on the timer wheel thread, anything that blocks is handed to the worker pool
+            if (0 == eventName.compare(TARGET_APP_STATES_DEADLINE))
+            {
+                expireTargetAppStatesBatch(appInstanceId);
+                return;
+            }
+
+            mAdminLock.Lock();
+            auto context = getContext(appInstanceId, "");
+            if ((nullptr == context) || (false == context->mPendingStateTransition) || (0 != context->mPendingEventName.compare(eventName)))
+            {
+                mAdminLock.Unlock();
+                LOGINFO("Ignoring stale %s deadline for appInstanceId=%s", eventName.c_str(), appInstanceId.c_str());
+                return;
+            }
+
+            LOGERR("App [%s] - [%s] did not send %s in time", context->getAppId().c_str(), appInstanceId.c_str(), eventName.c_str());
+            if (0 == eventName.compare("onAppTerminating"))
+            {
+                const bool forced = context->getApplicationKillParams().mForce;
+                if (true == forced)
+                {
+                    LOGERR("Unloading app [%s] without termination confirmation from runtime", appInstanceId.c_str());
+                    addStateTransitionRequest(context.get(), eventName);
                 }
-	    }
-	    if (iter != mLoadedApplications.end())
-	    {
-                mLoadedApplications.erase(iter);
-	    }
+                mAdminLock.Unlock();
+                notifyOnFailure(appInstanceId, eventName + " timeout");
+                if (false == forced)
+                {
+                    JsonObject params;
+                    params["appInstanceId"] = appInstanceId;
+                    params["eventName"] = eventName;
+                    dispatchEvent(LifecycleManagerImplementation::EventNames::LIFECYCLE_MANAGER_EVENT_PENDINGEVENTKILL, params);
+                }
+                return;
+            }
+
+            // The app is stuck before reaching its target state, kill it so its container and display are reclaimed
+            context->resetPendingStates();
+            context->setRequestType(REQUEST_TYPE_TERMINATE);
+            context->setTargetLifecycleState(Exchange::ILifecycleManager::LifecycleState::TERMINATING);
+            context->setApplicationKillParams(true);
+            mAdminLock.Unlock();
+            notifyOnFailure(appInstanceId, eventName + " timeout");
+
+            string errorReason("");
+            if (false == RequestHandler::getInstance()->terminate(context.get(), true, errorReason))
+            {
+                LOGERR("Failed to kill stalled app [%s] error[%s]", appInstanceId.c_str(), errorReason.c_str());
+            }
+        }
+
+        void LifecycleManagerImplementation::killStalledApp(const string& appInstanceId, const string& eventName)
+        {
+            // The kill waits on RuntimeManager, so it runs on the worker pool without holding the admin lock
+            string errorReason("");
+            RuntimeManagerHandler* runtimeManagerHandler = RequestHandler::getInstance()->getRuntimeManagerHandler();
+            const bool killed = (nullptr != runtimeManagerHandler) && runtimeManagerHandler->kill(appInstanceId, errorReason);
+
+            mAdminLock.Lock();
+            auto context = getContext(appInstanceId, "");
+            if ((nullptr == context) || (false == context->mPendingStateTransition) || (0 != context->mPendingEventName.compare(eventName)))
+            {
+                mAdminLock.Unlock();
+                LOGINFO("App [%s] left %s while it was killed", appInstanceId.c_str(), eventName.c_str());
+                return;
+            }
+            if (true == killed)
+            {
+                // The forced kill gets its own deadline before the context is given up
+                context->setApplicationKillParams(true);
+                PendingEventTimer::getInstance()->schedule(appInstanceId, eventName);
+            }
+            else
+            {
+                LOGERR("Unloading app [%s] without termination confirmation from runtime error[%s]", appInstanceId.c_str(), errorReason.c_str());
+                addStateTransitionRequest(context.get(), eventName);
+            }
+            mAdminLock.Unlock();
         }
 
         bool LifecycleManagerImplementation::tryGetPendingRespawn(const string& appInstanceId, PendingRespawnRequest& pendingRespawn)
@@ -818,6 +1163,19 @@ namespace WPEFramework
             return true;
         }
 
+        void LifecycleManagerImplementation::scheduleRespawn(const string& appInstanceId, const PendingRespawnRequest& pendingRespawn)
+        {
+            const string& appId = pendingRespawn.mLaunchParams.mAppId;
+            uint32_t delayMs = 0;
+            if (false == mRespawnGovernor.schedule(appId, [this, pendingRespawn]() { handlePendingRespawn(pendingRespawn); }, delayMs))
+            {
+                LOGERR("Not respawning app [%s], it crashed %u times within the crash window", appId.c_str(), mRespawnGovernor.getCrashCount(appId));
+                notifyOnFailure(appInstanceId, "respawn suspended after repeated crashes");
+                return;
+            }
+            LOGINFO("Respawn of app [%s] scheduled in %u ms", appId.c_str(), delayMs);
+        }
+
         void LifecycleManagerImplementation::handlePendingRespawn(const PendingRespawnRequest& pendingRespawn)
         {
             string appInstanceId(""), errorReason("");
@@ -825,17 +1183,21 @@ namespace WPEFramework
             const ApplicationLaunchParams& launchParams = pendingRespawn.mLaunchParams;
 
             LOGINFO("Respawning app [%s] after unload confirmation", launchParams.mAppId.c_str());
-            Core::hresult status = SpawnApp(launchParams.mAppId,
-                                            launchParams.mLaunchIntent,
-                                            launchParams.mTargetState,
-                                            launchParams.mRuntimeConfigObject,
-                                            launchParams.mLaunchArgs,
-                                            appInstanceId,
-                                            errorReason,
-                                            success);
+            // Runs on the respawn governor thread with no lock held. The async spawn only takes
+            // mAdminLock and queues the launch, so the governor never waits for LOADING
+            Core::hresult status = SpawnAppAsync(launchParams.mAppId,
+                                                 launchParams.mLaunchIntent,
+                                                 launchParams.mTargetState,
+                                                 launchParams.mRuntimeConfigObject,
+                                                 launchParams.mLaunchArgs,
+                                                 appInstanceId,
+                                                 errorReason,
+                                                 success);
             if ((Core::ERROR_NONE != status) || (false == success))
             {
                 LOGERR("Failed to respawn app [%s] after unload confirmation. status[%d] success[%d] error[%s]", launchParams.mAppId.c_str(), status, success, errorReason.c_str());
+                // A respawn that cannot even start counts against the app like a crash
+                mRespawnGovernor.recordCrash(launchParams.mAppId);
             }
         }
 
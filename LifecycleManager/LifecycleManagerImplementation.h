@@ -24,10 +24,19 @@
 #include <interfaces/ILifecycleManagerState.h>
 #include <interfaces/IConfiguration.h>
 #include "IEventHandler.h"
+#include "ILifecycleManagerLocal.h"
 #include "UtilsLogging.h"
 #include "tracing/Logging.h"
 #include "ApplicationContext.h"
+#include "StateTransitionHandler.h"
+#include "ApplicationRegistry.h"
+#include "RuntimeStatsCollector.h"
+#include "RespawnGovernor.h"
+#include "PendingEventTimer.h"
+#include <functional>
 #include <map>
+#include <set>
+#include <vector>
 
 namespace WPEFramework
 {
@@ -37,14 +46,66 @@ namespace WPEFramework
 					     , public Exchange::ILifecycleManagerState
 					     , public Exchange::IConfiguration
 					     , public IEventHandler
+					     , public ILifecycleManagerLocal
 	{
+            private:
+                class Configuration : public Core::JSON::Container {
+                    public:
+                        Configuration()
+                            : Core::JSON::Container()
+                            , transitionWorkers(DEFAULT_STATE_TRANSITION_WORKERS)
+                            , runtimeStatsCacheTtl(DEFAULT_RUNTIME_STATS_CACHE_TTL_MS)
+                            , onAppRunningTimeout(DEFAULT_ON_APP_RUNNING_TIMEOUT_MS)
+                            , onAppReadyTimeout(DEFAULT_ON_APP_READY_TIMEOUT_MS)
+                            , onFirstFrameTimeout(DEFAULT_ON_FIRST_FRAME_TIMEOUT_MS)
+                            , onAppTerminatingTimeout(DEFAULT_ON_APP_TERMINATING_TIMEOUT_MS)
+                            , respawnBackoffInitial(DEFAULT_RESPAWN_BACKOFF_INITIAL_MS)
+                            , respawnBackoffMax(DEFAULT_RESPAWN_BACKOFF_MAX_MS)
+                            , respawnCrashWindow(DEFAULT_RESPAWN_CRASH_WINDOW_MS)
+                            , respawnCrashLimit(DEFAULT_RESPAWN_CRASH_LIMIT)
+                            , targetAppStatesTimeout(DEFAULT_TARGET_APP_STATES_TIMEOUT_MS)
+                        {
+                            Add(_T("transitionWorkers"), &transitionWorkers);
+                            Add(_T("runtimeStatsCacheTtl"), &runtimeStatsCacheTtl);
+                            Add(_T("onAppRunningTimeout"), &onAppRunningTimeout);
+                            Add(_T("onAppReadyTimeout"), &onAppReadyTimeout);
+                            Add(_T("onFirstFrameTimeout"), &onFirstFrameTimeout);
+                            Add(_T("onAppTerminatingTimeout"), &onAppTerminatingTimeout);
+                            Add(_T("respawnBackoffInitial"), &respawnBackoffInitial);
+                            Add(_T("respawnBackoffMax"), &respawnBackoffMax);
+                            Add(_T("respawnCrashWindow"), &respawnCrashWindow);
+                            Add(_T("respawnCrashLimit"), &respawnCrashLimit);
+                            Add(_T("targetAppStatesTimeout"), &targetAppStatesTimeout);
+                        }
+                        ~Configuration() = default;
+
+                        Configuration(Configuration&&) = delete;
+                        Configuration(const Configuration&) = delete;
+                        Configuration& operator=(Configuration&&) = delete;
+                        Configuration& operator=(const Configuration&) = delete;
+
+                    public:
+                        Core::JSON::DecUInt32 transitionWorkers;
+                        Core::JSON::DecUInt32 runtimeStatsCacheTtl;
+                        Core::JSON::DecUInt32 onAppRunningTimeout;
+                        Core::JSON::DecUInt32 onAppReadyTimeout;
+                        Core::JSON::DecUInt32 onFirstFrameTimeout;
+                        Core::JSON::DecUInt32 onAppTerminatingTimeout;
+                        Core::JSON::DecUInt32 respawnBackoffInitial;
+                        Core::JSON::DecUInt32 respawnBackoffMax;
+                        Core::JSON::DecUInt32 respawnCrashWindow;
+                        Core::JSON::DecUInt32 respawnCrashLimit;
+                        Core::JSON::DecUInt32 targetAppStatesTimeout;
+                };
+
             public:
                 enum EventNames
                 {
                     LIFECYCLE_MANAGER_EVENT_APPSTATECHANGED,
                     LIFECYCLE_MANAGER_EVENT_RUNTIME,
                     LIFECYCLE_MANAGER_EVENT_WINDOW,
-                    LIFECYCLE_MANAGER_EVENT_ONFAILURE
+                    LIFECYCLE_MANAGER_EVENT_ONFAILURE,
+                    LIFECYCLE_MANAGER_EVENT_PENDINGEVENTKILL
                 };
 
                 struct PendingRespawnRequest
@@ -57,6 +118,9 @@ namespace WPEFramework
                     ApplicationLaunchParams mLaunchParams;
 	        };
 
+                typedef ILifecycleManagerLocal::TargetAppState TargetAppState;
+                typedef ILifecycleManagerLocal::TargetAppStatesCompletion TargetAppStatesCompletion;
+
                 class EXTERNAL Job : public Core::IDispatch
 	        {
                     protected:
@@ -112,6 +176,7 @@ namespace WPEFramework
 		INTERFACE_ENTRY(Exchange::ILifecycleManager)
                 INTERFACE_ENTRY(Exchange::ILifecycleManagerState)
                 INTERFACE_ENTRY(Exchange::IConfiguration)
+                INTERFACE_ENTRY(ILifecycleManagerLocal)
 	        END_INTERFACE_MAP
 
                 /* ILifecycleManager methods  */
@@ -120,7 +185,10 @@ namespace WPEFramework
                 virtual Core::hresult GetLoadedApps(const bool verbose, string& apps) override;
                 virtual Core::hresult IsAppLoaded(const string& appId, bool& loaded) const override;
                 virtual Core::hresult SpawnApp(const string& appId, const string& launchIntent, const Exchange::ILifecycleManager::LifecycleState targetLifecycleState, const WPEFramework::Exchange::RuntimeConfig& runtimeConfigObject, const string& launchArgs, string& appInstanceId, string& errorReason, bool& success) override;
+                /** Same as SpawnApp but returns without waiting for LOADING; completion is reported through OnAppStateChanged */
+                virtual Core::hresult SpawnAppAsync(const string& appId, const string& launchIntent, const Exchange::ILifecycleManager::LifecycleState targetLifecycleState, const WPEFramework::Exchange::RuntimeConfig& runtimeConfigObject, const string& launchArgs, string& appInstanceId, string& errorReason, bool& success);
                 virtual Core::hresult SetTargetAppState(const string& appInstanceId, const Exchange::ILifecycleManager::LifecycleState targetLifecycleState, const string& launchIntent) override;
+
                 virtual Core::hresult UnloadApp(const string& appInstanceId, string& errorReason, bool& success) override;
                 virtual Core::hresult KillApp(const string& appInstanceId, string& errorReason, bool& success) override;
                 virtual Core::hresult SendIntentToActiveApp(const string& appInstanceId, const string& intent, string& errorReason, bool& success) override;
@@ -143,12 +211,28 @@ namespace WPEFramework
                 virtual void onRippleEvent(string name, JsonObject& data) override;
                 virtual void onStateChangeEvent(JsonObject& data) override;
 
+                /* ILifecycleManagerLocal methods */
+                virtual Core::hresult SetTargetAppStates(const std::vector<TargetAppState>& targetAppStates, const TargetAppStatesCompletion& completion, uint32_t& batchId, string& errorReason) override;
+                virtual Core::hresult GetTransitionLatencies(const string& appId, JsonObject& latencies) override;
+                virtual Core::hresult ResetTransitionLatencies() override;
+
 	    private: /* members */
                 mutable Core::CriticalSection mAdminLock;
 	        std::list<Exchange::ILifecycleManager::INotification*> mLifecycleManagerNotification;
 	        std::list<Exchange::ILifecycleManagerState::INotification*> mLifecycleManagerStateNotification;
-                std::list<std::shared_ptr<ApplicationContext>> mLoadedApplications;
+                ApplicationRegistry mLoadedApplications;
+                RuntimeStatsCollector mRuntimeStatsCollector;
                 std::map<string, PendingRespawnRequest> mPendingRespawns;
+                RespawnGovernor mRespawnGovernor;
+                struct TargetAppStatesBatch
+                {
+                    uint32_t mBatchId;
+                    std::map<string, Exchange::ILifecycleManager::LifecycleState> mPending;
+                    JsonArray mResults;
+                    TargetAppStatesCompletion mCompletion;
+                };
+                std::map<uint32_t, TargetAppStatesBatch> mTargetAppStatesBatches;
+                uint32_t mNextBatchId;
                 PluginHost::IShell* mService;
 	    private: /* internal methods */
                 bool initialize(PluginHost::IShell* service);
@@ -158,8 +242,15 @@ namespace WPEFramework
                 void handleRuntimeManagerEvent(const JsonObject &data);
                 void notifyOnFailure(const string& appInstanceId, const string& errorCode);
                 void handleStateChangeEvent(const JsonObject &data);
+                void handlePendingEventTimeout(const string& appInstanceId, const string& eventName);
+                void killStalledApp(const string& appInstanceId, const string& eventName);
+                void prepareTargetState(ApplicationContext* context, const Exchange::ILifecycleManager::LifecycleState targetLifecycleState, const string& launchIntent, time_t requestTime);
+                void expireTargetAppStatesBatch(const string& deadlineKey);
+                void updateTargetAppStatesBatches(const string& appInstanceId, Exchange::ILifecycleManager::LifecycleState oldLifecycleState, Exchange::ILifecycleManager::LifecycleState newLifecycleState, const string& errorReason, std::vector<TargetAppStatesBatch>& completedBatches);
                 bool tryGetPendingRespawn(const string& appInstanceId, PendingRespawnRequest& pendingRespawn);
+                void scheduleRespawn(const string& appInstanceId, const PendingRespawnRequest& pendingRespawn);
                 void handlePendingRespawn(const PendingRespawnRequest& pendingRespawn);
+                Core::hresult spawnApp(const string& appId, const string& launchIntent, const Exchange::ILifecycleManager::LifecycleState targetLifecycleState, const WPEFramework::Exchange::RuntimeConfig& runtimeConfigObject, const string& launchArgs, bool waitForLoading, string& appInstanceId, string& errorReason, bool& success);
                 void handleWindowManagerEvent(const JsonObject &data);
                 std::shared_ptr<ApplicationContext> getContext(const string& appInstanceId, const string& appId) const;
                 void addStateTransitionRequest(ApplicationContext* context, std::string event);
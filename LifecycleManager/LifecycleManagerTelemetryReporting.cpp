@@ -26,7 +26,43 @@ namespace WPEFramework
 {
 namespace Plugin
 {
-    LifecycleManagerTelemetryReporting::LifecycleManagerTelemetryReporting()
+    /* Upper bounds in milliseconds, the last bucket collects everything slower */
+    static const uint64_t sLatencyBucketBoundsMs[LIFECYCLE_LATENCY_BUCKET_COUNT - 1] = { 10, 25, 50, 100, 250, 500, 1000, 2500, 5000 };
+
+    LifecycleManagerTelemetryReporting::LatencyHistogram::LatencyHistogram(): mCount(0), mTotalMs(0), mMaxMs(0), mBuckets()
+    {
+    }
+
+    void LifecycleManagerTelemetryReporting::LatencyHistogram::add(uint64_t latencyMs)
+    {
+        size_t bucket = 0;
+        while ((bucket < (LIFECYCLE_LATENCY_BUCKET_COUNT - 1)) && (latencyMs > sLatencyBucketBoundsMs[bucket]))
+        {
+            bucket++;
+        }
+        mBuckets[bucket]++;
+        mCount++;
+        mTotalMs += latencyMs;
+        if (latencyMs > mMaxMs)
+        {
+            mMaxMs = latencyMs;
+        }
+    }
+
+    void LifecycleManagerTelemetryReporting::LatencyHistogram::toJson(JsonObject& histogram) const
+    {
+        JsonArray buckets;
+        for (size_t bucket = 0; bucket < LIFECYCLE_LATENCY_BUCKET_COUNT; bucket++)
+        {
+            buckets.Add(static_cast<uint64_t>(mBuckets[bucket]));
+        }
+        histogram["count"] = mCount;
+        histogram["totalMs"] = mTotalMs;
+        histogram["maxMs"] = mMaxMs;
+        histogram["buckets"] = buckets;
+    }
+
+    LifecycleManagerTelemetryReporting::LifecycleManagerTelemetryReporting(): mLatencyLock(), mTransitionLatencies(), mAppTransitionLatencies()
     {
     }
 
@@ -169,7 +205,62 @@ namespace Plugin
         }
     }
 
-} /* namespace Plugin */
-} /* namespace WPEFramework */
+    void LifecycleManagerTelemetryReporting::recordTransitionLatency(const string& appId, Exchange::ILifecycleManager::LifecycleState oldLifecycleState, Exchange::ILifecycleManager::LifecycleState newLifecycleState, uint64_t latencyMs)
+    {
+        uint32_t key = (static_cast<uint32_t>(oldLifecycleState) << 8) | static_cast<uint32_t>(newLifecycleState);
+        std::lock_guard<std::mutex> lock(mLatencyLock);
+        mTransitionLatencies[key].add(latencyMs);
+        mAppTransitionLatencies[appId][key].add(latencyMs);
+    }
 
+    void LifecycleManagerTelemetryReporting::addTransitionLatencies(const LatencyHistograms& histograms, JsonArray& transitions)
+    {
+        for (auto iter = histograms.begin(); iter != histograms.end(); iter++)
+        {
+            JsonObject transition;
+            transition["oldLifecycleState"] = (uint32_t)(iter->first >> 8);
+            transition["newLifecycleState"] = (uint32_t)(iter->first & 0xFF);
+            iter->second.toJson(transition);
+            transitions.Add(transition);
+        }
+    }
+
+    void LifecycleManagerTelemetryReporting::getTransitionLatencies(const string& appId, JsonObject& latencies)
+    {
+        JsonArray bucketBounds;
+        for (size_t bucket = 0; bucket < (LIFECYCLE_LATENCY_BUCKET_COUNT - 1); bucket++)
+        {
+            bucketBounds.Add(sLatencyBucketBoundsMs[bucket]);
+        }
+        JsonArray transitions;
+        JsonArray apps;
 
+        std::lock_guard<std::mutex> lock(mLatencyLock);
+        addTransitionLatencies(mTransitionLatencies, transitions);
+        for (auto iter = mAppTransitionLatencies.begin(); iter != mAppTransitionLatencies.end(); iter++)
+        {
+            if (!appId.empty() && (appId != iter->first))
+            {
+                continue;
+            }
+            JsonObject app;
+            JsonArray appTransitions;
+            addTransitionLatencies(iter->second, appTransitions);
+            app["appId"] = iter->first;
+            app["transitions"] = appTransitions;
+            apps.Add(app);
+        }
+        latencies["bucketBoundsMs"] = bucketBounds;
+        latencies["transitions"] = transitions;
+        latencies["apps"] = apps;
+    }
+
+    void LifecycleManagerTelemetryReporting::resetTransitionLatencies()
+    {
+        std::lock_guard<std::mutex> lock(mLatencyLock);
+        mTransitionLatencies.clear();
+        mAppTransitionLatencies.clear();
+    }
+
+} /* namespace Plugin */
+} /* namespace WPEFramework */
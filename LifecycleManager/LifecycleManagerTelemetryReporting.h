@@ -22,6 +22,10 @@
 #include "ApplicationContext.h"
 #include "TelemetryMarkers.h"
 #include "TelemetryReportingBase.h"
+#include <map>
+#include <mutex>
+
+#define LIFECYCLE_LATENCY_BUCKET_COUNT 10
 
 namespace WPEFramework
 {
@@ -37,11 +41,36 @@ class LifecycleManagerTelemetryReporting : public Utils::TelemetryReportingBase
         void reportTelemetryDataOnStateChange(ApplicationContext* context, const JsonObject &data);
         void initialize(PluginHost::IShell* service);
 
+        /* Per-hop latency histograms, kept per state pair and per appId */
+        void recordTransitionLatency(const string& appId, Exchange::ILifecycleManager::LifecycleState oldLifecycleState, Exchange::ILifecycleManager::LifecycleState newLifecycleState, uint64_t latencyMs);
+        void getTransitionLatencies(const string& appId, JsonObject& latencies);
+        void resetTransitionLatencies();
+
     private /*methods*/:
         LifecycleManagerTelemetryReporting();
         ~LifecycleManagerTelemetryReporting();
 
+    private /*types*/:
+        struct LatencyHistogram
+        {
+            LatencyHistogram();
+            void add(uint64_t latencyMs);
+            void toJson(JsonObject& histogram) const;
+
+            uint64_t mCount;
+            uint64_t mTotalMs;
+            uint64_t mMaxMs;
+            uint64_t mBuckets[LIFECYCLE_LATENCY_BUCKET_COUNT];
+        };
+        /* key is (oldLifecycleState << 8) | newLifecycleState */
+        typedef std::map<uint32_t, LatencyHistogram> LatencyHistograms;
+
+        static void addTransitionLatencies(const LatencyHistograms& histograms, JsonArray& transitions);
+
     private /*members*/:
+        std::mutex mLatencyLock;
+        LatencyHistograms mTransitionLatencies;
+        std::map<string, LatencyHistograms> mAppTransitionLatencies;
 };
 
 } /* namespace Plugin */
@@ -0,0 +1,227 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+#include "PendingEventTimer.h"
+#include <system_error>
+#include "UtilsLogging.h"
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        PendingEventTimer* PendingEventTimer::mInstance = nullptr;
+
+        PendingEventTimer* PendingEventTimer::getInstance()
+        {
+            if (nullptr == mInstance)
+            {
+                mInstance = new PendingEventTimer();
+            }
+            return mInstance;
+        }
+
+        PendingEventTimer::PendingEventTimer(): mLock(), mCondition(), mThread(), mRunning(false), mExpiryHandler(), mTimeouts(), mSlots(PENDING_EVENT_TIMER_SLOTS), mCurrentSlot(0), mNextTick(), mDeadlines()
+        {
+            mTimeouts["onAppRunning"] = DEFAULT_ON_APP_RUNNING_TIMEOUT_MS;
+            mTimeouts["onAppReady"] = DEFAULT_ON_APP_READY_TIMEOUT_MS;
+            mTimeouts["onFirstFrame"] = DEFAULT_ON_FIRST_FRAME_TIMEOUT_MS;
+            mTimeouts["onAppTerminating"] = DEFAULT_ON_APP_TERMINATING_TIMEOUT_MS;
+            mTimeouts[TARGET_APP_STATES_DEADLINE] = DEFAULT_TARGET_APP_STATES_TIMEOUT_MS;
+        }
+
+        PendingEventTimer::~PendingEventTimer()
+        {
+            terminate();
+        }
+
+        bool PendingEventTimer::initialize(ExpiryHandler expiryHandler)
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            if (true == mRunning)
+            {
+                return true;
+            }
+            mExpiryHandler = expiryHandler;
+            mRunning = true;
+            try
+            {
+                mThread = std::thread(&PendingEventTimer::run, this);
+            }
+            catch (const std::system_error& ex)
+            {
+                LOGERR("Unable to start pending event timer: %s", ex.what());
+                mRunning = false;
+                return false;
+            }
+            return true;
+        }
+
+        void PendingEventTimer::terminate()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mLock);
+                if (false == mRunning)
+                {
+                    return;
+                }
+                mRunning = false;
+            }
+            mCondition.notify_all();
+            if (mThread.joinable())
+            {
+                mThread.join();
+            }
+            std::lock_guard<std::mutex> lock(mLock);
+            for (auto& slot : mSlots)
+            {
+                slot.clear();
+            }
+            mDeadlines.clear();
+            mExpiryHandler = nullptr;
+        }
+
+        void PendingEventTimer::setTimeout(const string& eventName, uint32_t timeoutMs)
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            mTimeouts[eventName] = timeoutMs;
+        }
+
+        uint32_t PendingEventTimer::getTimeout(const string& eventName)
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            auto iter = mTimeouts.find(eventName);
+            return (iter != mTimeouts.end()) ? iter->second : 0;
+        }
+
+        void PendingEventTimer::schedule(const string& appInstanceId, const string& eventName)
+        {
+            bool wasIdle = false;
+            {
+                std::lock_guard<std::mutex> lock(mLock);
+                if (false == mRunning)
+                {
+                    return;
+                }
+                auto armed = mDeadlines.find(appInstanceId);
+                if (armed != mDeadlines.end())
+                {
+                    // Asking again for the same event must not push the deadline out
+                    if (armed->second.second->mEventName == eventName)
+                    {
+                        return;
+                    }
+                    mSlots[armed->second.first].erase(armed->second.second);
+                    mDeadlines.erase(armed);
+                }
+
+                auto timeout = mTimeouts.find(eventName);
+                if ((timeout == mTimeouts.end()) || (0 == timeout->second))
+                {
+                    return;
+                }
+
+                uint32_t ticks = (timeout->second + PENDING_EVENT_TIMER_TICK_MS - 1) / PENDING_EVENT_TIMER_TICK_MS;
+                wasIdle = mDeadlines.empty();
+                if (wasIdle)
+                {
+                    mNextTick = std::chrono::steady_clock::now() + std::chrono::milliseconds(PENDING_EVENT_TIMER_TICK_MS);
+                }
+                size_t slotIndex = (mCurrentSlot + ticks) % PENDING_EVENT_TIMER_SLOTS;
+                Deadline deadline;
+                deadline.mAppInstanceId = appInstanceId;
+                deadline.mEventName = eventName;
+                deadline.mRounds = (ticks - 1) / PENDING_EVENT_TIMER_SLOTS;
+                Slot& slot = mSlots[slotIndex];
+                mDeadlines[appInstanceId] = std::make_pair(slotIndex, slot.insert(slot.end(), deadline));
+            }
+            if (wasIdle)
+            {
+                mCondition.notify_all();
+            }
+        }
+
+        void PendingEventTimer::cancel(const string& appInstanceId)
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            auto armed = mDeadlines.find(appInstanceId);
+            if (armed != mDeadlines.end())
+            {
+                mSlots[armed->second.first].erase(armed->second.second);
+                mDeadlines.erase(armed);
+            }
+        }
+
+        size_t PendingEventTimer::getScheduledCount()
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            return mDeadlines.size();
+        }
+
+        void PendingEventTimer::run()
+        {
+            std::unique_lock<std::mutex> lock(mLock);
+            while (true == mRunning)
+            {
+                if (mDeadlines.empty())
+                {
+                    mCondition.wait(lock);
+                    continue;
+                }
+                if (std::cv_status::no_timeout == mCondition.wait_until(lock, mNextTick))
+                {
+                    continue;
+                }
+                if ((false == mRunning) || mDeadlines.empty() || (std::chrono::steady_clock::now() < mNextTick))
+                {
+                    continue;
+                }
+
+                mNextTick += std::chrono::milliseconds(PENDING_EVENT_TIMER_TICK_MS);
+                mCurrentSlot = (mCurrentSlot + 1) % PENDING_EVENT_TIMER_SLOTS;
+                std::vector<Deadline> expired;
+                Slot& slot = mSlots[mCurrentSlot];
+                for (auto iter = slot.begin(); iter != slot.end();)
+                {
+                    if (0 == iter->mRounds)
+                    {
+                        mDeadlines.erase(iter->mAppInstanceId);
+                        expired.push_back(*iter);
+                        iter = slot.erase(iter);
+                    }
+                    else
+                    {
+                        iter->mRounds--;
+                        iter++;
+                    }
+                }
+
+                if (!expired.empty() && (nullptr != mExpiryHandler))
+                {
+                    ExpiryHandler expiryHandler = mExpiryHandler;
+                    lock.unlock();
+                    for (auto& deadline : expired)
+                    {
+                        LOGWARN("Timed out waiting for %s from appInstanceId=%s", deadline.mEventName.c_str(), deadline.mAppInstanceId.c_str());
+                        expiryHandler(deadline.mAppInstanceId, deadline.mEventName);
+                    }
+                    lock.lock();
+                }
+            }
+        }
+    } /* namespace Plugin */
+} /* namespace WPEFramework */
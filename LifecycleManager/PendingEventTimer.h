@@ -0,0 +1,98 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+#pragma once
+
+#include <interfaces/ILifecycleManager.h>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <list>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#define DEFAULT_ON_APP_RUNNING_TIMEOUT_MS 15000
+#define DEFAULT_ON_APP_READY_TIMEOUT_MS 30000
+#define DEFAULT_ON_FIRST_FRAME_TIMEOUT_MS 10000
+#define DEFAULT_ON_APP_TERMINATING_TIMEOUT_MS 10000
+#define DEFAULT_TARGET_APP_STATES_TIMEOUT_MS 60000
+#define TARGET_APP_STATES_DEADLINE "targetAppStates"
+#define PENDING_EVENT_TIMER_TICK_MS 100
+#define PENDING_EVENT_TIMER_SLOTS 256
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /*
+         * Hashed timer wheel enforcing deadlines on the events a parked state transition
+         * waits for (onAppRunning, onAppReady, onFirstFrame, onAppTerminating) and on
+         * SetTargetAppStates batches. An app or batch has at most one deadline at a time;
+         * scheduling and cancelling are O(1). The wheel thread only ticks while deadlines
+         * are armed and calls the expiry handler without holding the wheel lock.
+         */
+        class PendingEventTimer
+        {
+            public:
+                typedef std::function<void(const string& appInstanceId, const string& eventName)> ExpiryHandler;
+
+                PendingEventTimer(const PendingEventTimer&) = delete;
+                PendingEventTimer& operator=(const PendingEventTimer&) = delete;
+                static PendingEventTimer* getInstance();
+                ~PendingEventTimer();
+
+                bool initialize(ExpiryHandler expiryHandler);
+                void terminate();
+                void setTimeout(const string& eventName, uint32_t timeoutMs);
+                uint32_t getTimeout(const string& eventName);
+                void schedule(const string& appInstanceId, const string& eventName);
+                void cancel(const string& appInstanceId);
+                size_t getScheduledCount();
+
+            private: /* methods */
+                PendingEventTimer();
+                void run();
+
+            private: /* members */
+                struct Deadline
+                {
+                    string mAppInstanceId;
+                    string mEventName;
+                    uint32_t mRounds;
+                };
+                typedef std::list<Deadline> Slot;
+
+                static PendingEventTimer* mInstance;
+
+                std::mutex mLock;
+                std::condition_variable mCondition;
+                std::thread mThread;
+                bool mRunning;
+                ExpiryHandler mExpiryHandler;
+                std::map<string, uint32_t> mTimeouts;
+                std::vector<Slot> mSlots;
+                size_t mCurrentSlot;
+                std::chrono::steady_clock::time_point mNextTick;
+                std::unordered_map<string, std::pair<size_t, Slot::iterator>> mDeadlines;
+        };
+    } /* namespace Plugin */
+} /* namespace WPEFramework */
@@ -28,6 +28,26 @@ namespace WPEFramework
 {
     namespace Plugin
     {
+        namespace
+        {
+            // Launches and transitions to ACTIVE are user visible; suspending, hibernating
+            // and tearing down apps that are not in the foreground can wait
+            TransitionPriority classifyTransition(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState state)
+            {
+                if ((Exchange::ILifecycleManager::LifecycleState::ACTIVE == state) || (REQUEST_TYPE_LAUNCH == context->getRequestType()))
+                {
+                    return TRANSITION_PRIORITY_FOREGROUND;
+                }
+                if ((Exchange::ILifecycleManager::LifecycleState::SUSPENDED == state) ||
+                    (Exchange::ILifecycleManager::LifecycleState::HIBERNATED == state) ||
+                    ((Exchange::ILifecycleManager::LifecycleState::TERMINATING == state) && (Exchange::ILifecycleManager::LifecycleState::ACTIVE != context->getCurrentLifecycleState())))
+                {
+                    return TRANSITION_PRIORITY_BACKGROUND;
+                }
+                return TRANSITION_PRIORITY_NORMAL;
+            }
+        }
+
         RequestHandler* RequestHandler::mInstance = nullptr;
 
         RequestHandler* RequestHandler::getInstance()
@@ -47,7 +67,7 @@ namespace WPEFramework
 	{
 	}
 
-        bool RequestHandler::initialize(PluginHost::IShell* service, IEventHandler* eventHandler)
+        bool RequestHandler::initialize(PluginHost::IShell* service, IEventHandler* eventHandler, uint32_t transitionWorkers)
 	{
 	    bool ret = false;
 	    mEventHandler = eventHandler;	
@@ -67,7 +87,7 @@ namespace WPEFramework
 		fflush(stdout);
 		return ret;
 	    }
-            StateTransitionHandler::getInstance()->initialize();
+            StateTransitionHandler::getInstance()->initialize(transitionWorkers);
             return ret;
 	}
 
@@ -110,7 +130,7 @@ namespace WPEFramework
 
 	bool RequestHandler::updateState(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState state, string& errorReason)
 	{
-           StateTransitionRequest request(context->shared_from_this(), state);
+           StateTransitionRequest request(context->shared_from_this(), state, classifyTransition(context, state));
            StateTransitionHandler::getInstance()->addRequest(request); 
            return true;
 	}
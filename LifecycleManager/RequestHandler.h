@@ -23,6 +23,7 @@
 #include "RuntimeManagerHandler.h"
 #include "WindowManagerHandler.h"
 #include "IEventHandler.h"
+#include "StateTransitionHandler.h"
 
 namespace WPEFramework
 {
@@ -34,7 +35,7 @@ namespace WPEFramework
                 RequestHandler(const RequestHandler& obj) = delete;
                 static RequestHandler* getInstance();
                 ~RequestHandler ();
-                bool initialize(PluginHost::IShell* service, IEventHandler* eventHandler);
+                bool initialize(PluginHost::IShell* service, IEventHandler* eventHandler, uint32_t transitionWorkers = DEFAULT_STATE_TRANSITION_WORKERS);
 		void terminate();
 
                 bool launch(ApplicationContext* context, const string& launchIntent, const Exchange::ILifecycleManager::LifecycleState targetLifecycleState, string& errorReason);
@@ -0,0 +1,227 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include "RespawnGovernor.h"
+#include <system_error>
+#include <vector>
+#include "UtilsLogging.h"
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        RespawnGovernor::RespawnGovernor(): mLock(), mCondition(), mThread(), mRunning(false), mTerminated(false), mInitialBackoffMs(DEFAULT_RESPAWN_BACKOFF_INITIAL_MS), mMaxBackoffMs(DEFAULT_RESPAWN_BACKOFF_MAX_MS), mCrashWindowMs(DEFAULT_RESPAWN_CRASH_WINDOW_MS), mCrashLimit(DEFAULT_RESPAWN_CRASH_LIMIT), mCrashes(), mDue(), mScheduled()
+        {
+        }
+
+        RespawnGovernor::~RespawnGovernor()
+        {
+            terminate();
+        }
+
+        void RespawnGovernor::configure(uint32_t initialBackoffMs, uint32_t maxBackoffMs, uint32_t crashWindowMs, uint32_t crashLimit)
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            mInitialBackoffMs = initialBackoffMs;
+            mMaxBackoffMs = (maxBackoffMs < initialBackoffMs) ? initialBackoffMs : maxBackoffMs;
+            mCrashWindowMs = crashWindowMs;
+            mCrashLimit = crashLimit;
+            mTerminated = false;
+        }
+
+        void RespawnGovernor::terminate()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mLock);
+                mTerminated = true;
+                mRunning = false;
+            }
+            mCondition.notify_all();
+            if (mThread.joinable())
+            {
+                mThread.join();
+            }
+            std::lock_guard<std::mutex> lock(mLock);
+            mScheduled.clear();
+            mDue.clear();
+            mCrashes.clear();
+        }
+
+        uint32_t RespawnGovernor::pruneCrashesLocked(const string& appId, std::chrono::steady_clock::time_point now)
+        {
+            auto crashes = mCrashes.find(appId);
+            if (crashes == mCrashes.end())
+            {
+                return 0;
+            }
+            const std::chrono::milliseconds window(mCrashWindowMs);
+            while ((false == crashes->second.empty()) && ((now - crashes->second.front()) >= window))
+            {
+                crashes->second.pop_front();
+            }
+            if (crashes->second.empty())
+            {
+                mCrashes.erase(crashes);
+                return 0;
+            }
+            return static_cast<uint32_t>(crashes->second.size());
+        }
+
+        bool RespawnGovernor::recordCrash(const string& appId)
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            if ((true == mTerminated) || (0 == mCrashLimit))
+            {
+                return false;
+            }
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            uint32_t crashCount = pruneCrashesLocked(appId, now);
+            mCrashes[appId].push_back(now);
+            crashCount++;
+            if (crashCount >= mCrashLimit)
+            {
+                // Drop a respawn that was scheduled before the crash that opened the circuit
+                auto scheduled = mScheduled.find(appId);
+                if (scheduled != mScheduled.end())
+                {
+                    mDue.erase(scheduled->second.mDue);
+                    mScheduled.erase(scheduled);
+                }
+            }
+            return (crashCount == mCrashLimit);
+        }
+
+        bool RespawnGovernor::schedule(const string& appId, const RespawnHandler& handler, uint32_t& delayMs)
+        {
+            delayMs = 0;
+            {
+                std::lock_guard<std::mutex> lock(mLock);
+                if (true == mTerminated)
+                {
+                    return false;
+                }
+                const uint32_t crashCount = pruneCrashesLocked(appId, std::chrono::steady_clock::now());
+                if ((0 != mCrashLimit) && (crashCount >= mCrashLimit))
+                {
+                    return false;
+                }
+                if (0 < crashCount)
+                {
+                    uint64_t backoffMs = static_cast<uint64_t>(mInitialBackoffMs) << ((crashCount > 16) ? 16 : (crashCount - 1));
+                    delayMs = (backoffMs > mMaxBackoffMs) ? mMaxBackoffMs : static_cast<uint32_t>(backoffMs);
+                }
+
+                if (false == mRunning)
+                {
+                    try
+                    {
+                        mThread = std::thread(&RespawnGovernor::run, this);
+                    }
+                    catch (const std::system_error& ex)
+                    {
+                        LOGERR("Unable to start respawn governor: %s", ex.what());
+                        return false;
+                    }
+                    mRunning = true;
+                }
+
+                auto scheduled = mScheduled.find(appId);
+                if (scheduled != mScheduled.end())
+                {
+                    mDue.erase(scheduled->second.mDue);
+                    mScheduled.erase(scheduled);
+                }
+                ScheduledRespawn respawn;
+                respawn.mDue = mDue.insert(std::make_pair(std::chrono::steady_clock::now() + std::chrono::milliseconds(delayMs), appId));
+                respawn.mHandler = handler;
+                mScheduled[appId] = respawn;
+            }
+            mCondition.notify_all();
+            return true;
+        }
+
+        void RespawnGovernor::cancel(const string& appId)
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            auto scheduled = mScheduled.find(appId);
+            if (scheduled != mScheduled.end())
+            {
+                mDue.erase(scheduled->second.mDue);
+                mScheduled.erase(scheduled);
+            }
+        }
+
+        bool RespawnGovernor::isCircuitOpen(const string& appId)
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            return ((0 != mCrashLimit) && (pruneCrashesLocked(appId, std::chrono::steady_clock::now()) >= mCrashLimit));
+        }
+
+        uint32_t RespawnGovernor::getCrashCount(const string& appId)
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            return pruneCrashesLocked(appId, std::chrono::steady_clock::now());
+        }
+
+        size_t RespawnGovernor::getScheduledCount()
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            return mScheduled.size();
+        }
+
+        void RespawnGovernor::run()
+        {
+            std::unique_lock<std::mutex> lock(mLock);
+            while (true == mRunning)
+            {
+                if (mDue.empty())
+                {
+                    mCondition.wait(lock);
+                    continue;
+                }
+                if (std::chrono::steady_clock::now() < mDue.begin()->first)
+                {
+                    mCondition.wait_until(lock, mDue.begin()->first);
+                    continue;
+                }
+
+                std::vector<RespawnHandler> due;
+                const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+                while ((false == mDue.empty()) && (mDue.begin()->first <= now))
+                {
+                    auto scheduled = mScheduled.find(mDue.begin()->second);
+                    if (scheduled != mScheduled.end())
+                    {
+                        due.push_back(scheduled->second.mHandler);
+                        mScheduled.erase(scheduled);
+                    }
+                    mDue.erase(mDue.begin());
+                }
+
+                // Respawn handlers launch apps and may call back into the governor
+                lock.unlock();
+                for (auto& handler : due)
+                {
+                    handler();
+                }
+                lock.lock();
+            }
+        }
+    } /* namespace Plugin */
+} /* namespace WPEFramework */
@@ -0,0 +1,95 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include <interfaces/ILifecycleManager.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#define DEFAULT_RESPAWN_BACKOFF_INITIAL_MS 500
+#define DEFAULT_RESPAWN_BACKOFF_MAX_MS 30000
+#define DEFAULT_RESPAWN_CRASH_WINDOW_MS 60000
+#define DEFAULT_RESPAWN_CRASH_LIMIT 5
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        /*
+         * Paces respawns of apps that keep terminating unexpectedly. Crashes are counted
+         * per appId over a sliding window. A respawn is run from the governor thread after
+         * a delay that doubles with every crash in the window, up to a maximum. Once the
+         * window holds the crash limit, the circuit is open and respawns are refused until
+         * old crashes age out of the window. Respawns never run on the caller's thread, so
+         * a crash loop cannot hold up event dispatch or launches of other apps.
+         */
+        class RespawnGovernor
+        {
+            public:
+                typedef std::function<void()> RespawnHandler;
+
+                RespawnGovernor();
+                ~RespawnGovernor();
+                RespawnGovernor(const RespawnGovernor&) = delete;
+                RespawnGovernor& operator=(const RespawnGovernor&) = delete;
+
+                void configure(uint32_t initialBackoffMs, uint32_t maxBackoffMs, uint32_t crashWindowMs, uint32_t crashLimit);
+                void terminate();
+                bool recordCrash(const string& appId);
+                bool schedule(const string& appId, const RespawnHandler& handler, uint32_t& delayMs);
+                void cancel(const string& appId);
+                bool isCircuitOpen(const string& appId);
+                uint32_t getCrashCount(const string& appId);
+                size_t getScheduledCount();
+
+            private: /* methods */
+                uint32_t pruneCrashesLocked(const string& appId, std::chrono::steady_clock::time_point now);
+                void run();
+
+            private: /* members */
+                typedef std::multimap<std::chrono::steady_clock::time_point, string> DueList;
+                struct ScheduledRespawn
+                {
+                    DueList::iterator mDue;
+                    RespawnHandler mHandler;
+                };
+
+                std::mutex mLock;
+                std::condition_variable mCondition;
+                std::thread mThread;
+                bool mRunning;
+                bool mTerminated;
+                uint32_t mInitialBackoffMs;
+                uint32_t mMaxBackoffMs;
+                uint32_t mCrashWindowMs;
+                uint32_t mCrashLimit;
+                std::unordered_map<string, std::deque<std::chrono::steady_clock::time_point>> mCrashes;
+                DueList mDue;
+                std::unordered_map<string, ScheduledRespawn> mScheduled;
+        };
+    } /* namespace Plugin */
+} /* namespace WPEFramework */
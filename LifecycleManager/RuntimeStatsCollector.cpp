@@ -0,0 +1,192 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#include "RuntimeStatsCollector.h"
+#include <system_error>
+#include "UtilsLogging.h"
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        RuntimeStatsCollector::RuntimeStatsCollector(): mCacheTtlMs(DEFAULT_RUNTIME_STATS_CACHE_TTL_MS), mCacheLock(), mCache(),
+                                                         mBatchLock(), mFetcherLock(), mFetcherCondition(), mBatchDoneCondition(),
+                                                         mFetcherThreads(), mBatch(), mBatchGeneration(0), mFinishedFetchers(0), mStopping(false)
+        {
+        }
+
+        RuntimeStatsCollector::~RuntimeStatsCollector()
+        {
+            {
+                std::lock_guard<std::mutex> lock(mFetcherLock);
+                mStopping = true;
+            }
+            mFetcherCondition.notify_all();
+            for (auto& fetcherThread : mFetcherThreads)
+            {
+                fetcherThread.join();
+            }
+        }
+
+        void RuntimeStatsCollector::startFetchers()
+        {
+            // The calling thread takes part in every batch, so one thread less is started
+            while ((mFetcherThreads.size() + 1) < MAX_RUNTIME_STATS_FETCHERS)
+            {
+                try
+                {
+                    mFetcherThreads.push_back(std::thread(&RuntimeStatsCollector::runFetcher, this));
+                }
+                catch (const std::system_error& ex)
+                {
+                    LOGWARN("Unable to start runtime stats fetcher: %s", ex.what());
+                    break;
+                }
+            }
+        }
+
+        void RuntimeStatsCollector::runFetcher()
+        {
+            uint64_t generation = 0;
+            std::unique_lock<std::mutex> lock(mFetcherLock);
+            while (true)
+            {
+                mFetcherCondition.wait(lock, [&]() { return mStopping || (generation != mBatchGeneration); });
+                if (true == mStopping)
+                {
+                    break;
+                }
+                generation = mBatchGeneration;
+                std::function<void()> batch = mBatch;
+                lock.unlock();
+                batch();
+                lock.lock();
+                mFinishedFetchers++;
+                mBatchDoneCondition.notify_all();
+            }
+        }
+
+        void RuntimeStatsCollector::setCacheTtl(uint32_t ttlMs)
+        {
+            mCacheTtlMs.store(ttlMs);
+            if (0 == ttlMs)
+            {
+                clear();
+            }
+        }
+
+        uint32_t RuntimeStatsCollector::getCacheTtl() const
+        {
+            return mCacheTtlMs.load();
+        }
+
+        void RuntimeStatsCollector::collect(const std::vector<string>& appInstanceIds, const Fetcher& fetcher, std::vector<RuntimeStats>& stats)
+        {
+            stats.assign(appInstanceIds.size(), RuntimeStats());
+            const uint32_t ttlMs = mCacheTtlMs.load();
+            const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+            std::vector<size_t> pending;
+            {
+                std::lock_guard<std::mutex> lock(mCacheLock);
+                for (size_t index = 0; index < appInstanceIds.size(); index++)
+                {
+                    auto iter = mCache.find(appInstanceIds[index]);
+                    if ((0 != ttlMs) && (iter != mCache.end()) && (now < iter->second.mExpiry))
+                    {
+                        stats[index].mAvailable = true;
+                        stats[index].mStats = iter->second.mStats;
+                    }
+                    else
+                    {
+                        pending.push_back(index);
+                    }
+                }
+            }
+
+            if (pending.empty())
+            {
+                return;
+            }
+
+            std::atomic<size_t> nextPending{0};
+            auto fetchPending = [&]() {
+                size_t position = 0;
+                while ((position = nextPending.fetch_add(1)) < pending.size())
+                {
+                    RuntimeStats& entry = stats[pending[position]];
+                    entry.mAvailable = fetcher(appInstanceIds[pending[position]], entry.mStats);
+                }
+            };
+
+            // The fetchers only help when there is more than one app and no other poll is using them
+            std::unique_lock<std::mutex> batchLock(mBatchLock, std::defer_lock);
+            if ((1 < pending.size()) && (true == batchLock.try_lock()))
+            {
+                startFetchers();
+                size_t fetcherCount = 0;
+                {
+                    std::lock_guard<std::mutex> lock(mFetcherLock);
+                    fetcherCount = mFetcherThreads.size();
+                    mBatch = fetchPending;
+                    mFinishedFetchers = 0;
+                    mBatchGeneration++;
+                }
+                mFetcherCondition.notify_all();
+                fetchPending();
+                // fetchPending refers to this frame, every fetcher must be done with it before returning
+                std::unique_lock<std::mutex> lock(mFetcherLock);
+                mBatchDoneCondition.wait(lock, [&]() { return mFinishedFetchers == fetcherCount; });
+                mBatch = nullptr;
+            }
+            else
+            {
+                fetchPending();
+            }
+
+            if (0 == ttlMs)
+            {
+                return;
+            }
+            const std::chrono::steady_clock::time_point expiry = std::chrono::steady_clock::now() + std::chrono::milliseconds(ttlMs);
+            std::lock_guard<std::mutex> lock(mCacheLock);
+            for (size_t index : pending)
+            {
+                if (true == stats[index].mAvailable)
+                {
+                    CacheEntry& entry = mCache[appInstanceIds[index]];
+                    entry.mStats = stats[index].mStats;
+                    entry.mExpiry = expiry;
+                }
+            }
+        }
+
+        void RuntimeStatsCollector::invalidate(const string& appInstanceId)
+        {
+            std::lock_guard<std::mutex> lock(mCacheLock);
+            mCache.erase(appInstanceId);
+        }
+
+        void RuntimeStatsCollector::clear()
+        {
+            std::lock_guard<std::mutex> lock(mCacheLock);
+            mCache.clear();
+        }
+    } /* namespace Plugin */
+} /* namespace WPEFramework */
@@ -0,0 +1,97 @@
+/**
+* If not stated otherwise in this file or this component's LICENSE
+* file the following copyright and licenses apply:
+*
+* Copyright 2024 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+**/
+
+#pragma once
+
+#include <interfaces/ILifecycleManager.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#define DEFAULT_RUNTIME_STATS_CACHE_TTL_MS 500
+#define MAX_RUNTIME_STATS_FETCHERS 4
+
+namespace WPEFramework
+{
+    namespace Plugin
+    {
+        struct RuntimeStats
+        {
+            RuntimeStats(): mAvailable(false), mStats() {}
+            bool mAvailable;
+            string mStats;
+        };
+
+        /*
+         * Collects runtime statistics of several apps in parallel and keeps the result of
+         * each appInstanceId for a short time, so repeated verbose GetLoadedApps polls do
+         * not go to RuntimeManager every time. A TTL of 0 disables the cache.
+         * Fetches run on the calling thread and a fixed set of fetcher threads that are
+         * started on first use and kept until the collector is destroyed.
+         */
+        class RuntimeStatsCollector
+        {
+            public:
+                typedef std::function<bool(const string& appInstanceId, string& stats)> Fetcher;
+
+                RuntimeStatsCollector();
+                ~RuntimeStatsCollector();
+                RuntimeStatsCollector(const RuntimeStatsCollector&) = delete;
+                RuntimeStatsCollector& operator=(const RuntimeStatsCollector&) = delete;
+
+                void setCacheTtl(uint32_t ttlMs);
+                uint32_t getCacheTtl() const;
+                void collect(const std::vector<string>& appInstanceIds, const Fetcher& fetcher, std::vector<RuntimeStats>& stats);
+                void invalidate(const string& appInstanceId);
+                void clear();
+
+            private: /* methods */
+                void startFetchers();
+                void runFetcher();
+
+            private: /* members */
+                struct CacheEntry
+                {
+                    string mStats;
+                    std::chrono::steady_clock::time_point mExpiry;
+                };
+
+                std::atomic<uint32_t> mCacheTtlMs;
+                std::mutex mCacheLock;
+                std::unordered_map<string, CacheEntry> mCache;
+
+                // Serialises batches, a poll that finds the fetchers busy fetches on its own thread
+                std::mutex mBatchLock;
+                std::mutex mFetcherLock;
+                std::condition_variable mFetcherCondition;
+                std::condition_variable mBatchDoneCondition;
+                std::vector<std::thread> mFetcherThreads;
+                std::function<void()> mBatch;
+                uint64_t mBatchGeneration;
+                size_t mFinishedFetchers;
+                bool mStopping;
+        };
+    } /* namespace Plugin */
+} /* namespace WPEFramework */
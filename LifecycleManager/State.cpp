@@ -21,37 +21,67 @@
 #include <interfaces/IRDKWindowManager.h>
 #include "RuntimeManagerHandler.h"
 #include "RequestHandler.h"
-#include <boost/uuid/uuid.hpp>
-#include <boost/uuid/uuid_generators.hpp>
-#include <boost/uuid/uuid_io.hpp>
 
 namespace WPEFramework
 {
     namespace Plugin
     {
-        bool UnloadedState::handle(string& errorReason)
+        namespace {
+            UnloadedState sUnloadedState;
+            LoadingState sLoadingState;
+            InitializingState sInitializingState;
+            PausedState sPausedState;
+            ActiveState sActiveState;
+            SuspendedState sSuspendedState;
+            HibernatedState sHibernatedState;
+            TerminatingState sTerminatingState;
+
+            // Indexed by LifecycleState value
+            State* const sStates[] = {
+                &sUnloadedState,
+                &sLoadingState,
+                &sInitializingState,
+                &sPausedState,
+                &sActiveState,
+                &sSuspendedState,
+                &sHibernatedState,
+                &sTerminatingState
+            };
+        }
+
+        State* State::getInstance(Exchange::ILifecycleManager::LifecycleState state)
+        {
+            size_t index = static_cast<size_t>(state);
+            if (index >= (sizeof(sStates) / sizeof(sStates[0])))
+            {
+                return nullptr;
+            }
+            return sStates[index];
+        }
+
+        bool UnloadedState::handle(ApplicationContext* context, string& errorReason)
 	{
             return true;
 	}
 
-        bool LoadingState::handle(string& errorReason)
+        bool LoadingState::handle(ApplicationContext* context, string& errorReason)
 	{
-            ApplicationContext* context = getContext();
-
-            boost::uuids::uuid tag = boost::uuids::random_generator()();
-            std::string generatedInstanceId =  boost::uuids::to_string(tag);
-            context->setAppInstanceId(generatedInstanceId);
+            // appInstanceId is normally generated by SpawnApp on the caller thread
+            if (context->getAppInstanceId().empty())
+            {
+                std::string generatedInstanceId = ApplicationContext::generateAppInstanceId();
+                context->setAppInstanceId(generatedInstanceId);
+            }
             sem_post(&context->mReachedLoadingStateSemaphore);
             return true;
 	}
 
-        bool InitializingState::handle(string& errorReason)
+        bool InitializingState::handle(ApplicationContext* context, string& errorReason)
         {
             RuntimeManagerHandler* runtimeManagerHandler = RequestHandler::getInstance()->getRuntimeManagerHandler();
             bool ret = false;
 	    if (nullptr != runtimeManagerHandler)
 	    {
-                ApplicationContext* context = getContext();
                 ApplicationLaunchParams& launchParams = context->getApplicationLaunchParams();
                 ret = runtimeManagerHandler->run(context->getAppId(), context->getAppInstanceId(), launchParams.mLaunchArgs, launchParams.mTargetState, launchParams.mRuntimeConfigObject, errorReason);
                 if (ret)
@@ -63,10 +93,9 @@ namespace WPEFramework
             return ret;
         }
 
-        bool PausedState::handle(string& errorReason)
+        bool PausedState::handle(ApplicationContext* context, string& errorReason)
 	{
 	    bool ret = false;
-            ApplicationContext* context = getContext();
             if (Exchange::ILifecycleManager::LifecycleState::INITIALIZING == context->getCurrentLifecycleState(
 ))
             {
@@ -81,7 +110,6 @@ namespace WPEFramework
                     WindowManagerHandler *windowManagerHandler = RequestHandler::getInstance()->getWindowManagerHandler();
                     if (nullptr != windowManagerHandler)
                     {
-                        ApplicationContext *context = getContext();
                         Core::hresult retValue = windowManagerHandler->enableDisplayRender(context->getAppInstanceId(), true);
                         printf("enabled display in window manager [%d] \n", retValue);
                         fflush(stdout);
@@ -97,12 +125,11 @@ namespace WPEFramework
             return ret;
 	}
 
-        bool ActiveState::handle(string& errorReason)
+        bool ActiveState::handle(ApplicationContext* context, string& errorReason)
 	{
             WindowManagerHandler* windowManagerHandler = RequestHandler::getInstance()->getWindowManagerHandler();
 	    if (nullptr != windowManagerHandler)
 	    {
-                ApplicationContext* context = getContext();
                 bool isRenderReady = false;
 		Core::hresult ret = windowManagerHandler->renderReady(context->getAppInstanceId(), isRenderReady);
                 if (Core::ERROR_NONE == ret)
@@ -125,15 +152,13 @@ namespace WPEFramework
             return true;
 	}
 
-        bool SuspendedState::handle(string& errorReason)
+        bool SuspendedState::handle(ApplicationContext* context, string& errorReason)
 	{
 	    bool ret = false;
             //TODO : Remove wait for now
-            //ApplicationContext* context = getContext();
             RuntimeManagerHandler* runtimeManagerHandler = RequestHandler::getInstance()->getRuntimeManagerHandler();
 	    if (nullptr != runtimeManagerHandler)
 	    {
-                ApplicationContext* context = getContext();
                 if (Exchange::ILifecycleManager::LifecycleState::HIBERNATED == context->getCurrentLifecycleState())
 	        {
                     ret = runtimeManagerHandler->wake(context->getAppInstanceId(), Exchange::ILifecycleManager::LifecycleState::SUSPENDED, errorReason);
@@ -144,7 +169,6 @@ namespace WPEFramework
                     WindowManagerHandler *windowManagerHandler = RequestHandler::getInstance()->getWindowManagerHandler();
                     if (nullptr != windowManagerHandler)
                     {
-                        ApplicationContext *context = getContext();
                         Core::hresult retValue = windowManagerHandler->enableDisplayRender(context->getAppInstanceId(), false);
                         printf("disabled display in window manager [%d] \n", retValue);
                         fflush(stdout);
@@ -156,38 +180,35 @@ namespace WPEFramework
             return ret;
 	}
 
-        bool HibernatedState::handle(string& errorReason)
+        bool HibernatedState::handle(ApplicationContext* context, string& errorReason)
 	{
             bool ret = false;
             RuntimeManagerHandler* runtimeManagerHandler = RequestHandler::getInstance()->getRuntimeManagerHandler();
 	    if (nullptr != runtimeManagerHandler)
 	    {
-                ApplicationContext* context = getContext();
                 ret = runtimeManagerHandler->hibernate(context->getAppInstanceId(), errorReason);
 	    }
             return ret;
 	}
 /*
-        bool WakeRequestedState::handle(string& errorReason)
+        bool WakeRequestedState::handle(ApplicationContext* context, string& errorReason)
         {
             bool ret = false;
             RuntimeManagerHandler* runtimeManagerHandler = RequestHandler::getInstance()->getRuntimeManagerHandler();
             if (nullptr != runtimeManagerHandler)
             {
-                ApplicationContext* context = getContext();
                 ret = runtimeManagerHandler->wake(context->getAppInstanceId(), context->getTargetLifecycleState(), errorReason);
             }
             return ret;
         }
 */
 
-        bool TerminatingState::handle(string& errorReason)
+        bool TerminatingState::handle(ApplicationContext* context, string& errorReason)
         {
             bool success = false;
             RuntimeManagerHandler* runtimeManagerHandler = RequestHandler::getInstance()->getRuntimeManagerHandler();
             if (nullptr != runtimeManagerHandler)
             {
-                ApplicationContext* context = getContext();
                 if (true == context->getTerminated())
                 {
                     printf("Already terminated application. ignore terminate call \n");
@@ -22,100 +22,100 @@
 #include <interfaces/ILifecycleManager.h>
 #include <map>
 
-//class ApplicationContext;
-
 namespace WPEFramework
 {
     namespace Plugin
     {
+        class ApplicationContext;
+
+        /*
+         * State handlers are stateless flyweights: one instance exists per lifecycle state
+         * and the application context is passed to handle(). Use getInstance() to get them.
+         */
         class State
 	{
             public:
-	        State(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState state): mState(state), mContext(context) {}
+	        constexpr State(Exchange::ILifecycleManager::LifecycleState state): mState(state) {}
                 virtual ~State() {}
 
-                virtual bool handle(string& errorReason)
+                static State* getInstance(Exchange::ILifecycleManager::LifecycleState state);
+
+                virtual bool handle(ApplicationContext* context, string& errorReason)
 		{
                     return true;
 		}
 
-                virtual Exchange::ILifecycleManager::LifecycleState getValue()
+                Exchange::ILifecycleManager::LifecycleState getValue() const
 		{
                     return mState;
 		}
 
-                virtual ApplicationContext* getContext()
-		{
-                    return mContext;
-		}
-
 	    private: /* members */
-                Exchange::ILifecycleManager::LifecycleState mState; 
-                ApplicationContext* mContext;
+                const Exchange::ILifecycleManager::LifecycleState mState; 
         };
 
         class UnloadedState : public State
 	{
             public:
-                UnloadedState(ApplicationContext* context): State(context, Exchange::ILifecycleManager::LifecycleState::UNLOADED) {}
+                constexpr UnloadedState(): State(Exchange::ILifecycleManager::LifecycleState::UNLOADED) {}
                 ~UnloadedState() {}
-                bool handle(string& errorReason);
+                bool handle(ApplicationContext* context, string& errorReason);
         };
 
         class LoadingState : public State
 	{
             public:
-                LoadingState(ApplicationContext* context): State(context, Exchange::ILifecycleManager::LifecycleState::LOADING) {}
+                constexpr LoadingState(): State(Exchange::ILifecycleManager::LifecycleState::LOADING) {}
                 ~LoadingState() {}
-                bool handle(string& errorReason);
+                bool handle(ApplicationContext* context, string& errorReason);
         };
 
         class InitializingState : public State
 	{
             public:
-                InitializingState(ApplicationContext* context): State(context, Exchange::ILifecycleManager::LifecycleState::INITIALIZING) {}
+                constexpr InitializingState(): State(Exchange::ILifecycleManager::LifecycleState::INITIALIZING) {}
                 ~InitializingState() {}
-                bool handle(string& errorReason);
+                bool handle(ApplicationContext* context, string& errorReason);
         };
 
         class PausedState : public State
 	{
             public:
-                PausedState(ApplicationContext* context): State(context, Exchange::ILifecycleManager::LifecycleState::PAUSED) {}
+                constexpr PausedState(): State(Exchange::ILifecycleManager::LifecycleState::PAUSED) {}
                 ~PausedState() {}
-                bool handle(string& errorReason);
+                bool handle(ApplicationContext* context, string& errorReason);
         };
 
         class ActiveState : public State
 	{
             public:
-                ActiveState(ApplicationContext* context): State(context, Exchange::ILifecycleManager::LifecycleState::ACTIVE) {}
+                constexpr ActiveState(): State(Exchange::ILifecycleManager::LifecycleState::ACTIVE) {}
                 ~ActiveState() {}
-                bool handle(string& errorReason);
+                bool handle(ApplicationContext* context, string& errorReason);
         };
 
         class SuspendedState : public State
 	{
             public:
-                SuspendedState(ApplicationContext* context): State(context, Exchange::ILifecycleManager::LifecycleState::SUSPENDED) {}
+                constexpr SuspendedState(): State(Exchange::ILifecycleManager::LifecycleState::SUSPENDED) {}
                 ~SuspendedState() {}
-                bool handle(string& errorReason);
+                bool handle(ApplicationContext* context, string& errorReason);
         };
 
         class HibernatedState : public State
 	{
             public:
-                HibernatedState(ApplicationContext* context): State(context, Exchange::ILifecycleManager::LifecycleState::HIBERNATED) {}
+                constexpr HibernatedState(): State(Exchange::ILifecycleManager::LifecycleState::HIBERNATED) {}
                 ~HibernatedState() {}
-                bool handle(string& errorReason);
+                bool handle(ApplicationContext* context, string& errorReason);
         };
 
         class TerminatingState : public State
 	{
             public:
-                TerminatingState(ApplicationContext* context): State(context, Exchange::ILifecycleManager::LifecycleState::TERMINATING) {}
+                constexpr TerminatingState(): State(Exchange::ILifecycleManager::LifecycleState::TERMINATING) {}
                 ~TerminatingState() {}
-                bool handle(string& errorReason);
+                bool handle(ApplicationContext* context, string& errorReason);
         };
     } /* namespace Plugin */
 } /* namespace WPEFramework */
@@ -23,6 +23,8 @@
 #include <boost/uuid/uuid_io.hpp>
 #include "IEventHandler.h"
 #include "RequestHandler.h"
+#include "LifecycleManagerTelemetryReporting.h"
+#include "PendingEventTimer.h"
 #include "UtilsLogging.h"
 
 namespace WPEFramework
@@ -30,9 +32,120 @@ namespace WPEFramework
     namespace Plugin
     {
         typedef Exchange::ILifecycleManager::LifecycleState Lifecycle;
-        std::map<Exchange::ILifecycleManager::LifecycleState, std::list<Exchange::ILifecycleManager::LifecycleState>> StateHandler::mPossibleStateTransitions = std::map<Exchange::ILifecycleManager::LifecycleState, std::list<Exchange::ILifecycleManager::LifecycleState>>();
-        std::map<Exchange::ILifecycleManager::LifecycleState, std::string> StateHandler::mStateStrings = std::map<Exchange::ILifecycleManager::LifecycleState, std::string>();
-        uint32_t StateHandler::sStateChangeCount = 0;
+        std::atomic<uint32_t> StateHandler::sStateChangeCount{0};
+
+        namespace {
+            /*
+             * Paths between every pair of lifecycle states, indexed by [start][target].
+             * Each path starts with the current state and ends with the target state; it is
+             * the sequence the app has always been taken through, preferring PAUSED as the
+             * step before TERMINATING. Paths to TERMINATING carry the UNLOADED step that
+             * follows it just past mLength, so a terminate request walks mLength + 1 states.
+             */
+            constexpr StatePath sStatePaths[LIFECYCLE_STATE_COUNT][LIFECYCLE_STATE_COUNT] = {
+                // from UNLOADED
+                {
+                    { 1, { Lifecycle::UNLOADED } },
+                    { 2, { Lifecycle::UNLOADED, Lifecycle::LOADING } },
+                    { 3, { Lifecycle::UNLOADED, Lifecycle::LOADING, Lifecycle::INITIALIZING } },
+                    { 4, { Lifecycle::UNLOADED, Lifecycle::LOADING, Lifecycle::INITIALIZING, Lifecycle::PAUSED } },
+                    { 5, { Lifecycle::UNLOADED, Lifecycle::LOADING, Lifecycle::INITIALIZING, Lifecycle::PAUSED, Lifecycle::ACTIVE } },
+                    { 4, { Lifecycle::UNLOADED, Lifecycle::LOADING, Lifecycle::INITIALIZING, Lifecycle::SUSPENDED } },
+                    { 5, { Lifecycle::UNLOADED, Lifecycle::LOADING, Lifecycle::INITIALIZING, Lifecycle::SUSPENDED, Lifecycle::HIBERNATED } },
+                    { 5, { Lifecycle::UNLOADED, Lifecycle::LOADING, Lifecycle::INITIALIZING, Lifecycle::PAUSED, Lifecycle::TERMINATING, Lifecycle::UNLOADED } }
+                },
+                // from LOADING
+                {
+                    { 0, { } },
+                    { 1, { Lifecycle::LOADING } },
+                    { 2, { Lifecycle::LOADING, Lifecycle::INITIALIZING } },
+                    { 3, { Lifecycle::LOADING, Lifecycle::INITIALIZING, Lifecycle::PAUSED } },
+                    { 4, { Lifecycle::LOADING, Lifecycle::INITIALIZING, Lifecycle::PAUSED, Lifecycle::ACTIVE } },
+                    { 3, { Lifecycle::LOADING, Lifecycle::INITIALIZING, Lifecycle::SUSPENDED } },
+                    { 4, { Lifecycle::LOADING, Lifecycle::INITIALIZING, Lifecycle::SUSPENDED, Lifecycle::HIBERNATED } },
+                    { 4, { Lifecycle::LOADING, Lifecycle::INITIALIZING, Lifecycle::PAUSED, Lifecycle::TERMINATING, Lifecycle::UNLOADED } }
+                },
+                // from INITIALIZING
+                {
+                    { 0, { } },
+                    { 0, { } },
+                    { 1, { Lifecycle::INITIALIZING } },
+                    { 2, { Lifecycle::INITIALIZING, Lifecycle::PAUSED } },
+                    { 3, { Lifecycle::INITIALIZING, Lifecycle::PAUSED, Lifecycle::ACTIVE } },
+                    { 2, { Lifecycle::INITIALIZING, Lifecycle::SUSPENDED } },
+                    { 3, { Lifecycle::INITIALIZING, Lifecycle::SUSPENDED, Lifecycle::HIBERNATED } },
+                    { 3, { Lifecycle::INITIALIZING, Lifecycle::PAUSED, Lifecycle::TERMINATING, Lifecycle::UNLOADED } }
+                },
+                // from PAUSED
+                {
+                    { 0, { } },
+                    { 0, { } },
+                    { 0, { } },
+                    { 1, { Lifecycle::PAUSED } },
+                    { 2, { Lifecycle::PAUSED, Lifecycle::ACTIVE } },
+                    { 2, { Lifecycle::PAUSED, Lifecycle::SUSPENDED } },
+                    { 3, { Lifecycle::PAUSED, Lifecycle::SUSPENDED, Lifecycle::HIBERNATED } },
+                    { 2, { Lifecycle::PAUSED, Lifecycle::TERMINATING, Lifecycle::UNLOADED } }
+                },
+                // from ACTIVE
+                {
+                    { 0, { } },
+                    { 0, { } },
+                    { 0, { } },
+                    { 2, { Lifecycle::ACTIVE, Lifecycle::PAUSED } },
+                    { 1, { Lifecycle::ACTIVE } },
+                    { 3, { Lifecycle::ACTIVE, Lifecycle::PAUSED, Lifecycle::SUSPENDED } },
+                    { 4, { Lifecycle::ACTIVE, Lifecycle::PAUSED, Lifecycle::SUSPENDED, Lifecycle::HIBERNATED } },
+                    { 3, { Lifecycle::ACTIVE, Lifecycle::PAUSED, Lifecycle::TERMINATING, Lifecycle::UNLOADED } }
+                },
+                // from SUSPENDED
+                {
+                    { 0, { } },
+                    { 0, { } },
+                    { 0, { } },
+                    { 2, { Lifecycle::SUSPENDED, Lifecycle::PAUSED } },
+                    { 3, { Lifecycle::SUSPENDED, Lifecycle::PAUSED, Lifecycle::ACTIVE } },
+                    { 1, { Lifecycle::SUSPENDED } },
+                    { 2, { Lifecycle::SUSPENDED, Lifecycle::HIBERNATED } },
+                    { 3, { Lifecycle::SUSPENDED, Lifecycle::PAUSED, Lifecycle::TERMINATING, Lifecycle::UNLOADED } }
+                },
+                // from HIBERNATED
+                {
+                    { 0, { } },
+                    { 0, { } },
+                    { 0, { } },
+                    { 3, { Lifecycle::HIBERNATED, Lifecycle::SUSPENDED, Lifecycle::PAUSED } },
+                    { 4, { Lifecycle::HIBERNATED, Lifecycle::SUSPENDED, Lifecycle::PAUSED, Lifecycle::ACTIVE } },
+                    { 2, { Lifecycle::HIBERNATED, Lifecycle::SUSPENDED } },
+                    { 1, { Lifecycle::HIBERNATED } },
+                    { 4, { Lifecycle::HIBERNATED, Lifecycle::SUSPENDED, Lifecycle::PAUSED, Lifecycle::TERMINATING, Lifecycle::UNLOADED } }
+                },
+                // from TERMINATING
+                {
+                    { 0, { } },
+                    { 0, { } },
+                    { 0, { } },
+                    { 0, { } },
+                    { 0, { } },
+                    { 0, { } },
+                    { 0, { } },
+                    { 1, { Lifecycle::TERMINATING, Lifecycle::UNLOADED } }
+                }
+            };
+
+            constexpr Lifecycle sLoadingToUnloadedPath[] = { Lifecycle::LOADING, Lifecycle::UNLOADED };
+
+            constexpr const char* sStateStrings[LIFECYCLE_STATE_COUNT] = {
+                "Unloaded",
+                "Loading",
+                "Initializing",
+                "Paused",
+                "Active",
+                "Suspended",
+                "Hibernated",
+                "Terminating"
+            };
+        }
 
         bool StateHandler::updateState(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState lifeCycleState, string& errorReason)
 	{
@@ -42,128 +155,39 @@ namespace WPEFramework
 	    {
 	        return true;	   
 	    }
-            State* newState = createState(context, lifeCycleState);
+            State* newState = State::getInstance(lifeCycleState);
             if (nullptr != newState)
 	    {
-	        //context->setState(nullptr);
-                result = newState->handle(errorReason);
+                result = newState->handle(context, errorReason);
                 if (result)
 		{
 	           context->setState(newState);
-		   delete currentState;
                 }
-                else
-		{
-		    delete newState;
-		}
             }
             return result;
 	}
 
-	State* StateHandler::createState(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState lifeCycleState)
-	{
-            State* state = nullptr;
-            switch (lifeCycleState)
-            {
-	        case Exchange::ILifecycleManager::LifecycleState::UNLOADED:
-                    state = new UnloadedState(context);
-                    break;
-	        case Exchange::ILifecycleManager::LifecycleState::LOADING:
-                    state = new LoadingState(context);
-                    break;
-	        case Exchange::ILifecycleManager::LifecycleState::INITIALIZING:
-                    state = new InitializingState(context);
-                    break;
-	        case Exchange::ILifecycleManager::LifecycleState::PAUSED:
-                    state = new PausedState(context);
-                    break;
-	        case Exchange::ILifecycleManager::LifecycleState::ACTIVE:
-                    state = new ActiveState(context);
-                    break;
-	        case Exchange::ILifecycleManager::LifecycleState::SUSPENDED:
-                    state = new SuspendedState(context);
-                    break;
-	        case Exchange::ILifecycleManager::LifecycleState::HIBERNATED:
-                    state = new HibernatedState(context);
-                    break;
-    	        case Exchange::ILifecycleManager::LifecycleState::TERMINATING:
-                    state = new TerminatingState(context);
-                    break;
-                default:
-		    state = nullptr;	
-            }
-            return state;
-	}
-
-        bool StateHandler::isValidTransition(Exchange::ILifecycleManager::LifecycleState start, Exchange::ILifecycleManager::LifecycleState target, std::map<Exchange::ILifecycleManager::LifecycleState, bool>& pathSequence, std::vector<Exchange::ILifecycleManager::LifecycleState>& foundPath)
+        const StatePath* StateHandler::getTransitionPath(Exchange::ILifecycleManager::LifecycleState start, Exchange::ILifecycleManager::LifecycleState target)
         {
-            bool pathPresent = false;
-            if (start == target)
+            size_t startIndex = static_cast<size_t>(start);
+            size_t targetIndex = static_cast<size_t>(target);
+            if ((LIFECYCLE_STATE_COUNT <= startIndex) || (LIFECYCLE_STATE_COUNT <= targetIndex))
             {
-                return true;
+                return nullptr;
             }
-            pathSequence[target] = true; 
-            std::map<Exchange::ILifecycleManager::LifecycleState, std::list<Exchange::ILifecycleManager::LifecycleState>>::iterator transitionIter = mPossibleStateTransitions.find(target);
-            if (transitionIter == mPossibleStateTransitions.end())
-            {
-                return false;
-            }
-            std::list<Exchange::ILifecycleManager::LifecycleState>& transitionList = transitionIter->second;
-            for (auto iter = transitionList.begin(); iter != transitionList.end(); ++iter)
-            {
-                if (pathSequence.find(*iter) != pathSequence.end())
-                {
-                    continue;
-                }
+            const StatePath* path = &sStatePaths[startIndex][targetIndex];
+            return (0 == path->mLength) ? nullptr : path;
+        }
 
-                pathPresent = isValidTransition(start, *iter, pathSequence, foundPath);
-                if (pathPresent)
-                {
-	            foundPath.push_back(*iter);		
-                    break;
-                }
-            }
-            return pathPresent;
+        const char* StateHandler::getStateString(Exchange::ILifecycleManager::LifecycleState lifecycleState)
+        {
+            size_t index = static_cast<size_t>(lifecycleState);
+            return (LIFECYCLE_STATE_COUNT > index) ? sStateStrings[index] : "Unknown";
         }
 
 	void StateHandler::initialize()
 	{
-            mPossibleStateTransitions[Lifecycle::UNLOADED] = std::list<Exchange::ILifecycleManager::LifecycleState>();
-            mPossibleStateTransitions[Lifecycle::LOADING] = std::list<Exchange::ILifecycleManager::LifecycleState>(1, Lifecycle::UNLOADED);
-            mPossibleStateTransitions[Lifecycle::INITIALIZING] = std::list<Exchange::ILifecycleManager::LifecycleState>(1, Lifecycle::LOADING); 
-
-            mPossibleStateTransitions[Lifecycle::PAUSED] = std::list<Exchange::ILifecycleManager::LifecycleState>();
-	    std::list<Exchange::ILifecycleManager::LifecycleState>& pausedStatePre = mPossibleStateTransitions[Lifecycle::PAUSED];
-	    pausedStatePre.push_back(Lifecycle::INITIALIZING);
-	    pausedStatePre.push_back(Lifecycle::ACTIVE);
-	    pausedStatePre.push_back(Lifecycle::SUSPENDED);
-          
-            mPossibleStateTransitions[Lifecycle::ACTIVE] = std::list<Exchange::ILifecycleManager::LifecycleState>();
-	    std::list<Exchange::ILifecycleManager::LifecycleState>& activeStatePre = mPossibleStateTransitions[Lifecycle::ACTIVE];
-            activeStatePre.push_back(Lifecycle::PAUSED);
-
-            mPossibleStateTransitions[Lifecycle::SUSPENDED] = std::list<Exchange::ILifecycleManager::LifecycleState>();
-	    std::list<Exchange::ILifecycleManager::LifecycleState>& suspendedStatePre = mPossibleStateTransitions[Lifecycle::SUSPENDED];
-            suspendedStatePre.push_back(Lifecycle::INITIALIZING);
-            suspendedStatePre.push_back(Lifecycle::PAUSED);
-            suspendedStatePre.push_back(Lifecycle::HIBERNATED);
-
-            mPossibleStateTransitions[Lifecycle::HIBERNATED] = std::list<Exchange::ILifecycleManager::LifecycleState>(1, Lifecycle::SUSPENDED);    
-
-            mPossibleStateTransitions[Lifecycle::TERMINATING] = std::list<Exchange::ILifecycleManager::LifecycleState>();
-	    std::list<Exchange::ILifecycleManager::LifecycleState>& terminatingStatePre = mPossibleStateTransitions[Lifecycle::TERMINATING];
-            terminatingStatePre.push_back(Lifecycle::PAUSED);
-            terminatingStatePre.push_back(Lifecycle::SUSPENDED);
-
-	    //state strings
-            mStateStrings[Lifecycle::UNLOADED] = "Unloaded";
-            mStateStrings[Lifecycle::LOADING] = "Loading";
-            mStateStrings[Lifecycle::INITIALIZING] = "Initializing"; 
-            mStateStrings[Lifecycle::PAUSED] = "Paused";
-            mStateStrings[Lifecycle::ACTIVE] = "Active"; 
-            mStateStrings[Lifecycle::SUSPENDED] = "Suspended";
-            mStateStrings[Lifecycle::HIBERNATED] = "Hibernated";
-            mStateStrings[Lifecycle::TERMINATING] = "Terminating";
+            // Transition paths and state handlers are static, nothing to build at runtime
 	}
 
         bool StateHandler::changeState(StateTransitionRequest& request, string& errorReason)
@@ -189,8 +213,12 @@ namespace WPEFramework
 	        return true;
 	    }
 
-            std::vector<Exchange::ILifecycleManager::LifecycleState> statePath;
-            bool result = getStatePath(context, lifecycleState, statePath, errorReason);
+            // Table paths are walked in place; a pending path is moved out of the context
+            // so the walk can park again and record a new one
+            std::vector<Exchange::ILifecycleManager::LifecycleState> pendingStates;
+            const Exchange::ILifecycleManager::LifecycleState* statePath = nullptr;
+            size_t statePathLength = 0;
+            bool result = getStatePath(context, lifecycleState, pendingStates, statePath, statePathLength, errorReason);
             if (false == result)
             {
                 printf("Unable to get sequence for target state \n");
@@ -205,10 +233,11 @@ namespace WPEFramework
             context->mPendingStateTransition = false;
 
             // start from next state
-	    for (size_t stateIndex=1; stateIndex<statePath.size(); stateIndex++)
+	    for (size_t stateIndex=1; stateIndex<statePathLength; stateIndex++)
 	    {
                 Exchange::ILifecycleManager::LifecycleState oldLifecycleState = context->getState()->getValue();
                 isStateTerminating = (Exchange::ILifecycleManager::LifecycleState::TERMINATING == statePath[stateIndex]);
+                beginHop(context, oldLifecycleState, statePath[stateIndex]);
                 if (!isStateTerminating)
 		{
                     if ((Exchange::ILifecycleManager::LifecycleState::INITIALIZING == oldLifecycleState)
@@ -226,11 +255,11 @@ namespace WPEFramework
                     result = updateState(context, statePath[stateIndex], errorReason);
                     if(result)
                     {
-                        printf("StateHandler::changeState: Success %s -> %s\n", mStateStrings[oldLifecycleState].c_str(), mStateStrings[statePath[stateIndex]].c_str());
+                        printf("StateHandler::changeState: Success %s -> %s\n", getStateString(oldLifecycleState), getStateString(statePath[stateIndex]));
                     }
                     else
                     {
-                        LOGERR("StateHandler::changeState: Failed to change state from %s to %s\n", mStateStrings[oldLifecycleState].c_str(), mStateStrings[statePath[stateIndex]].c_str());
+                        LOGERR("StateHandler::changeState: Failed to change state from %s to %s\n", getStateString(oldLifecycleState), getStateString(statePath[stateIndex]));
                         sendEvent(context, oldLifecycleState, oldLifecycleState, errorReason);
                         break;
                     }
@@ -259,14 +288,20 @@ namespace WPEFramework
 
                 if (isStateTerminating)
                 {
+                    // The TERMINATING event goes out before the runtime is asked to stop, so the
+                    // terminate call and the onAppTerminating wait are timed on the next hop
+                    if ((stateIndex + 1) < statePathLength)
+                    {
+                        beginHop(context, statePath[stateIndex], statePath[stateIndex + 1]);
+                    }
                     result = updateState(context, statePath[stateIndex], errorReason);
                     if(result)
                     {
-                        printf("StateHandler::changeState:Terminating: Success %s -> %s\n", mStateStrings[oldLifecycleState].c_str(), mStateStrings[statePath[stateIndex]].c_str());
+                        printf("StateHandler::changeState:Terminating: Success %s -> %s\n", getStateString(oldLifecycleState), getStateString(statePath[stateIndex]));
                     }
                     else
                     {
-                        printf("StateHandler::changeState:Terminating: Failed to change state from %s to %s\n", mStateStrings[oldLifecycleState].c_str(), mStateStrings[statePath[stateIndex]].c_str());
+                        printf("StateHandler::changeState:Terminating: Failed to change state from %s to %s\n", getStateString(oldLifecycleState), getStateString(statePath[stateIndex]));
                         break;
                     }
                     if (true == context->mPendingStateTransition)
@@ -279,7 +314,7 @@ namespace WPEFramework
             if (true == context->mPendingStateTransition)
             {
                 context->mPendingStates.clear();
-                if (lastStateIndex < statePath.size())
+                if (lastStateIndex < statePathLength)
                 {
                     size_t pendingStartIndex = lastStateIndex;
                     // Preserve the current state only for the deferred onAppReady path
@@ -289,17 +324,16 @@ namespace WPEFramework
                         pendingStartIndex = pendingStartIndex - 1;
                     }
 
-                    for (size_t stateIndex = pendingStartIndex; stateIndex < statePath.size() ; stateIndex++)
-                    {
-                        context->mPendingStates.push_back(statePath[stateIndex]);
-                    }
+                    context->mPendingStates.assign(statePath + pendingStartIndex, statePath + statePathLength);
                 }
+                PendingEventTimer::getInstance()->schedule(context->getAppInstanceId(), context->mPendingEventName);
             }
             else 
 	    {
                 context->mPendingStateTransition = false;
                 context->mPendingEventName = "";
                 context->mPendingStates.clear();
+                PendingEventTimer::getInstance()->cancel(context->getAppInstanceId());
             }
 
             if (true == hasDeferredUnloadedEvent)
@@ -312,6 +346,7 @@ namespace WPEFramework
 
         void StateHandler::sendEvent(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState oldLifecycleState, Exchange::ILifecycleManager::LifecycleState newLifecycleState, string& errorReason)
 	{
+            endHop(context, oldLifecycleState, newLifecycleState);
             IEventHandler* eventHandler = RequestHandler::getInstance()->getEventHandler();
 
             if (nullptr != eventHandler)
@@ -319,8 +354,7 @@ namespace WPEFramework
                 struct timespec stateChangeTime;
                 timespec_get(&stateChangeTime, TIME_UTC);
                 context->setLastLifecycleStateChangeTime(stateChangeTime);
-                context->setStateChangeId(sStateChangeCount);
-                sStateChangeCount++;
+                context->setStateChangeId(sStateChangeCount.fetch_add(1));
 
                 JsonObject eventData;
                 eventData["appId"] = context->getAppId();
@@ -336,7 +370,36 @@ namespace WPEFramework
             }
         }
 
-        bool StateHandler::getStatePath(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState lifecycleState, std::vector<Exchange::ILifecycleManager::LifecycleState>& statePath, string& errorReason)
+        void StateHandler::beginHop(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState oldLifecycleState, Exchange::ILifecycleManager::LifecycleState newLifecycleState)
+        {
+            // A hop resumed after a pending event keeps its original start time
+            if (context->mHopInProgress && (context->mHopOldState == oldLifecycleState) && (context->mHopNewState == newLifecycleState))
+            {
+                return;
+            }
+            context->mHopInProgress = true;
+            context->mHopOldState = oldLifecycleState;
+            context->mHopNewState = newLifecycleState;
+            context->mHopStartTime = std::chrono::steady_clock::now();
+        }
+
+        void StateHandler::endHop(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState oldLifecycleState, Exchange::ILifecycleManager::LifecycleState newLifecycleState)
+        {
+            bool completed = context->mHopInProgress && (context->mHopOldState == oldLifecycleState) && (context->mHopNewState == newLifecycleState);
+            // Failed hops are reported as old -> old and are not timed
+            if (completed || (oldLifecycleState == newLifecycleState))
+            {
+                context->mHopInProgress = false;
+            }
+            if (completed)
+            {
+                uint64_t latencyMs = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - context->mHopStartTime).count();
+                static LifecycleManagerTelemetryReporting& telemetryReporting = LifecycleManagerTelemetryReporting::getInstance();
+                telemetryReporting.recordTransitionLatency(context->getAppId(), oldLifecycleState, newLifecycleState, latencyMs);
+            }
+        }
+
+        bool StateHandler::getStatePath(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState lifecycleState, std::vector<Exchange::ILifecycleManager::LifecycleState>& pendingStates, const Exchange::ILifecycleManager::LifecycleState*& statePath, size_t& statePathLength, string& errorReason)
         {
             if (false == context->mPendingStateTransition)
             {
@@ -344,30 +407,29 @@ namespace WPEFramework
                 if ((Exchange::ILifecycleManager::LifecycleState::LOADING == currentLifecycleState) && (Exchange::ILifecycleManager::LifecycleState::TERMINATING == lifecycleState))
                 {
                     LOGERR("Received unload request in loading stage");
-                    statePath.push_back(Exchange::ILifecycleManager::LifecycleState::LOADING);
-                    statePath.push_back(Exchange::ILifecycleManager::LifecycleState::UNLOADED);
+                    statePath = sLoadingToUnloadedPath;
+                    statePathLength = sizeof(sLoadingToUnloadedPath) / sizeof(sLoadingToUnloadedPath[0]);
                     return true;
                 }
 
-                std::map<Exchange::ILifecycleManager::LifecycleState, bool> seenPaths;
-
-                bool isValidRequest = StateHandler::isValidTransition(currentLifecycleState, lifecycleState, seenPaths, statePath);
-                if (!isValidRequest)
+                const StatePath* transitionPath = getTransitionPath(currentLifecycleState, lifecycleState);
+                if (nullptr == transitionPath)
                 {
                     errorReason = "Invalid launch request in current state";
                     return false;
                 }
-                //ensure final state is pushed here
-                statePath.push_back(lifecycleState);
-
+                statePath = transitionPath->mStates;
+                statePathLength = transitionPath->mLength;
                 if (Exchange::ILifecycleManager::LifecycleState::TERMINATING == lifecycleState)
 	        {
-                    statePath.push_back(Exchange::ILifecycleManager::LifecycleState::UNLOADED);
+                    statePathLength++;
 	        }
             }
             else
             {
-                statePath = context->mPendingStates;
+                pendingStates.swap(context->mPendingStates);
+                statePath = pendingStates.data();
+                statePathLength = pendingStates.size();
             }
             return true;
         }
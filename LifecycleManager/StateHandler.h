@@ -22,31 +22,45 @@
 #include <interfaces/ILifecycleManager.h>
 #include "ApplicationContext.h"
 #include "State.h"
-#include <list>
-#include <map>
+#include <vector>
 #include <string>
+#include <atomic>
 #include "StateTransitionRequest.h"
 
+#define LIFECYCLE_STATE_COUNT 8
+#define MAX_STATE_PATH_LENGTH 5
+
 namespace WPEFramework
 {
     namespace Plugin
     {
+        /*
+         * Sequence of states visited when moving from the first to the last entry.
+         * An empty path means there is no valid transition. The spare slot holds the
+         * UNLOADED step that follows a TERMINATING target.
+         */
+        struct StatePath
+        {
+            uint8_t mLength;
+            Exchange::ILifecycleManager::LifecycleState mStates[MAX_STATE_PATH_LENGTH + 1];
+        };
+
         class StateHandler
 	{
             public:
                 static void initialize();
 	        static bool changeState(StateTransitionRequest& request, string& errorReason);
+                static const StatePath* getTransitionPath(Exchange::ILifecycleManager::LifecycleState start, Exchange::ILifecycleManager::LifecycleState target);
+                static const char* getStateString(Exchange::ILifecycleManager::LifecycleState lifecycleState);
 
             private:
-                static uint32_t sStateChangeCount;
+                static std::atomic<uint32_t> sStateChangeCount;
 
-                static State* createState(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState lifeCycleState);
-                static bool isValidTransition(Exchange::ILifecycleManager::LifecycleState start, Exchange::ILifecycleManager::LifecycleState target, std::map<Exchange::ILifecycleManager::LifecycleState, bool>& pathSequence, std::vector<Exchange::ILifecycleManager::LifecycleState>& foundPath);
 	        static bool updateState(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState lifeCycleState, string& errorReason);
                 static void sendEvent(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState oldLifecycleState, Exchange::ILifecycleManager::LifecycleState newLifecycleState, string& errorReason);
-                static bool getStatePath(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState lifecycleState, std::vector<Exchange::ILifecycleManager::LifecycleState>& statePath, string& errorReason);
-                static std::map<Exchange::ILifecycleManager::LifecycleState, std::list<Exchange::ILifecycleManager::LifecycleState>> mPossibleStateTransitions;
-                static std::map<Exchange::ILifecycleManager::LifecycleState, std::string> mStateStrings;
+                static void beginHop(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState oldLifecycleState, Exchange::ILifecycleManager::LifecycleState newLifecycleState);
+                static void endHop(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState oldLifecycleState, Exchange::ILifecycleManager::LifecycleState newLifecycleState);
+                static bool getStatePath(ApplicationContext* context, Exchange::ILifecycleManager::LifecycleState lifecycleState, std::vector<Exchange::ILifecycleManager::LifecycleState>& pendingStates, const Exchange::ILifecycleManager::LifecycleState*& statePath, size_t& statePathLength, string& errorReason);
         };
     } /* namespace Plugin */
 } /* namespace WPEFramework */
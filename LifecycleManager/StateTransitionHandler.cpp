@@ -22,29 +22,380 @@
 #include <cstdlib>
 #include <thread>
 #include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <map>
 #include <vector>
 #include <atomic>
+#include <chrono>
 #include <cerrno>
 #include <cstring>
 #include <exception>
+#include <unistd.h>
+#include <sys/eventfd.h>
 #include "UtilsLogging.h"
 
 namespace WPEFramework
 {
     namespace Plugin
     {
-        static std::thread requestHandlerThread;
+        namespace {
+            /*
+             * Node of the intake queue. A node carries either a new request added by a
+             * caller or a request that a worker has finished executing.
+             */
+            struct RequestNode
+            {
+                RequestNode(): mNext(nullptr), mRequest(), mCompleted(false)
+                {
+                }
+                std::atomic<RequestNode*> mNext;
+                std::shared_ptr<StateTransitionRequest> mRequest;
+                bool mCompleted;
+            };
+
+            /*
+             * Multi producer / single consumer intrusive queue (Vyukov). push() is wait-free
+             * and may be called from any thread, pop() must only be called by the scheduler.
+             */
+            class RequestQueue
+            {
+                public:
+                    RequestQueue(): mHead(&mStub), mTail(&mStub), mStub()
+                    {
+                    }
+
+                    void push(RequestNode* node)
+                    {
+                        node->mNext.store(nullptr, std::memory_order_relaxed);
+                        RequestNode* previous = mHead.exchange(node, std::memory_order_acq_rel);
+                        previous->mNext.store(node, std::memory_order_release);
+                    }
+
+                    // Returns nullptr when the queue is empty or a producer is between the two
+                    // steps of push(); that producer signals the eventfd afterwards.
+                    RequestNode* pop()
+                    {
+                        RequestNode* tail = mTail;
+                        RequestNode* next = tail->mNext.load(std::memory_order_acquire);
+                        if (tail == &mStub)
+                        {
+                            if (nullptr == next)
+                            {
+                                return nullptr;
+                            }
+                            mTail = next;
+                            tail = next;
+                            next = next->mNext.load(std::memory_order_acquire);
+                        }
+                        if (nullptr != next)
+                        {
+                            mTail = next;
+                            return tail;
+                        }
+                        if (tail != mHead.load(std::memory_order_acquire))
+                        {
+                            return nullptr;
+                        }
+                        push(&mStub);
+                        next = tail->mNext.load(std::memory_order_acquire);
+                        if (nullptr != next)
+                        {
+                            mTail = next;
+                            return tail;
+                        }
+                        return nullptr;
+                    }
+
+                private:
+                    std::atomic<RequestNode*> mHead;
+                    RequestNode* mTail;
+                    RequestNode mStub;
+            };
+
+            /*
+             * Scheduler bookkeeping for one context. mPending holds the latest request that
+             * has not started yet, so newer requests replace older ones for the same context.
+             */
+            struct ContextSlot
+            {
+                ContextSlot(): mPending(), mExecuting(false)
+                {
+                }
+                std::shared_ptr<StateTransitionRequest> mPending;
+                bool mExecuting;
+            };
+        }
+
+        static RequestQueue sRequestQueue;
+        static int sRequestEventFd = -1;
+        static std::thread sSchedulerThread;
+        static std::vector<std::thread> sRequestHandlerThreads;
+        // Context bookkeeping, owned by the scheduler thread only
+        static std::map<ApplicationContext*, ContextSlot> sContextSlots;
+        // Requests handed over to the worker pool, one lane per priority
         std::mutex gRequestMutex;
-        sem_t gRequestSemaphore;
-        std::vector<std::shared_ptr<StateTransitionRequest>> gRequests;
+        static std::condition_variable sRequestCondition;
+        static std::deque<std::shared_ptr<StateTransitionRequest>> sReadyLanes[TRANSITION_PRIORITY_COUNT];
+        static TransitionLaneStats sLaneStats[TRANSITION_PRIORITY_COUNT];
         static std::atomic<bool> sRunning{true};
         static std::atomic<bool> sInitialized{false};
+        static std::atomic<uint32_t> sActiveProducers{0};
+        static std::atomic<uint32_t> sWorkerCount{0};
+        static std::atomic<uint64_t> sCoalescedRequests{0};
+        static std::atomic<uint64_t> sExecutedRequests{0};
+        static std::atomic<uint64_t> sDroppedRequests{0};
 
         namespace {
             void terminateStateTransitionHandlerAtExit()
             {
                 StateTransitionHandler::getInstance()->terminate();
             }
+
+            void signalScheduler()
+            {
+                uint64_t value = 1;
+                if (sizeof(value) != write(sRequestEventFd, &value, sizeof(value)))
+                {
+                    LOGERR("Unable to signal state transition scheduler: %s", strerror(errno));
+                }
+            }
+
+            void pushNode(std::shared_ptr<StateTransitionRequest> request, bool completed)
+            {
+                RequestNode* node = new RequestNode();
+                node->mRequest = std::move(request);
+                node->mCompleted = completed;
+                sRequestQueue.push(node);
+                signalScheduler();
+            }
+
+            void dispatchRequest(std::shared_ptr<StateTransitionRequest> request)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(gRequestMutex);
+                    TransitionPriority priority = (TRANSITION_PRIORITY_COUNT > request->mPriority) ? request->mPriority : TRANSITION_PRIORITY_NORMAL;
+                    request->mQueuedTime = std::chrono::steady_clock::now();
+                    sReadyLanes[priority].push_back(std::move(request));
+                    sLaneStats[priority].mDepth = sReadyLanes[priority].size();
+                }
+                sRequestCondition.notify_one();
+            }
+
+            bool hasReadyRequests()
+            {
+                for (size_t lane = 0; lane < TRANSITION_PRIORITY_COUNT; lane++)
+                {
+                    if (false == sReadyLanes[lane].empty())
+                    {
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            // Called with gRequestMutex held and at least one request ready
+            std::shared_ptr<StateTransitionRequest> takeReadyRequest()
+            {
+                const std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+                const std::chrono::milliseconds starvationLimit(TRANSITION_STARVATION_LIMIT_MS);
+                size_t selectedLane = TRANSITION_PRIORITY_COUNT;
+                // Starvation guard: the oldest request that waited too long in a lower lane goes first
+                for (size_t lane = 1; lane < TRANSITION_PRIORITY_COUNT; lane++)
+                {
+                    if ((false == sReadyLanes[lane].empty()) && (starvationLimit <= (now - sReadyLanes[lane].front()->mQueuedTime)) &&
+                        ((TRANSITION_PRIORITY_COUNT == selectedLane) || (sReadyLanes[lane].front()->mQueuedTime < sReadyLanes[selectedLane].front()->mQueuedTime)))
+                    {
+                        selectedLane = lane;
+                    }
+                }
+                for (size_t lane = 0; (TRANSITION_PRIORITY_COUNT == selectedLane) && (lane < TRANSITION_PRIORITY_COUNT); lane++)
+                {
+                    if (false == sReadyLanes[lane].empty())
+                    {
+                        selectedLane = lane;
+                    }
+                }
+
+                std::shared_ptr<StateTransitionRequest> request = std::move(sReadyLanes[selectedLane].front());
+                sReadyLanes[selectedLane].pop_front();
+                TransitionLaneStats& stats = sLaneStats[selectedLane];
+                uint64_t waitMs = std::chrono::duration_cast<std::chrono::milliseconds>(now - request->mQueuedTime).count();
+                stats.mDepth = sReadyLanes[selectedLane].size();
+                stats.mDequeued++;
+                stats.mTotalWaitMs += waitMs;
+                if (waitMs > stats.mMaxWaitMs)
+                {
+                    stats.mMaxWaitMs = waitMs;
+                }
+                return request;
+            }
+
+            void scheduleNode(RequestNode* node)
+            {
+                ApplicationContext* contextKey = node->mRequest->mContext.get();
+                if (true == node->mCompleted)
+                {
+                    auto slotIter = sContextSlots.find(contextKey);
+                    if (slotIter == sContextSlots.end())
+                    {
+                        return;
+                    }
+                    if (nullptr != slotIter->second.mPending)
+                    {
+                        dispatchRequest(std::move(slotIter->second.mPending));
+                        slotIter->second.mPending.reset();
+                    }
+                    else
+                    {
+                        sContextSlots.erase(slotIter);
+                    }
+                    return;
+                }
+
+                ContextSlot& slot = sContextSlots[contextKey];
+                if (true == slot.mExecuting)
+                {
+                    if (nullptr != slot.mPending)
+                    {
+                        // A pending unload or kill is never superseded, the app must still be torn down
+                        if (Exchange::ILifecycleManager::LifecycleState::TERMINATING == slot.mPending->mTargetState)
+                        {
+                            ApplicationContext* context = node->mRequest->mContext.get();
+                            LOGWARN("Dropping state %d request for appInstanceId[%s], termination is pending",
+                                    static_cast<int>(node->mRequest->mTargetState), (nullptr != context) ? context->getAppInstanceId().c_str() : "");
+                            sDroppedRequests++;
+                            return;
+                        }
+                        // Only the latest target state matters, the older request has not started yet
+                        sCoalescedRequests++;
+                    }
+                    slot.mPending = std::move(node->mRequest);
+                    return;
+                }
+                slot.mExecuting = true;
+                dispatchRequest(std::move(node->mRequest));
+            }
+
+            void scheduleRequests()
+            {
+                while (true == sRunning.load())
+                {
+                    uint64_t value = 0;
+                    ssize_t bytesRead = read(sRequestEventFd, &value, sizeof(value));
+                    if ((sizeof(value) != bytesRead) && (EINTR != errno))
+                    {
+                        LOGERR("Unable to read state transition eventfd: %s", strerror(errno));
+                    }
+                    if (false == sRunning.load())
+                    {
+                        break;
+                    }
+
+                    RequestNode* node = nullptr;
+                    while (nullptr != (node = sRequestQueue.pop()))
+                    {
+                        if (nullptr != node->mRequest)
+                        {
+                            scheduleNode(node);
+                        }
+                        delete node;
+                    }
+                }
+            }
+
+            void executeRequest(StateTransitionRequest& request)
+            {
+                std::string errorReason;
+                bool success = false;
+                try
+                {
+                    success = StateHandler::changeState(request, errorReason);
+                }
+                catch (const std::exception& ex)
+                {
+                    errorReason = ex.what();
+                }
+                catch (...)
+                {
+                    errorReason = "unknown exception";
+                }
+                sExecutedRequests++;
+
+                if (false == success)
+                {
+                    ApplicationContext* context = request.mContext.get();
+                    LOGERR("ERROR IN STATE TRANSITION ... appInstanceId[%s] %s \n", (nullptr != context) ? context->getAppInstanceId().c_str() : "", errorReason.c_str());
+                    //TODO: Decide on what to do on state transition error
+                }
+            }
+
+            void processRequests()
+            {
+                std::unique_lock<std::mutex> lock(gRequestMutex);
+                while (true)
+                {
+                    sRequestCondition.wait(lock, []() { return ((false == sRunning.load()) || hasReadyRequests()); });
+                    if (false == sRunning.load())
+                    {
+                        break;
+                    }
+
+                    std::shared_ptr<StateTransitionRequest> request = takeReadyRequest();
+                    lock.unlock();
+
+                    executeRequest(*request);
+                    // Hand the request back so the scheduler can release the context
+                    pushNode(std::move(request), true);
+
+                    lock.lock();
+                }
+            }
+
+            void clearRequests()
+            {
+                RequestNode* node = nullptr;
+                while (nullptr != (node = sRequestQueue.pop()))
+                {
+                    delete node;
+                }
+                sContextSlots.clear();
+                std::lock_guard<std::mutex> lock(gRequestMutex);
+                for (size_t lane = 0; lane < TRANSITION_PRIORITY_COUNT; lane++)
+                {
+                    sReadyLanes[lane].clear();
+                    sLaneStats[lane].mDepth = 0;
+                }
+            }
+
+            void stopThreads()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(gRequestMutex);
+                    sRunning.store(false);
+                }
+                sRequestCondition.notify_all();
+                if (0 <= sRequestEventFd)
+                {
+                    signalScheduler();
+                }
+                if (true == sSchedulerThread.joinable())
+                {
+                    sSchedulerThread.join();
+                }
+                for (auto& workerThread : sRequestHandlerThreads)
+                {
+                    if (true == workerThread.joinable())
+                    {
+                        workerThread.join();
+                    }
+                    else
+                    {
+                        LOGWARN("state transition worker is not joinable in %s", __FUNCTION__);
+                    }
+                }
+                sRequestHandlerThreads.clear();
+            }
         }
 
         StateTransitionHandler* StateTransitionHandler::mInstance = nullptr;
@@ -66,7 +417,7 @@ namespace WPEFramework
 	{
 	}
 
-        bool StateTransitionHandler::initialize()
+        bool StateTransitionHandler::initialize(uint32_t workerCount)
 	{
             {
                 std::lock_guard<std::mutex> lock(gRequestMutex);
@@ -76,88 +427,49 @@ namespace WPEFramework
                 }
 
                 sRunning.store(true);
+            }
 
-                if (0 != sem_init(&gRequestSemaphore, 0, 0))
-                {
-                    LOGERR("sem_init failed in %s", __FUNCTION__);
-                    return false;
-                }
+            if (0 == workerCount)
+            {
+                workerCount = DEFAULT_STATE_TRANSITION_WORKERS;
+            }
+            else if (MAX_STATE_TRANSITION_WORKERS < workerCount)
+            {
+                LOGWARN("Requested %u state transition workers, limiting to %u", workerCount, MAX_STATE_TRANSITION_WORKERS);
+                workerCount = MAX_STATE_TRANSITION_WORKERS;
+            }
 
+            sRequestEventFd = eventfd(0, EFD_CLOEXEC);
+            if (0 > sRequestEventFd)
+            {
+                LOGERR("eventfd failed in %s: %s", __FUNCTION__, strerror(errno));
+                return false;
             }
 
             StateHandler::initialize();
             std::atexit(terminateStateTransitionHandlerAtExit);
             try
             {
-            requestHandlerThread = std::thread([=]() {
-                bool isRunning = true;
+                sSchedulerThread = std::thread(scheduleRequests);
+                for (uint32_t index = 0; index < workerCount; index++)
                 {
-                    std::lock_guard<std::mutex> lock(gRequestMutex);
-                    isRunning = sRunning.load();
-                }
-                while(isRunning)
-		{
-                    while (true)
-                    {
-                        std::shared_ptr<StateTransitionRequest> request;
-                        {
-                            std::lock_guard<std::mutex> lock(gRequestMutex);
-                            if (true == gRequests.empty())
-                            {
-                                break;
-                            }
-                            request = gRequests.front();
-                            gRequests.erase(gRequests.begin());
-                        }
-
-                        if (nullptr == request)
-                        {
-                            continue;
-                        }
-
-                        std::string errorReason;
-                        bool success = false;
-                        try
-                        {
-                            success = StateHandler::changeState(*request, errorReason);
-                        }
-                        catch (const std::exception& ex)
-                        {
-                            errorReason = ex.what();
-                        }
-                        catch (...)
-                        {
-                            errorReason = "unknown exception";
-                        }
-
-                        if (false == success)
-                        {
-                            LOGERR("ERROR IN STATE TRANSITION ... %s \n",errorReason.c_str());
-                            //TODO: Decide on what to do on state transition error
-                            break;
-                        }
-                    }
-                    sem_wait(&gRequestSemaphore);
-                    {
-                        std::lock_guard<std::mutex> lock(gRequestMutex);
-                        isRunning = sRunning.load();
-                    }
+                    sRequestHandlerThreads.push_back(std::thread(processRequests));
                 }
-            });
             }
             catch (const std::system_error& ex)
             {
-                LOGERR("Failed to create requestHandlerThread in %s: %s", __FUNCTION__, ex.what());
-                {
-                    std::lock_guard<std::mutex> lock(gRequestMutex);
-                    sInitialized.store(false);
-                    gRequests.clear();
-                }
-                sem_destroy(&gRequestSemaphore);
+                LOGERR("Failed to create state transition threads in %s: %s", __FUNCTION__, ex.what());
+                stopThreads();
+                clearRequests();
+                close(sRequestEventFd);
+                sRequestEventFd = -1;
+                sInitialized.store(false);
                 return false;
             }
 
-            // Mark as initialized only after semaphore and thread are ready
+            LOGINFO("State transition handler started with %u workers", workerCount);
+            sWorkerCount.store(workerCount);
+            // Mark as initialized only after the eventfd and threads are ready
             sInitialized.store(true);
 	    return true;	
 	}
@@ -170,56 +482,81 @@ namespace WPEFramework
                 {
                     return;
                 }
-
-                sRunning.store(false);
                 sInitialized.store(false);
             }
 
-            sem_post(&gRequestSemaphore);
-
-            if (true == requestHandlerThread.joinable())
+            // Wait for callers that passed the initialized check to finish signalling
+            while (0 != sActiveProducers.load())
             {
-                requestHandlerThread.join();
-            }
-            else
-            {
-                LOGWARN("requestHandlerThread is not joinable in %s", __FUNCTION__);
+                std::this_thread::yield();
             }
 
-            if (0 != sem_destroy(&gRequestSemaphore))
-            {
-                LOGERR("sem_destroy failed in %s: %s", __FUNCTION__, strerror(errno));
-            }
+            stopThreads();
+            clearRequests();
 
+            if (0 != close(sRequestEventFd))
             {
-                std::lock_guard<std::mutex> lock(gRequestMutex);
-                gRequests.clear();
+                LOGERR("close eventfd failed in %s: %s", __FUNCTION__, strerror(errno));
             }
+            sRequestEventFd = -1;
+            sWorkerCount.store(0);
 	}
 
 	void StateTransitionHandler::addRequest(StateTransitionRequest& request)
 	{
-           // Prevent sem_post on destroyed semaphore
+           sActiveProducers++;
            if (false == sInitialized.load())
            {
+               sActiveProducers--;
                LOGWARN("addRequest called while handler is not initialized in %s, dropping request", __FUNCTION__);
                return;
            }
 
            //TODO: Pass contect and state as argument to function
-	   std::shared_ptr<StateTransitionRequest> stateTransitionRequest = std::make_shared<StateTransitionRequest>(request.mContext, request.mTargetState);
-	   {
-               std::lock_guard<std::mutex> lock(gRequestMutex);
-               if (false == sInitialized.load())
-               {
-                   LOGWARN("addRequest called after handler shutdown started in %s, dropping request", __FUNCTION__);
-                   return;
-               }
-
-               gRequests.push_back(std::move(stateTransitionRequest));
-               sem_post(&gRequestSemaphore);
-	   }
+	   pushNode(std::make_shared<StateTransitionRequest>(request.mContext, request.mTargetState, request.mPriority), false);
+           sActiveProducers--;
 	}
 
+        uint32_t StateTransitionHandler::getWorkerCount() const
+        {
+            return sWorkerCount.load();
+        }
+
+        uint64_t StateTransitionHandler::getCoalescedRequestCount() const
+        {
+            return sCoalescedRequests.load();
+        }
+
+        uint64_t StateTransitionHandler::getExecutedRequestCount() const
+        {
+            return sExecutedRequests.load();
+        }
+
+        uint64_t StateTransitionHandler::getDroppedRequestCount() const
+        {
+            return sDroppedRequests.load();
+        }
+
+        TransitionLaneStats StateTransitionHandler::getLaneStats(TransitionPriority priority) const
+        {
+            if (TRANSITION_PRIORITY_COUNT <= priority)
+            {
+                return TransitionLaneStats();
+            }
+            std::lock_guard<std::mutex> lock(gRequestMutex);
+            return sLaneStats[priority];
+        }
+
+        void StateTransitionHandler::resetLaneStats()
+        {
+            std::lock_guard<std::mutex> lock(gRequestMutex);
+            for (size_t lane = 0; lane < TRANSITION_PRIORITY_COUNT; lane++)
+            {
+                uint32_t depth = sLaneStats[lane].mDepth;
+                sLaneStats[lane] = TransitionLaneStats();
+                sLaneStats[lane].mDepth = depth;
+            }
+        }
+
     } /* namespace Plugin */
 } /* namespace WPEFramework */
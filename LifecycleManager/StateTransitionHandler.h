@@ -23,23 +23,56 @@
 #include <thread>
 #include "StateTransitionRequest.h"
 
+#define DEFAULT_STATE_TRANSITION_WORKERS 4
+#define MAX_STATE_TRANSITION_WORKERS 16
+#define TRANSITION_STARVATION_LIMIT_MS 1000
+
 namespace WPEFramework
 {
     namespace Plugin
     {
+        /* Queue depth and wait time of one priority lane */
+        struct TransitionLaneStats
+        {
+            TransitionLaneStats(): mDepth(0), mDequeued(0), mTotalWaitMs(0), mMaxWaitMs(0)
+            {
+            }
+            uint32_t mDepth;
+            uint64_t mDequeued;
+            uint64_t mTotalWaitMs;
+            uint64_t mMaxWaitMs;
+        };
+
+        /*
+         * Executes state transition requests on a bounded pool of worker threads.
+         * Requests for the same ApplicationContext are always executed one at a time
+         * and in the order they were added; requests for different contexts run in parallel.
+         * Requests are handed to a scheduler thread through a lock-free queue woken by an
+         * eventfd. Requests for a context that have not started yet are coalesced so that
+         * only the latest target state is executed; a pending TERMINATING request is never
+         * replaced, and later requests for that context are dropped instead.
+         * Runnable requests wait in one lane per TransitionPriority. Workers drain the
+         * foreground lane first; a request that waited longer than
+         * TRANSITION_STARVATION_LIMIT_MS in a lower lane is taken ahead of it.
+         */
         class StateTransitionHandler
 	{
             public:
                 StateTransitionHandler(const StateTransitionHandler& obj) = delete;
                 static StateTransitionHandler* getInstance();
                 ~StateTransitionHandler ();
-                bool initialize();
+                bool initialize(uint32_t workerCount = DEFAULT_STATE_TRANSITION_WORKERS);
 		void terminate();
                 void addRequest(StateTransitionRequest& request);
+                uint32_t getWorkerCount() const;
+                uint64_t getCoalescedRequestCount() const;
+                uint64_t getExecutedRequestCount() const;
+                uint64_t getDroppedRequestCount() const;
+                TransitionLaneStats getLaneStats(TransitionPriority priority) const;
+                void resetLaneStats();
 	    private: /* members */
                 StateTransitionHandler();
                 static StateTransitionHandler* mInstance;
-		//std::vector<StateTransitionRequest> mRequests; //TODO
         };
     } /* namespace Plugin */
 } /* namespace WPEFramework */
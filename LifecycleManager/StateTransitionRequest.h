@@ -1,6 +1,7 @@
 #ifndef STATE_TRANSITION_REQUEST_H
 #define STATE_TRANSITION_REQUEST_H
 #include "ApplicationContext.h"
+#include <chrono>
 #include <memory>
 #include <thread>
 #include <semaphore>
@@ -10,14 +11,28 @@ namespace WPEFramework
 {
     namespace Plugin
     {
+        /*
+         * Scheduling class of a request. Foreground requests are always picked first,
+         * background requests only run when nothing else waits or they start to starve.
+         */
+        enum TransitionPriority
+        {
+            TRANSITION_PRIORITY_FOREGROUND = 0,
+            TRANSITION_PRIORITY_NORMAL,
+            TRANSITION_PRIORITY_BACKGROUND,
+            TRANSITION_PRIORITY_COUNT
+        };
+
         struct StateTransitionRequest
         {
-            StateTransitionRequest(std::shared_ptr<ApplicationContext> context, Exchange::ILifecycleManager::LifecycleState state): mContext(context), mTargetState(state), mStatePath()
+            StateTransitionRequest(std::shared_ptr<ApplicationContext> context, Exchange::ILifecycleManager::LifecycleState state, TransitionPriority priority = TRANSITION_PRIORITY_NORMAL): mContext(context), mTargetState(state), mStatePath(), mPriority(priority), mQueuedTime()
             {
             }
             std::shared_ptr<ApplicationContext> mContext;
             Exchange::ILifecycleManager::LifecycleState mTargetState;
             std::vector<Exchange::ILifecycleManager::LifecycleState> mStatePath;
+            TransitionPriority mPriority;
+            std::chrono::steady_clock::time_point mQueuedTime;
         };
     }
 }
@@ -64,6 +64,8 @@ namespace Plugin
         , mEnvVariables()
         , mDefaultAllowedLogLevels({"fatal", "error", "warning", "milestone", "info", "debug"})
         , mRialtoOverride(-1)
+        , mStatsSamplerIntervalMs(1000)
+        , mStatsSamplerCgroupRoot("/sys/fs/cgroup")
     {
         // All members initialized in initialization list above
     }
@@ -414,6 +416,7 @@ namespace Plugin
         }
         LOGINFO("preloads: %s", preloadsStr.c_str());
         LOGINFO("envVariables: %s", envsStr.c_str());
+        LOGINFO("statsSampler: intervalMs %u, cgroupRoot %s", mStatsSamplerIntervalMs, mStatsSamplerCgroupRoot.c_str());
     }
 
     void AIConfiguration::readFromYamlConfigFile(const std::string& runtimeConfigFile)
@@ -558,6 +561,16 @@ namespace Plugin
         return mRialtoOverride;
     }
 
+    uint32_t AIConfiguration::getStatsSamplerIntervalMs() const
+    {
+        return mStatsSamplerIntervalMs;
+    }
+
+    std::string AIConfiguration::getStatsSamplerCgroupRoot() const
+    {
+        return mStatsSamplerCgroupRoot;
+    }
+
     void AIConfiguration::readFromConfigFile()
     {
         LOGINFO("AIConfiguration reading from config file at %s", AICONFIGURATION_JSON_PATH);
@@ -695,6 +708,13 @@ namespace Plugin
                     (mRialtoOverride > 0) ? "forceOn" : "forceOff");
         }
 
+        // ---- cgroup stats sampler ----------------------------------------
+        const Json::Value& statsSampler = getObj(root, "statsSampler");
+        if (statsSampler["intervalMs"].isUInt())
+            mStatsSamplerIntervalMs = statsSampler["intervalMs"].asUInt();
+        if (statsSampler["cgroupRoot"].isString())
+            mStatsSamplerCgroupRoot = statsSampler["cgroupRoot"].asString();
+
         printAIConfiguration();
     }
 } /* namespace Plugin */
@@ -63,6 +63,10 @@ namespace Plugin
 
             int getRialtoOverride() const;
 
+            // cgroup stats sampler
+            uint32_t getStatsSamplerIntervalMs() const;
+            std::string getStatsSamplerCgroupRoot() const;
+
         private:
             void readFromCustomData();
             void readFromConfigFile();
@@ -96,6 +100,10 @@ namespace Plugin
             std::list<std::string> mSvpFiles;
             std::list<std::string> mDefaultAllowedLogLevels;
             int mRialtoOverride;
+
+            // cgroup stats sampler
+            uint32_t mStatsSamplerIntervalMs;
+            std::string mStatsSamplerCgroupRoot;
     };
 } /* namespace Plugin */
 } /* namespace WPEFramework */
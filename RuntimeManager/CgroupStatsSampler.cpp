@@ -0,0 +1,428 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "CgroupStatsSampler.h"
+#include "OCIJsonWriter.h"
+#include "UtilsLogging.h"
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <fcntl.h>
+#include <sstream>
+#include <system_error>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+#define CGROUP_STATS_READ_CHUNK 4096
+/* Longest line in any of the files read; seq_file only stops short of a full buffer by less than this before the end */
+#define CGROUP_STATS_MAX_LINE 64
+
+namespace WPEFramework {
+namespace Plugin {
+
+namespace {
+
+struct CgroupFileName
+{
+    const char* controller;
+    const char* file;
+};
+
+// Indexed by CgroupStatsSampler::CgroupFile
+const CgroupFileName kCgroupFiles[] = {
+    { "memory",  "memory.usage_in_bytes" },
+    { "memory",  "memory.limit_in_bytes" },
+    { "memory",  "memory.max_usage_in_bytes" },
+    { "memory",  "memory.failcnt" },
+    { "memory",  "memory.stat" },
+    { "memory",  "cgroup.procs" },
+    { "cpuacct", "cpuacct.usage" },
+    { "cpuacct", "cpuacct.usage_percpu" },
+    { "gpu",     "gpu.usage_in_bytes" },
+    { "gpu",     "gpu.limit_in_bytes" },
+    { "gpu",     "gpu.max_usage_in_bytes" },
+    { "gpu",     "gpu.failcnt" },
+    { "freezer", "freezer.state" },
+};
+
+uint64_t toNumber(const std::string& text)
+{
+    return strtoull(text.c_str(), nullptr, 10);
+}
+
+uint64_t nowMs()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000 + static_cast<uint64_t>(ts.tv_nsec) / 1000000;
+}
+
+} // namespace
+
+CgroupStatsSampler::Container::Container(const std::string& containerId)
+    : id(containerId)
+{
+    for (int& fd : fds)
+    {
+        fd = -1;
+    }
+}
+
+CgroupStatsSampler::Container::~Container()
+{
+    for (int fd : fds)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+}
+
+CgroupStatsSampler::CgroupStatsSampler(const Config& config)
+    : mConfig(config)
+    , mPassLock()
+    , mContainers()
+    , mReadBuffer()
+    , mLock()
+    , mWake()
+    , mChanges()
+    , mSamples()
+    , mFront(0)
+    , mStopping(false)
+    , mWakeUp(false)
+    , mThread()
+{
+}
+
+CgroupStatsSampler::~CgroupStatsSampler()
+{
+    stop();
+}
+
+void CgroupStatsSampler::start()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    if (mThread.joinable() || mStopping)
+    {
+        return;
+    }
+    try
+    {
+        mThread = std::thread(&CgroupStatsSampler::samplerLoop, this);
+    }
+    catch (const std::system_error& ex)
+    {
+        LOGWARN("Unable to start cgroup stats sampler: %s", ex.what());
+    }
+}
+
+void CgroupStatsSampler::stop()
+{
+    std::thread thread;
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mStopping = true;
+        thread.swap(mThread);
+    }
+    mWake.notify_all();
+    if (thread.joinable())
+    {
+        thread.join();
+    }
+}
+
+void CgroupStatsSampler::addContainer(const std::string& containerId)
+{
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mChanges[containerId] = true;
+        mWakeUp = true;
+    }
+    /* A new container gets its first sample right away instead of after a full interval */
+    mWake.notify_all();
+}
+
+void CgroupStatsSampler::removeContainer(const std::string& containerId)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    mChanges[containerId] = false;
+    mSamples[mFront].erase(containerId);
+}
+
+bool CgroupStatsSampler::getInfo(const std::string& containerId, std::string& info) const
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    const auto it = mSamples[mFront].find(containerId);
+    if (it == mSamples[mFront].end())
+    {
+        return false;
+    }
+    info = it->second;
+    return true;
+}
+
+void CgroupStatsSampler::samplerLoop()
+{
+    std::unique_lock<std::mutex> lock(mLock);
+    while (!mStopping)
+    {
+        lock.unlock();
+        sampleNow();
+        lock.lock();
+        mWake.wait_for(lock, std::chrono::milliseconds(mConfig.intervalMs), [this]() { return mStopping || mWakeUp; });
+        mWakeUp = false;
+    }
+}
+
+void CgroupStatsSampler::sampleNow()
+{
+    std::lock_guard<std::mutex> pass(mPassLock);
+    applyChanges();
+
+    /* Only a pass touches the back buffer, so it is filled without holding mLock */
+    uint32_t back;
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        back = 1 - mFront;
+    }
+    std::map<std::string, std::string>& samples = mSamples[back];
+    samples.clear();
+    for (auto& entry : mContainers)
+    {
+        std::string info;
+        if (serialize(*entry.second, info))
+        {
+            samples.emplace(entry.first, std::move(info));
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(mLock);
+    /* A container removed during the pass must not come back with this sample */
+    for (const auto& change : mChanges)
+    {
+        if (!change.second)
+        {
+            samples.erase(change.first);
+        }
+    }
+    mFront = back;
+}
+
+void CgroupStatsSampler::applyChanges()
+{
+    std::map<std::string, bool> changes;
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        changes.swap(mChanges);
+    }
+    for (const auto& change : changes)
+    {
+        if (change.second)
+        {
+            std::unique_ptr<Container> container(new Container(change.first));
+            openFiles(*container);
+            mContainers[change.first] = std::move(container);
+        }
+        else
+        {
+            mContainers.erase(change.first);
+        }
+    }
+    /* A container whose memory cgroup was not there yet is retried on every pass */
+    for (auto& entry : mContainers)
+    {
+        if (entry.second->fds[MEMORY_USAGE] < 0)
+        {
+            openFiles(*entry.second);
+        }
+    }
+}
+
+void CgroupStatsSampler::openFiles(Container& container) const
+{
+    for (int i = 0; i < CGROUP_FILE_COUNT; ++i)
+    {
+        if (container.fds[i] >= 0)
+        {
+            continue;
+        }
+        const std::string path = mConfig.cgroupRoot + "/" + kCgroupFiles[i].controller + "/" + container.id + "/" + kCgroupFiles[i].file;
+        container.fds[i] = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    }
+}
+
+bool CgroupStatsSampler::readFile(int fd, std::string& content)
+{
+    content.clear();
+    if (fd < 0)
+    {
+        return false;
+    }
+    off_t offset = 0;
+    while (true)
+    {
+        if (mReadBuffer.size() < CGROUP_STATS_READ_CHUNK)
+        {
+            mReadBuffer.resize(CGROUP_STATS_READ_CHUNK);
+        }
+        const ssize_t count = TEMP_FAILURE_RETRY(pread(fd, &mReadBuffer[0], mReadBuffer.size(), offset));
+        if (count < 0)
+        {
+            return false;
+        }
+        content.append(mReadBuffer.data(), count);
+        offset += count;
+        if (count == 0 || (mReadBuffer.size() - static_cast<size_t>(count)) > CGROUP_STATS_MAX_LINE)
+        {
+            return true;
+        }
+    }
+}
+
+/*
+ * Produces the document GetContainerInfo returns, with the memory.stat
+ * counters added under memory.stat. Keys are written in ascending order.
+ */
+bool CgroupStatsSampler::serialize(Container& container, std::string& info)
+{
+    std::string usage;
+    if (!readFile(container.fds[MEMORY_USAGE], usage) || usage.empty())
+    {
+        /* Gone or not created yet, answer through the OCI plugin */
+        return false;
+    }
+
+    OCIJsonWriter writer(2048);
+    std::string content;
+    writer.beginObject();
+
+    writer.key("cpu");
+    writer.beginObject();
+    writer.key("usage");
+    writer.beginObject();
+    writer.key("percpu");
+    writer.beginArray();
+    if (readFile(container.fds[CPUACCT_USAGE_PERCPU], content))
+    {
+        std::istringstream values(content);
+        uint64_t value;
+        while (values >> value)
+        {
+            writer.value(value);
+        }
+    }
+    writer.endArray();
+    writer.key("total");
+    writer.value(readFile(container.fds[CPUACCT_USAGE], content) ? toNumber(content) : 0);
+    writer.endObject();
+    writer.endObject();
+
+    if (readFile(container.fds[GPU_USAGE], content))
+    {
+        const uint64_t gpuUsage = toNumber(content);
+        writer.key("gpu");
+        writer.beginObject();
+        writer.key("memory");
+        writer.beginObject();
+        writer.key("failcnt");
+        writer.value(readFile(container.fds[GPU_FAILCNT], content) ? toNumber(content) : 0);
+        writer.key("limit");
+        writer.value(readFile(container.fds[GPU_LIMIT], content) ? toNumber(content) : 0);
+        writer.key("maxUsage");
+        writer.value(readFile(container.fds[GPU_MAX_USAGE], content) ? toNumber(content) : 0);
+        writer.key("usage");
+        writer.value(gpuUsage);
+        writer.endObject();
+        writer.endObject();
+    }
+
+    writer.key("id");
+    writer.value(container.id);
+
+    writer.key("memory");
+    writer.beginObject();
+    writer.key("stat");
+    writer.beginObject();
+    if (readFile(container.fds[MEMORY_STAT], content))
+    {
+        std::map<std::string, uint64_t> counters;
+        std::istringstream lines(content);
+        std::string name;
+        uint64_t value;
+        while (lines >> name >> value)
+        {
+            counters[name] = value;
+        }
+        for (const auto& counter : counters)
+        {
+            writer.key(counter.first);
+            writer.value(counter.second);
+        }
+    }
+    writer.endObject();
+    writer.key("user");
+    writer.beginObject();
+    writer.key("failcnt");
+    writer.value(readFile(container.fds[MEMORY_FAILCNT], content) ? toNumber(content) : 0);
+    writer.key("limit");
+    writer.value(readFile(container.fds[MEMORY_LIMIT], content) ? toNumber(content) : 0);
+    writer.key("maxUsage");
+    writer.value(readFile(container.fds[MEMORY_MAX_USAGE], content) ? toNumber(content) : 0);
+    writer.key("usage");
+    writer.value(toNumber(usage));
+    writer.endObject();
+    writer.endObject();
+
+    writer.key("pids");
+    writer.beginArray();
+    if (readFile(container.fds[MEMORY_PROCS], content))
+    {
+        std::istringstream pids(content);
+        int64_t pid;
+        while (pids >> pid)
+        {
+            writer.value(pid);
+        }
+    }
+    writer.endArray();
+
+    writer.key("state");
+    std::string state = "running";
+    if (readFile(container.fds[FREEZER_STATE], content) && (content.compare(0, 6, "FROZEN") == 0 || content.compare(0, 8, "FREEZING") == 0))
+    {
+        state = "paused";
+    }
+    writer.value(state);
+
+    writer.key("timestamp");
+    writer.value(nowMs());
+
+    writer.endObject();
+    info = writer.finish();
+    if (!info.empty() && info[info.size() - 1] == '\n')
+    {
+        info.erase(info.size() - 1);
+    }
+    return true;
+}
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,123 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    /*
+     * Samples the cgroup statistics of running containers in process. The
+     * cgroup files of every container are opened once and re-read with pread
+     * on each pass, and each pass is serialized into the same JSON the OCI
+     * plugin returns from GetContainerInfo.
+     *
+     * Samples are double-buffered: a pass fills the back buffer without a lock
+     * and then swaps it with the front buffer, so readers only ever copy out a
+     * finished sample and never wait on file I/O.
+     */
+    class CgroupStatsSampler
+    {
+        public:
+            struct Config
+            {
+                std::string cgroupRoot = "/sys/fs/cgroup";
+                uint32_t intervalMs = 1000;
+            };
+
+            explicit CgroupStatsSampler(const Config& config);
+            ~CgroupStatsSampler();
+
+            CgroupStatsSampler(const CgroupStatsSampler&) = delete;
+            CgroupStatsSampler& operator=(const CgroupStatsSampler&) = delete;
+
+            /* Samples every intervalMs on a background thread until stop() */
+            void start();
+            void stop();
+
+            /* Containers are picked up or dropped by the next pass */
+            void addContainer(const std::string& containerId);
+            void removeContainer(const std::string& containerId);
+
+            /* Runs one pass on the calling thread */
+            void sampleNow();
+
+            /* Copies out the latest sample of containerId; false if there is none yet */
+            bool getInfo(const std::string& containerId, std::string& info) const;
+
+        private:
+            enum CgroupFile
+            {
+                MEMORY_USAGE,
+                MEMORY_LIMIT,
+                MEMORY_MAX_USAGE,
+                MEMORY_FAILCNT,
+                MEMORY_STAT,
+                MEMORY_PROCS,
+                CPUACCT_USAGE,
+                CPUACCT_USAGE_PERCPU,
+                GPU_USAGE,
+                GPU_LIMIT,
+                GPU_MAX_USAGE,
+                GPU_FAILCNT,
+                FREEZER_STATE,
+                CGROUP_FILE_COUNT
+            };
+
+            struct Container
+            {
+                explicit Container(const std::string& id);
+                ~Container();
+                std::string id;
+                int fds[CGROUP_FILE_COUNT];
+            };
+
+            void samplerLoop();
+            void applyChanges();
+            void openFiles(Container& container) const;
+            bool readFile(int fd, std::string& content);
+            bool serialize(Container& container, std::string& info);
+
+            const Config mConfig;
+
+            /* Owned by whichever thread runs a pass */
+            std::mutex mPassLock;
+            std::map<std::string, std::unique_ptr<Container>> mContainers;
+            std::string mReadBuffer;
+
+            mutable std::mutex mLock;
+            std::condition_variable mWake;
+            std::map<std::string, bool> mChanges;               ///< containerId -> true to add, false to remove
+            std::map<std::string, std::string> mSamples[2];     ///< containerId -> GetContainerInfo JSON
+            uint32_t mFront;
+            bool mStopping;
+            bool mWakeUp;
+            std::thread mThread;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,345 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "ContainerReaper.h"
+#include "UtilsLogging.h"
+#include <cctype>
+#include <cerrno>
+#include <cstdio>
+#include <dirent.h>
+#include <fstream>
+#include <sstream>
+#include <sys/stat.h>
+#include <system_error>
+
+#define CONTAINER_REAPER_JOURNAL_SUFFIX ".teardown"
+
+namespace WPEFramework {
+namespace Plugin {
+
+ContainerReaper::ContainerReaper(const Config& config, const std::string& journalDir)
+    : mConfig(config)
+    , mJournalDir(journalDir)
+    , mLock()
+    , mChanged()
+    , mJobs()
+    , mStopping(false)
+    , mWorkers()
+{
+    if ((mkdir(mJournalDir.c_str(), 0700) != 0) && (errno != EEXIST))
+    {
+        LOGWARN("Unable to create teardown journal %s (errno=%d), teardowns will not survive a restart", mJournalDir.c_str(), errno);
+    }
+
+    const uint32_t workers = (mConfig.workers > 0) ? mConfig.workers : 1;
+    for (uint32_t i = 0; i < workers; ++i)
+    {
+        try
+        {
+            mWorkers.emplace_back(&ContainerReaper::workerLoop, this);
+        }
+        catch (const std::system_error& ex)
+        {
+            LOGWARN("Unable to start teardown worker %u: %s", i, ex.what());
+        }
+    }
+    if (mWorkers.empty())
+    {
+        LOGERR("No teardown worker running, teardowns will be refused");
+        mStopping = true;
+    }
+}
+
+ContainerReaper::~ContainerReaper()
+{
+    stop();
+}
+
+std::vector<std::pair<std::string, std::string>> ContainerReaper::unfinished() const
+{
+    std::vector<std::pair<std::string, std::string>> records;
+    DIR* dir = opendir(mJournalDir.c_str());
+    if (nullptr == dir)
+    {
+        return records;
+    }
+
+    const std::string suffix = CONTAINER_REAPER_JOURNAL_SUFFIX;
+    struct dirent* entry = nullptr;
+    while (nullptr != (entry = readdir(dir)))
+    {
+        const std::string name = entry->d_name;
+        if ((name.size() <= suffix.size()) || (name.compare(name.size() - suffix.size(), suffix.size(), suffix) != 0))
+        {
+            continue;
+        }
+
+        /* First line is the appInstanceId, the rest is the caller's record */
+        std::ifstream file(mJournalDir + name);
+        std::string appInstanceId;
+        if (!std::getline(file, appInstanceId) || appInstanceId.empty())
+        {
+            continue;
+        }
+        std::stringstream record;
+        record << file.rdbuf();
+
+        std::lock_guard<std::mutex> lock(mLock);
+        if (mJobs.find(appInstanceId) == mJobs.end())
+        {
+            records.emplace_back(appInstanceId, record.str());
+        }
+    }
+    closedir(dir);
+    return records;
+}
+
+bool ContainerReaper::submit(const std::string& appInstanceId, const std::string& record, const std::vector<Step>& steps, const CompletionFunction& done)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    if (mStopping || appInstanceId.empty())
+    {
+        return false;
+    }
+
+    journal(appInstanceId, record);
+
+    auto pending = mJobs.find(appInstanceId);
+    if (pending != mJobs.end())
+    {
+        /* The new steps run as soon as the one in flight returns, without waiting out a retry delay */
+        LOGINFO("Teardown of %s already pending, taking over its remaining steps", appInstanceId.c_str());
+        std::shared_ptr<Job>& job = pending->second;
+        job->steps = steps;
+        job->done = done;
+        job->nextStep = 0;
+        job->attempts = 0;
+        ++job->generation;
+        job->due = std::chrono::steady_clock::now();
+        mChanged.notify_all();
+        return true;
+    }
+
+    std::shared_ptr<Job> job = std::make_shared<Job>();
+    job->appInstanceId = appInstanceId;
+    job->steps = steps;
+    job->done = done;
+    job->nextStep = 0;
+    job->attempts = 0;
+    job->generation = 0;
+    job->due = std::chrono::steady_clock::now();
+    job->running = false;
+    mJobs[appInstanceId] = job;
+    mChanged.notify_all();
+    return true;
+}
+
+bool ContainerReaper::isPending(const std::string& appInstanceId) const
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mJobs.find(appInstanceId) != mJobs.end();
+}
+
+bool ContainerReaper::waitFor(const std::string& appInstanceId, uint32_t timeoutMs) const
+{
+    std::unique_lock<std::mutex> lock(mLock);
+    return mChanged.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this, &appInstanceId]() {
+        return mStopping || (mJobs.find(appInstanceId) == mJobs.end());
+    }) && (mJobs.find(appInstanceId) == mJobs.end());
+}
+
+size_t ContainerReaper::pending() const
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mJobs.size();
+}
+
+void ContainerReaper::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        mStopping = true;
+    }
+    mChanged.notify_all();
+    for (auto& worker : mWorkers)
+    {
+        if (worker.joinable())
+        {
+            worker.join();
+        }
+    }
+    mWorkers.clear();
+
+    std::lock_guard<std::mutex> lock(mLock);
+    if (!mJobs.empty())
+    {
+        LOGWARN("%zu teardowns left to the next start", mJobs.size());
+        mJobs.clear();
+    }
+}
+
+std::string ContainerReaper::journalPath(const std::string& appInstanceId) const
+{
+    std::string name = appInstanceId;
+    for (auto& c : name)
+    {
+        if (!isalnum(static_cast<unsigned char>(c)) && (c != '-') && (c != '_') && (c != '.'))
+        {
+            c = '_';
+        }
+    }
+    return mJournalDir + name + CONTAINER_REAPER_JOURNAL_SUFFIX;
+}
+
+void ContainerReaper::journal(const std::string& appInstanceId, const std::string& record) const
+{
+    /* Written to a temporary file and renamed, so a crash never leaves half a record */
+    const std::string path = journalPath(appInstanceId);
+    const std::string tmpPath = path + ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::out | std::ios::trunc);
+        file << appInstanceId << "\n" << record;
+    }
+    if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+    {
+        LOGWARN("Unable to journal teardown of %s (errno=%d)", appInstanceId.c_str(), errno);
+        std::remove(tmpPath.c_str());
+    }
+}
+
+void ContainerReaper::finish(const std::shared_ptr<Job>& job, const std::string& failedStep)
+{
+    std::remove(journalPath(job->appInstanceId).c_str());
+    mJobs.erase(job->appInstanceId);
+    if (failedStep.empty())
+    {
+        LOGINFO("Teardown of %s completed", job->appInstanceId.c_str());
+    }
+    else
+    {
+        LOGERR("Teardown of %s gave up at step %s", job->appInstanceId.c_str(), failedStep.c_str());
+    }
+}
+
+void ContainerReaper::workerLoop()
+{
+    std::unique_lock<std::mutex> lock(mLock);
+    while (!mStopping)
+    {
+        /* Take the idle teardown that is due first; sleep until one is due otherwise */
+        const auto now = std::chrono::steady_clock::now();
+        std::shared_ptr<Job> job;
+        bool haveWaiting = false;
+        std::chrono::steady_clock::time_point nextDue;
+        for (const auto& entry : mJobs)
+        {
+            const std::shared_ptr<Job>& candidate = entry.second;
+            if (candidate->running)
+            {
+                continue;
+            }
+            if (candidate->due <= now)
+            {
+                if (!job || candidate->due < job->due)
+                {
+                    job = candidate;
+                }
+            }
+            else if (!haveWaiting || candidate->due < nextDue)
+            {
+                nextDue = candidate->due;
+                haveWaiting = true;
+            }
+        }
+
+        if (!job)
+        {
+            if (haveWaiting)
+            {
+                mChanged.wait_until(lock, nextDue);
+            }
+            else
+            {
+                mChanged.wait(lock);
+            }
+            continue;
+        }
+
+        while ((job->nextStep < job->steps.size()) && (job->finished.count(job->steps[job->nextStep].name) > 0))
+        {
+            ++job->nextStep;
+        }
+        if (job->nextStep >= job->steps.size())
+        {
+            finish(job, "");
+            CompletionFunction done = job->done;
+            lock.unlock();
+            if (done)
+            {
+                done(job->appInstanceId, "");
+            }
+            lock.lock();
+            mChanged.notify_all();
+            continue;
+        }
+
+        job->running = true;
+        const Step step = job->steps[job->nextStep];
+        const uint32_t generation = job->generation;
+        lock.unlock();
+        const bool succeeded = !step.run || step.run();
+        lock.lock();
+        job->running = false;
+
+        if (succeeded)
+        {
+            /* Marked by name, as a submit may have replaced the steps meanwhile */
+            job->finished.insert(step.name);
+            job->attempts = 0;
+            job->due = std::chrono::steady_clock::now();
+        }
+        else if (generation != job->generation)
+        {
+            /* Failed under steps that were replaced meanwhile; run the new ones right away */
+            job->due = std::chrono::steady_clock::now();
+        }
+        else if (++job->attempts < mConfig.maxAttempts)
+        {
+            const uint64_t delayMs = static_cast<uint64_t>(mConfig.retryDelayMs) << (job->attempts - 1);
+            LOGWARN("Teardown step %s of %s failed, attempt %u of %u, retrying in %llu ms", step.name.c_str(),
+                    job->appInstanceId.c_str(), job->attempts, mConfig.maxAttempts, static_cast<unsigned long long>(delayMs));
+            job->due = std::chrono::steady_clock::now() + std::chrono::milliseconds(delayMs);
+        }
+        else
+        {
+            finish(job, step.name);
+            CompletionFunction done = job->done;
+            lock.unlock();
+            if (done)
+            {
+                done(job->appInstanceId, step.name);
+            }
+            lock.lock();
+        }
+        mChanged.notify_all();
+    }
+}
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,118 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    /*
+     * Runs container teardowns in the background. A teardown is a list of steps
+     * that are each retried with backoff until they succeed or run out of
+     * attempts; finished steps are not run again. At most a fixed number of
+     * teardowns run at once and there is only one per appInstanceId. Submitting
+     * again for a pending appInstanceId replaces the steps it has not finished,
+     * which is how a Kill escalates a Terminate that is still in progress.
+     *
+     * Every accepted teardown is journaled to disk with a caller supplied record
+     * until it completes, so that a restarted process can replay the teardowns
+     * it did not finish. Steps must therefore be safe to run again.
+     */
+    class ContainerReaper
+    {
+        public:
+            struct Step
+            {
+                std::string name;
+                std::function<bool()> run;
+            };
+
+            struct Config
+            {
+                uint32_t workers = 2;
+                uint32_t maxAttempts = 3;
+                uint32_t retryDelayMs = 200;     ///< doubled after every failed attempt
+            };
+
+            /* Called once per teardown; failedStep is empty on success */
+            typedef std::function<void(const std::string& appInstanceId, const std::string& failedStep)> CompletionFunction;
+
+            ContainerReaper(const Config& config, const std::string& journalDir = "/tmp/rdkappmanagers-teardown/");
+            ~ContainerReaper();
+
+            ContainerReaper(const ContainerReaper&) = delete;
+            ContainerReaper& operator=(const ContainerReaper&) = delete;
+
+            /* Returns the records of teardowns journaled by a previous run, as <appInstanceId, record> */
+            std::vector<std::pair<std::string, std::string>> unfinished() const;
+
+            /* A pending teardown takes over the new record, steps and completion; steps it already finished are skipped by name */
+            bool submit(const std::string& appInstanceId, const std::string& record, const std::vector<Step>& steps, const CompletionFunction& done);
+            bool isPending(const std::string& appInstanceId) const;
+            bool waitFor(const std::string& appInstanceId, uint32_t timeoutMs) const;
+            size_t pending() const;
+
+            /* Finishes the steps being run; queued teardowns stay journaled */
+            void stop();
+
+        private:
+            struct Job
+            {
+                std::string appInstanceId;
+                std::vector<Step> steps;
+                CompletionFunction done;
+                std::set<std::string> finished;  ///< names of the steps that succeeded
+                size_t nextStep;
+                uint32_t attempts;
+                uint32_t generation;             ///< bumped when a new submit replaces the steps
+                std::chrono::steady_clock::time_point due;
+                bool running;
+            };
+
+            void workerLoop();
+            std::string journalPath(const std::string& appInstanceId) const;
+            void journal(const std::string& appInstanceId, const std::string& record) const;
+            void finish(const std::shared_ptr<Job>& job, const std::string& failedStep);
+
+            const Config mConfig;
+            const std::string mJournalDir;
+
+            mutable std::mutex mLock;
+            mutable std::condition_variable mChanged;
+            std::map<std::string, std::shared_ptr<Job>> mJobs;   ///< appInstanceId -> queued or running teardown
+            bool mStopping;
+            std::vector<std::thread> mWorkers;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -20,7 +20,9 @@
 // Spec: entservices-appmanagers
 #include "DobbySpecGenerator.h"
 #include "ApplicationConfiguration.h"
+#include "OCIJsonWriter.h"
 #include "UtilsLogging.h"
+#include "WindowManagerCapabilities.h"
 #include <sys/mount.h>
 #include <sys/stat.h>
 #include <fcntl.h>
@@ -104,6 +106,53 @@ namespace
         return tokens;
     }
 
+    // Placeholders for the per-instance fields of a cached spec template
+    #define TEMPLATE_USER_ID "@RM_TEMPLATE_USER_ID@"
+    #define TEMPLATE_ENV "@RM_TEMPLATE_ENV@"
+    #define TEMPLATE_APP_INSTANCE_ID "@RM_TEMPLATE_APP_INSTANCE_ID@"
+    #define TEMPLATE_RIALTO_SOCKET "@RM_TEMPLATE_RIALTO_SOCKET@"
+    #define TEMPLATE_RESMGR_MOUNT "@RM_TEMPLATE_RESMGR_MOUNT@"
+
+    void replaceAll(std::string& text, const std::string& token, const std::string& value)
+    {
+        for (size_t pos = text.find(token); pos != std::string::npos; pos = text.find(token, pos + value.size()))
+        {
+            text.replace(pos, token.size(), value);
+        }
+    }
+
+    // Replaces an array element placeholder; an empty value drops the element with one neighbouring separator
+    void replaceListItem(std::string& text, const std::string& token, const std::string& value)
+    {
+        size_t pos = text.find(token);
+        if (pos == std::string::npos)
+        {
+            return;
+        }
+        size_t length = token.size();
+        if (value.empty())
+        {
+            if ((pos + length < text.size()) && (text[pos + length] == ','))
+            {
+                length++;
+            }
+            else if ((pos > 0) && (text[pos - 1] == ','))
+            {
+                pos--;
+                length++;
+            }
+        }
+        text.replace(pos, length, value);
+    }
+
+    // JSON string contents (without the quotes) as the spec writer would emit them
+    std::string escapeJsonString(const std::string& value)
+    {
+        std::string quoted;
+        OCIJsonWriter::appendQuoted(quoted, value.data(), value.size());
+        return quoted.substr(1, quoted.size() - 2);
+    }
+
     // Deep-merges overlay into base: objects are merged recursively,
     // all other types (scalars, arrays) are overwritten by the overlay value.
     void mergeJson(Json::Value& base, const Json::Value& overlay)
@@ -179,19 +228,92 @@ namespace
 
         return true;
     }
+
+    ssize_t sysMemoryLimit(AIConfiguration* aiConfiguration, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig)
+    {
+        ssize_t memoryLimit = runtimeConfig.systemMemoryLimit;
+        if ((memoryLimit <= 0) && (nullptr != aiConfiguration))
+        {
+            if (runtimeConfig.appType.compare("INTERACTIVE") == 0)
+            {
+                memoryLimit = aiConfiguration->getNonHomeAppMemoryLimit();
+            }
+            //TODO SUPPORT Add other application types
+        }
+        return memoryLimit;
+    }
+
+    ssize_t gpuMemoryLimit(AIConfiguration* aiConfiguration, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig)
+    {
+        ssize_t memoryLimit = runtimeConfig.gpuMemoryLimit;
+        if ((memoryLimit <= 0) && (nullptr != aiConfiguration))
+        {
+            if (runtimeConfig.appType.compare("INTERACTIVE") == 0)
+            {
+                memoryLimit = aiConfiguration->getNonHomeAppGpuLimit();
+            }
+            //TODO SUPPORT Add other application types
+        }
+        return memoryLimit;
+    }
+
+    std::string cpuCores(AIConfiguration& aiConfiguration)
+    {
+        const int nCores = std::min(32, get_nprocs());
+        std::bitset<32> cpuSetBitmask = aiConfiguration.getAppsCpuSet();
+        cpuSetBitmask &= ((0x1U << nCores) - 1);
+        // check the bitmask so that we have at least one core enabled
+        if (cpuSetBitmask.none())
+        {
+            cpuSetBitmask = ((0x1U << nCores) - 1);
+        }
+
+        // create the json string for the cores to enable
+        std::ostringstream coresStream;
+        for (int core = 0; core < nCores; core++)
+        {
+            if (cpuSetBitmask.test(core))
+            {
+                coresStream << core << ",";
+            }
+        }
+
+        // get the string and remove trailing ','
+        std::string coresStr = coresStream.str();
+        if (!coresStr.empty())
+            coresStr.pop_back();
+
+        return coresStr;
+    }
+
+    void parseEnvVariables(const std::string& serializedEnv, std::vector<std::string>& envVariables)
+    {
+        envVariables.clear();
+
+        JsonArray envInputArray;
+        envInputArray.FromString(serializedEnv);
+        for (unsigned int i = 0; i < envInputArray.Length(); ++i)
+        {
+            envVariables.push_back(envInputArray[i].String());
+        }
+    }
 }
 
 DobbySpecGenerator::DobbySpecGenerator(AIConfiguration& aiConfiguration)
-    : mIonMemoryPluginData(Json::objectValue)
+    : mIonDefaultLimit(0)
+    , mIonHeaps()
     , mPackageMountPoint("/package")
     , mRuntimeMountPoint("/runtime")
     , mGstRegistrySourcePath("")
     , mGstRegistryDestinationPath("/tmp/gstreamer-cached-registry.bin")
+    , mResourceManagerSocketPath(aiConfiguration.getResourceManagerClientEnabled() ? XDG_RUNTIME_DIR "/resource" : "")
+    , mTemplateCache(nullptr)
+    , mLaunchProfile(nullptr)
     , mDefaultLoggingMask(0)
 {
     LOGINFO("DobbySpecGenerator()");
     mAIConfiguration = &aiConfiguration;
-    initialiseIonHeapsJson();
+    initialiseIonHeaps();
     initialiseDefaultLogLevels();
 }
 
@@ -210,7 +332,35 @@ void DobbySpecGenerator::setGstreamerRegistryPath(const std::string& registryPat
     }
 }
 
-Json::Value DobbySpecGenerator::getWorkingDir(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const
+void DobbySpecGenerator::setResourceManagerSocketPath(const std::string& socketPath)
+{
+    mResourceManagerSocketPath = socketPath;
+}
+
+void DobbySpecGenerator::setTemplateCache(DobbySpecTemplateCache* cache)
+{
+    mTemplateCache = cache;
+}
+
+void DobbySpecGenerator::setLaunchProfile(const LaunchProfile* profile)
+{
+    mLaunchProfile = profile;
+}
+
+void DobbySpecGenerator::buildLaunchProfile(AIConfiguration* aiConfiguration,
+                                            const WPEFramework::Exchange::RuntimeConfig& runtimeConfig,
+                                            LaunchProfile& profile)
+{
+    parseCapabilities(runtimeConfig.capabilities, profile.capabilities);
+    profile.windowManagerCapabilities = buildWindowManagerCapabilities(runtimeConfig.capabilities);
+    profile.requiresRialto = hasCapability(profile.capabilities, "rialto");
+    profile.sysMemoryLimit = sysMemoryLimit(aiConfiguration, runtimeConfig);
+    profile.gpuMemoryLimit = gpuMemoryLimit(aiConfiguration, runtimeConfig);
+    profile.cpuCores = (nullptr != aiConfiguration) ? cpuCores(*aiConfiguration) : std::string();
+    parseEnvVariables(runtimeConfig.envVariables, profile.envVariables);
+}
+
+std::string DobbySpecGenerator::getWorkingDir(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const
 {
     // default to the package directory
     std::string workingDir(mPackageMountPoint);
@@ -224,7 +374,7 @@ Json::Value DobbySpecGenerator::getWorkingDir(const ApplicationConfiguration& co
 
     free(execFilePathCopy);
     */
-    return Json::Value(workingDir);
+    return workingDir;
 }
 
 bool DobbySpecGenerator::generate(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, string& resultSpec)
@@ -232,8 +382,13 @@ bool DobbySpecGenerator::generate(const ApplicationConfiguration& config, const
     LOGINFO("DobbySpecGenerator::generate()");
     resultSpec = "";
 
-    std::vector<std::pair<std::string, std::string>> parsedCapabilities;
-    parseCapabilities(runtimeConfig.capabilities, parsedCapabilities);
+    std::vector<std::pair<std::string, std::string>> localCapabilities;
+    if (nullptr == mLaunchProfile)
+    {
+        parseCapabilities(runtimeConfig.capabilities, localCapabilities);
+    }
+    const std::vector<std::pair<std::string, std::string>>& parsedCapabilities =
+        (nullptr != mLaunchProfile) ? mLaunchProfile->capabilities : localCapabilities;
 
     std::ifstream inFile("/tmp/specchange");
     if (inFile.good())
@@ -257,11 +412,59 @@ bool DobbySpecGenerator::generate(const ApplicationConfiguration& config, const
         return false;
     }
 
-    Json::Value spec;
-    spec["version"] = "1.1";
-    spec["memLimit"] = std::move(memLimit);
+    if (nullptr == mTemplateCache)
+    {
+        if (!buildSpec(config, runtimeConfig, parsedCapabilities, memLimit, false, resultSpec))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        const std::string templateKey = getTemplateKey(config, runtimeConfig);
+        std::string specTemplate;
+        if (!mTemplateCache->find(templateKey, specTemplate))
+        {
+            // Build the template with placeholders in place of the per-instance fields
+            ApplicationConfiguration templateConfig(config);
+            templateConfig.mAppInstanceId = TEMPLATE_APP_INSTANCE_ID;
+            if (!templateConfig.mRialtoSocketPath.empty())
+            {
+                templateConfig.mRialtoSocketPath = TEMPLATE_RIALTO_SOCKET;
+            }
+            WPEFramework::Exchange::RuntimeConfig templateRuntimeConfig(runtimeConfig);
+            templateRuntimeConfig.envVariables = "[\"" TEMPLATE_ENV "\"]";
+
+            if (!buildSpec(templateConfig, templateRuntimeConfig, parsedCapabilities, memLimit, true, specTemplate))
+            {
+                return false;
+            }
+            mTemplateCache->insert(templateKey, specTemplate);
+            LOGINFO("Cached Dobby spec template for appId=%s", config.mAppId.c_str());
+        }
+        resultSpec = patchTemplate(specTemplate, config, runtimeConfig);
+    }
+#ifdef RDK_APPMANAGERS_DEBUG
+    LOGINFO("spec: '%s'\n", resultSpec.c_str());
+
+    std::ofstream generatedSpecFile;
+    generatedSpecFile.open("/tmp/generatedSpec.json");
+    generatedSpecFile << resultSpec.c_str();
+    generatedSpecFile.close();
+#endif
+
+    return true;
+}
+
+bool DobbySpecGenerator::buildSpec(const ApplicationConfiguration& config,
+                                   const WPEFramework::Exchange::RuntimeConfig& runtimeConfig,
+                                   const std::vector<std::pair<std::string, std::string>>& parsedCapabilities,
+                                   ssize_t memLimit, bool asTemplate, std::string& resultSpec)
+{
+    DobbySpecModel spec;
+    spec.version = "1.1";
+    spec.memLimit = memLimit;
 
-    Json::Value args(Json::arrayValue);
     std::string command ="";
     if(!runtimeConfig.runtimePath.empty())
     {
@@ -272,121 +475,113 @@ bool DobbySpecGenerator::generate(const ApplicationConfiguration& config, const
         command = "/package/";
     }
     command.append(runtimeConfig.command);
-    args.append(command);
-    spec["args"] = std::move(args);
-    spec["cwd"] = getWorkingDir(config, runtimeConfig);
+    spec.args.push_back(std::move(command));
+    spec.cwd = getWorkingDir(config, runtimeConfig);
     if (shouldEnableGpu(config))
     {
-        Json::Value gpuObj(Json::objectValue);
-        gpuObj["enable"] = true;
-        gpuObj["memLimit"] = getGPUMemoryLimit(config, runtimeConfig);
-        spec["gpu"] = std::move(gpuObj);
+        spec.gpu = true;
+        spec.gpuMemLimit = getGPUMemoryLimit(config, runtimeConfig);
     }
-    spec["restartOnCrash"] = false;
+    spec.restartOnCrash = false;
+    spec.vpu = getVpuEnabled(config, runtimeConfig, parsedCapabilities);
 
-    Json::Value vpuObj;
-    vpuObj["enable"] = getVpuEnabled(config, runtimeConfig, parsedCapabilities);
-    spec["vpu"] = std::move(vpuObj);
-    
     //TODO CHECK FOR OPTIMIZATION
-    std::list<std::string> dbusRequiringApps = mAIConfiguration->getAppsRequiringDBus(); 
+    std::list<std::string> dbusRequiringApps = mAIConfiguration->getAppsRequiringDBus();
     for (auto it = dbusRequiringApps.begin(); it != dbusRequiringApps.end(); ++it)
     {
         std::string appId = *it;
         if (appId.compare(config.mAppId) == 0)
 	{
-            Json::Value dbusObj(Json::objectValue);
-            dbusObj["system"] = "system";
-            spec["dbus"] = std::move(dbusObj);
+            spec.systemDbus = true;
 	}
     }
-    Json::Value cpuObj;
-    cpuObj["cores"] = getCpuCores();
-    spec["cpu"] = std::move(cpuObj);
+    spec.cpuCores = getCpuCores();
 
 #ifdef RDK_APPMANAGERS_DEBUG
     if (!runtimeConfig.logFilePath.empty())
     {
-        Json::Value consoleObj;
-        consoleObj["path"] = runtimeConfig.logFilePath;
-        consoleObj["limit"] = (0 < runtimeConfig.logFileMaxSize)
+        spec.console = true;
+        spec.consolePath = runtimeConfig.logFilePath;
+        spec.consoleLimit = (0 < runtimeConfig.logFileMaxSize)
             ? runtimeConfig.logFileMaxSize
             : static_cast<uint32_t>(mAIConfiguration->getContainerConsoleLogCap());
-        spec["console"] = std::move(consoleObj);
     }
 #endif // RDK_APPMANAGERS_DEBUG
 
-    Json::Value etcObj;
-    Json::Value hostsArray(Json::arrayValue);
-    Json::Value servicesArray(Json::arrayValue);
     // always add a local host entry
-    hostsArray.append("127.0.0.1\tlocalhost");
+    spec.etcHosts.push_back("127.0.0.1\tlocalhost");
 
     // add some common services for the app
-    servicesArray.append("ftp\t\t21/tcp");
-    servicesArray.append("domain\t\t53/tcp");
-    servicesArray.append("domain\t\t53/udp");
-    servicesArray.append("http\t\t80/tcp\t\twww");
-    servicesArray.append("http\t\t80/udp");
-    servicesArray.append("ntp\t\t123/udp");
-    servicesArray.append("https\t\t443/tcp");
-    servicesArray.append("https\t\t443/udp");
+    spec.etcServices = {
+        "ftp\t\t21/tcp",
+        "domain\t\t53/tcp",
+        "domain\t\t53/udp",
+        "http\t\t80/tcp\t\twww",
+        "http\t\t80/udp",
+        "ntp\t\t123/udp",
+        "https\t\t443/tcp",
+        "https\t\t443/udp",
+    };
 
     const bool mapiEnabled = runtimeConfig.mapi || hasCapability(parsedCapabilities, "mapi");
     if (mapiEnabled)
     {
         for (int port : mAIConfiguration->getMapiPorts())
         {
-            servicesArray.append("mapi\t\t" + std::to_string(port) + "/tcp");
+            spec.etcServices.push_back("mapi\t\t" + std::to_string(port) + "/tcp");
         }
     }
 
-    Json::Value preloadsArray(Json::arrayValue);
     //TODO CHECK FOR OPTIMIZATION
     std::list<std::string> preloads = mAIConfiguration->getPreloads();
-    for (auto it = preloads.begin(); it != preloads.end(); ++it)
-    {
-        preloadsArray.append(*it);
-    }
-
-    etcObj["hosts"] = hostsArray;
-    etcObj["services"] = servicesArray;
-    etcObj["ld-preload"] = preloadsArray;
-    spec["etc"] = std::move(etcObj);
+    spec.etcLdPreload.assign(preloads.begin(), preloads.end());
 
     const bool wanLanEnabled = runtimeConfig.wanLanAccess || hasCapability(parsedCapabilities, "wan-lan");
     if (wanLanEnabled)
     {
-        spec["network"] = "nat";
+        spec.network = "nat";
     }
     else
     {
-        spec["network"] = "private";
+        spec.network = "private";
+    }
+    if (asTemplate)
+    {
+        spec.uidPlaceholder = TEMPLATE_USER_ID;
     }
-    Json::Value userObj;
-    userObj["uid"] = config.mUserId;
-    userObj["gid"] = config.mGroupId;
-    spec["user"] = std::move(userObj);
+    else
+    {
+        spec.uid = config.mUserId;
+    }
+    spec.gid = config.mGroupId;
 
-    //spec["plugins"] = populateClassicPlugins(config, runtimeConfig);
     populateClassicPlugins(config, runtimeConfig, spec);
-    spec["rdkPlugins"] = createRdkPlugins(config, runtimeConfig, parsedCapabilities);
-    spec["mounts"] = createMounts(config, runtimeConfig);
-    spec["env"] = createEnvVars(config, runtimeConfig, parsedCapabilities);
+    createRdkPlugins(config, runtimeConfig, parsedCapabilities, spec);
+    spec.mounts = createMounts(config, runtimeConfig, asTemplate);
+    spec.env = createEnvVars(config, runtimeConfig, parsedCapabilities);
 
+    const std::string additionalConfigStr = getCapabilityValue(parsedCapabilities, "additionalconfig");
+    const std::string capSpecStr = getCapabilityValue(parsedCapabilities, "spec");
+    if (additionalConfigStr.empty() && capSpecStr.empty())
+    {
+        OCIJsonWriter writer;
+        spec.write(writer);
+        resultSpec = writer.finish();
+        return true;
+    }
 
-    Json::FastWriter writer;
+    // The capability overlays are arbitrary JSON, so only they need the spec as a document
+    Json::Value document = spec.toJson();
 
     // apply additionalconfig capability overlay onto the spec (last step, so it
     // can override any field set above — mirrors the extramounts pattern)
-    const std::string additionalConfigStr = getCapabilityValue(parsedCapabilities, "additionalconfig");
     if (!additionalConfigStr.empty())
     {
         Json::Value overlay;
         Json::Reader overlayReader;
         if (overlayReader.parse(additionalConfigStr, overlay))
         {
-            mergeJson(spec, overlay);
+            mergeJson(document, overlay);
             LOGINFO("additionalconfig overlay applied to Dobby spec");
         }
         else
@@ -400,14 +595,13 @@ bool DobbySpecGenerator::generate(const ApplicationConfiguration& config, const
     // nested key present in the capability JSON that is absent from the already-
     // generated spec is added. Keys already set (including by additionalconfig)
     // are never replaced.
-    const std::string capSpecStr = getCapabilityValue(parsedCapabilities, "spec");
     if (!capSpecStr.empty())
     {
         Json::Value capSpec;
         Json::Reader capSpecReader;
         if (capSpecReader.parse(capSpecStr, capSpec))
         {
-            fillMissingJson(spec, capSpec);
+            fillMissingJson(document, capSpec);
             LOGINFO("'spec' capability fill applied to Dobby spec");
         }
         else
@@ -417,25 +611,99 @@ bool DobbySpecGenerator::generate(const ApplicationConfiguration& config, const
         }
     }
 
-    resultSpec = writer.write(spec);
-#ifdef RDK_APPMANAGERS_DEBUG
-    LOGINFO("spec: '%s'\n", resultSpec.c_str());
-
-    std::ofstream generatedSpecFile;
-    generatedSpecFile.open("/tmp/generatedSpec.json");
-    generatedSpecFile << resultSpec.c_str();
-    generatedSpecFile.close();
-#endif
+    resultSpec = OCIJsonWriter::write(document);
 
     return true;
 }
 
-Json::Value DobbySpecGenerator::createEnvVars(const ApplicationConfiguration& config,
-                                              const WPEFramework::Exchange::RuntimeConfig& runtimeConfig,
-                                              const std::vector<std::pair<std::string, std::string>>& capabilities) const
+std::string DobbySpecGenerator::getTemplateKey(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const
+{
+    // Every input that shapes the spec, except the fields patchTemplate() fills in.
+    // The package paths change with the app version.
+    const char separator = '\x1f';
+    std::ostringstream key;
+    key << config.mAppId << separator
+        << runtimeConfig.appPath << separator
+        << runtimeConfig.runtimePath << separator
+        << runtimeConfig.unpackedPath << separator
+        << runtimeConfig.capabilities << separator
+        << runtimeConfig.command << separator
+        << runtimeConfig.appType << separator
+        << runtimeConfig.systemMemoryLimit << separator
+        << runtimeConfig.gpuMemoryLimit << separator
+        << runtimeConfig.logLevels << separator
+        << runtimeConfig.dial << separator
+        << runtimeConfig.dialId << separator
+        << runtimeConfig.mapi << separator
+        << runtimeConfig.wanLanAccess << separator
+        << runtimeConfig.fkpsFiles << separator
+        << runtimeConfig.logFilePath << separator
+        << runtimeConfig.logFileMaxSize << separator
+        << config.mGroupId << separator
+        << config.mWesterosSocketPath.empty() << separator
+        << config.mRialtoSocketPath.empty() << separator
+        << mGstRegistrySourcePath << separator
+        << mResourceManagerSocketPath;
+    return key.str();
+}
+
+std::string DobbySpecGenerator::patchTemplate(const std::string& specTemplate,
+                                              const ApplicationConfiguration& config,
+                                              const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const
+{
+    std::string spec(specTemplate);
+
+    replaceAll(spec, "\"" TEMPLATE_USER_ID "\"", std::to_string(config.mUserId));
+
+    // The env placeholder stands for the whole runtimeConfig.envVariables list
+    std::vector<std::string> localEnvVariables;
+    if (nullptr == mLaunchProfile)
+    {
+        parseEnvVariables(runtimeConfig.envVariables, localEnvVariables);
+    }
+    const std::vector<std::string>& envVariables =
+        (nullptr != mLaunchProfile) ? mLaunchProfile->envVariables : localEnvVariables;
+
+    std::string envList;
+    for (const std::string& envValue : envVariables)
+    {
+        if (!envList.empty())
+        {
+            envList.push_back(',');
+        }
+        OCIJsonWriter::appendQuoted(envList, envValue.data(), envValue.size());
+    }
+    replaceListItem(spec, "\"" TEMPLATE_ENV "\"", envList);
+
+    // The resource manager socket is checked and handed to the app's group on every
+    // launch, a cached template may have been built for an app with another gid
+    const std::string resmgrToken("\"" TEMPLATE_RESMGR_MOUNT "\"");
+    if (spec.find(resmgrToken) != std::string::npos)
+    {
+        std::string resmgrMountText;
+        const DobbySpecMount resmgrMount = createResourceManagerMount(config);
+        if (!resmgrMount.type.empty())
+        {
+            OCIJsonWriter writer(256);
+            resmgrMount.write(writer);
+            resmgrMountText = writer.finish();
+            resmgrMountText.pop_back();
+        }
+        replaceListItem(spec, resmgrToken, resmgrMountText);
+    }
+
+    replaceAll(spec, TEMPLATE_APP_INSTANCE_ID, escapeJsonString(config.mAppInstanceId));
+    replaceAll(spec, TEMPLATE_RIALTO_SOCKET, escapeJsonString(config.mRialtoSocketPath));
+
+    return spec;
+}
+
+std::vector<std::string> DobbySpecGenerator::createEnvVars(const ApplicationConfiguration& config,
+                                                           const WPEFramework::Exchange::RuntimeConfig& runtimeConfig,
+                                                           const std::vector<std::pair<std::string, std::string>>& capabilities) const
 {
-    Json::Value env(Json::arrayValue);
-    env.append(std::string("APPLICATION_NAME=") + config.mAppId);
+    std::vector<std::string> env;
+    env.push_back(std::string("APPLICATION_NAME=") + config.mAppId);
     
      //TODO YET TO ANALYZE SUPPORT APPLICATION_LAUNCH_PARAMETERS
      //TODO YET TO ANALYZE SUPPORT APPLICATION_LAUNCH_METHOD
@@ -446,33 +714,33 @@ Json::Value DobbySpecGenerator::createEnvVars(const ApplicationConfiguration& co
    for (unsigned int i = 0; i < envInputArray.Length(); ++i)
    {
        std::string envInputItem = envInputArray[i].String();
-       env.append(envInputArray[i].String());
+       env.push_back(envInputArray[i].String());
    }
 
    std::list<std::string> configEnvs = mAIConfiguration->getEnvs();
    for (auto it = configEnvs.begin(); it != configEnvs.end(); ++it)
    {
-       env.append(*it);
+       env.push_back(*it);
    }
 
    if (!config.mWesterosSocketPath.empty())
    {
-       env.append("XDG_RUNTIME_DIR=/tmp");
-       env.append("WAYLAND_DISPLAY=westeros");
-       env.append("WESTEROS_SINK_VIRTUAL_WIDTH=1920");
-       env.append("WESTEROS_SINK_VIRTUAL_HEIGHT=1080");
-       env.append("QT_WAYLAND_CLIENT_BUFFER_INTEGRATION=wayland-egl");
-       env.append("QT_WAYLAND_SHELL_INTEGRATION=wl-simple-shell");
-       env.append("QT_QPA_PLATFORM=wayland-sky-rdk");
+       env.push_back("XDG_RUNTIME_DIR=/tmp");
+       env.push_back("WAYLAND_DISPLAY=westeros");
+       env.push_back("WESTEROS_SINK_VIRTUAL_WIDTH=1920");
+       env.push_back("WESTEROS_SINK_VIRTUAL_HEIGHT=1080");
+       env.push_back("QT_WAYLAND_CLIENT_BUFFER_INTEGRATION=wayland-egl");
+       env.push_back("QT_WAYLAND_SHELL_INTEGRATION=wl-simple-shell");
+       env.push_back("QT_QPA_PLATFORM=wayland-sky-rdk");
    }
-   env.append(std::string("APPLICATION_TOKEN=") + config.mAppInstanceId);
+   env.push_back(std::string("APPLICATION_TOKEN=") + config.mAppInstanceId);
    if (mAIConfiguration->getResourceManagerClientEnabled())
    {
-       env.append("ESSRMGR_APPID=" + config.mAppId);
-       env.append("CLIENT_IDENTIFIER=" + config.mAppId);
+       env.push_back("ESSRMGR_APPID=" + config.mAppId);
+       env.push_back("CLIENT_IDENTIFIER=" + config.mAppId);
        if (!config.mWesterosSocketPath.empty())
        {
-           env.append("WESTEROS_SINK_USE_ESSRMGR=1");
+           env.push_back("WESTEROS_SINK_USE_ESSRMGR=1");
        }
    }	     
 
@@ -484,7 +752,7 @@ Json::Value DobbySpecGenerator::createEnvVars(const ApplicationConfiguration& co
        {
            dialId = getCapabilityValue(capabilities, "dial-app");
        }
-       env.append(std::string("APPLICATION_DIAL_NAME=") + dialId);
+       env.push_back(std::string("APPLICATION_DIAL_NAME=") + dialId);
        std::ostringstream dataUrlStream;
        dataUrlStream << "http://127.0.0.1:"
                      << mAIConfiguration->getDialServerPort() << '/'
@@ -493,8 +761,8 @@ Json::Value DobbySpecGenerator::createEnvVars(const ApplicationConfiguration& co
                      << "dial_data";
 
        std::string dataUrl = encodeURL(dataUrlStream.str());
-       env.append(std::string("ADDITIONAL_DATA_URL=") + dataUrl);
-       env.append(std::string("DIAL_USN=") + mAIConfiguration->getDialUsn());
+       env.push_back(std::string("ADDITIONAL_DATA_URL=") + dataUrl);
+       env.push_back(std::string("DIAL_USN=") + mAIConfiguration->getDialUsn());
    }
 
    #ifdef ENABLE_RIALTO
@@ -502,14 +770,14 @@ Json::Value DobbySpecGenerator::createEnvVars(const ApplicationConfiguration& co
    {
        // Pass Rialto socket path used by RialtoClient to communicate with RialtoSessionServer
        LOGINFO("Injecting RIALTO_SOCKET_PATH=%s into container env", config.mRialtoSocketPath.c_str());
-       env.append(std::string("RIALTO_SOCKET_PATH=") + config.mRialtoSocketPath);
+       env.push_back(std::string("RIALTO_SOCKET_PATH=") + config.mRialtoSocketPath);
    }
    else
    #endif
    if (!mGstRegistrySourcePath.empty())
    {
-       env.append("GST_REGISTRY=" + mGstRegistryDestinationPath);
-       env.append("GST_REGISTRY_UPDATE=no");
+       env.push_back("GST_REGISTRY=" + mGstRegistryDestinationPath);
+       env.push_back("GST_REGISTRY_UPDATE=no");
    }
 
    //TODO SUPPORT WATCHDOG
@@ -518,41 +786,50 @@ Json::Value DobbySpecGenerator::createEnvVars(const ApplicationConfiguration& co
 
    if (webRuntime)
    {
-       env.append("WEBKIT_LEGACY_INSPECTOR_SERVER=0.0.0.0:22222");
+       env.push_back("WEBKIT_LEGACY_INSPECTOR_SERVER=0.0.0.0:22222");
    }
 
    return env;
 }
 
-Json::Value DobbySpecGenerator::createMounts(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const
+std::vector<DobbySpecMount> DobbySpecGenerator::createMounts(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, bool asTemplate) const
 {
-    Json::Value mounts(Json::arrayValue);
+    std::vector<DobbySpecMount> mounts;
 
     if (!runtimeConfig.appPath.empty())
     {
-        mounts.append(createBindMount(runtimeConfig.appPath, mPackageMountPoint, MS_BIND | MS_RDONLY | MS_NOSUID | MS_NODEV));
+        mounts.push_back(createBindMount(runtimeConfig.appPath, mPackageMountPoint, MS_BIND | MS_RDONLY | MS_NOSUID | MS_NODEV));
     }
 
     if (!runtimeConfig.runtimePath.empty())
     {
-        mounts.append(createBindMount(runtimeConfig.runtimePath, mRuntimeMountPoint, MS_BIND | MS_RDONLY | MS_NOSUID | MS_NODEV));
+        mounts.push_back(createBindMount(runtimeConfig.runtimePath, mRuntimeMountPoint, MS_BIND | MS_RDONLY | MS_NOSUID | MS_NODEV));
     }
 
-    mounts.append(createBindMount("/etc/ssl/certs", "/etc/ssl/certs",
+    mounts.push_back(createBindMount("/etc/ssl/certs", "/etc/ssl/certs",
                                (MS_BIND | MS_RDONLY | MS_NOSUID | MS_NODEV)));
 
-    mounts.append(createPrivateDataMount(runtimeConfig));
+    mounts.push_back(createPrivateDataMount(runtimeConfig));
     
     createFkpsMounts(config, runtimeConfig, mounts);
 
     if (!config.mWesterosSocketPath.empty())
     {
-        if (mAIConfiguration->getResourceManagerClientEnabled())
+        if (!mResourceManagerSocketPath.empty())
         {
             // bind mount the resource manager socket into the container
-            Json::Value resmgrMount = createResourceManagerMount(config);
-            if (!resmgrMount.isNull())
-                mounts.append(std::move(resmgrMount));
+            if (asTemplate)
+            {
+                DobbySpecMount placeholder;
+                placeholder.placeholder = TEMPLATE_RESMGR_MOUNT;
+                mounts.push_back(std::move(placeholder));
+            }
+            else
+            {
+                DobbySpecMount resmgrMount = createResourceManagerMount(config);
+                if (!resmgrMount.type.empty())
+                    mounts.push_back(std::move(resmgrMount));
+            }
         }
     }
 
@@ -561,7 +838,7 @@ Json::Value DobbySpecGenerator::createMounts(const ApplicationConfiguration& con
     {
         LOGINFO("Adding Rialto socket bind mount: source='%s' destination='%s'", config.mRialtoSocketPath.c_str(), config.mRialtoSocketPath.c_str());
         // Bind mount the Rialto socket into the container so the app can connect to its RialtoServer instance
-        mounts.append(createBindMount(config.mRialtoSocketPath, config.mRialtoSocketPath,
+        mounts.push_back(createBindMount(config.mRialtoSocketPath, config.mRialtoSocketPath,
                                       MS_BIND | MS_NOSUID | MS_NODEV));
     }
     else
@@ -570,7 +847,7 @@ Json::Value DobbySpecGenerator::createMounts(const ApplicationConfiguration& con
         // Mount the pre-scanned GStreamer registry only when Rialto is NOT active;
         if (!mGstRegistrySourcePath.empty())
         {
-            mounts.append(createBindMount(mGstRegistrySourcePath,
+            mounts.push_back(createBindMount(mGstRegistrySourcePath,
                                                mGstRegistryDestinationPath,
                                                (MS_BIND | MS_NOSUID | MS_NODEV | MS_NOEXEC | MS_RDONLY)));
         }
@@ -578,7 +855,7 @@ Json::Value DobbySpecGenerator::createMounts(const ApplicationConfiguration& con
     #else
     if (!mGstRegistrySourcePath.empty())
     {
-        mounts.append(createBindMount(mGstRegistrySourcePath,
+        mounts.push_back(createBindMount(mGstRegistrySourcePath,
                                            mGstRegistryDestinationPath,
                                            (MS_BIND | MS_NOSUID | MS_NODEV | MS_NOEXEC | MS_RDONLY)));
     }
@@ -601,7 +878,7 @@ Json::Value DobbySpecGenerator::createMounts(const ApplicationConfiguration& con
             {
             LOGINFO("Applying extraMounts mount source=%s destination=%s for appId=%s",
                 extraMount.source.c_str(), extraMount.destination.c_str(), config.mAppId.c_str());
-            mounts.append(createBindMount(extraMount.source,
+            mounts.push_back(createBindMount(extraMount.source,
                               extraMount.destination,
                               extraMount.mountFlags));
             }
@@ -617,17 +894,15 @@ Json::Value DobbySpecGenerator::createMounts(const ApplicationConfiguration& con
     return mounts;
 }
 
-Json::Value DobbySpecGenerator::createBindMount(const std::string& source,
-                                                const std::string& destination,
-                                                unsigned long mountFlags) const
+DobbySpecMount DobbySpecGenerator::createBindMount(const std::string& source,
+                                                   const std::string& destination,
+                                                   unsigned long mountFlags) const
 {
-    Json::Value mount(Json::objectValue);
-
-    mount["source"] = source;
-    mount["destination"] = destination;
-    mount["type"] = "bind";
+    DobbySpecMount mount;
 
-    Json::Value mountOptions(Json::arrayValue);;
+    mount.source = source;
+    mount.destination = destination;
+    mount.type = "bind";
 
     static const std::vector<std::pair<unsigned long, std::string>> mountFlagsNames =
     {
@@ -652,7 +927,7 @@ Json::Value DobbySpecGenerator::createBindMount(const std::string& source,
         const unsigned long mountFlag = entry.first;
         if ((mountFlag & mountFlags) == mountFlag)
         {
-            mountOptions.append(entry.second);
+            mount.options.push_back(entry.second);
 
             // clear the mount flags bit such that we can display a warning
             // if the caller supplies a flag we don't support
@@ -666,8 +941,6 @@ Json::Value DobbySpecGenerator::createBindMount(const std::string& source,
         LOGWARN("unsupported mount flag(s) 0x%04lx", mountFlags);
     }
 
-    mount["options"] = std::move(mountOptions);
-    
     return mount;
 }
 
@@ -789,33 +1062,23 @@ std::string DobbySpecGenerator::getCapabilityValue(const std::vector<std::pair<s
 
 ssize_t DobbySpecGenerator::getSysMemoryLimit(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const
 {
-    ssize_t memoryLimit = runtimeConfig.systemMemoryLimit;
-    if (memoryLimit <= 0)
+    if (nullptr != mLaunchProfile)
     {
-        if (runtimeConfig.appType.compare("INTERACTIVE") == 0)
-	{
-            memoryLimit = mAIConfiguration->getNonHomeAppMemoryLimit();
-        }
-        //TODO SUPPORT Add other application types
+        return mLaunchProfile->sysMemoryLimit;
     }
-    return memoryLimit;
+    return sysMemoryLimit(mAIConfiguration, runtimeConfig);
 }
 
 ssize_t DobbySpecGenerator::getGPUMemoryLimit(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const
 {
-    ssize_t gpuMemoryLimit = runtimeConfig.gpuMemoryLimit;
-    if (gpuMemoryLimit <= 0)
+    if (nullptr != mLaunchProfile)
     {
-        if (runtimeConfig.appType.compare("INTERACTIVE") == 0)
-	{
-            gpuMemoryLimit = mAIConfiguration->getNonHomeAppGpuLimit();
-        }
-        //TODO SUPPORT Add other application types
+        return mLaunchProfile->gpuMemoryLimit;
     }
-    return gpuMemoryLimit;
+    return gpuMemoryLimit(mAIConfiguration, runtimeConfig);
 }
 
-bool DobbySpecGenerator::getVpuEnabled(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, std::vector<std::pair<std::string, std::string>>& capabilities) const
+bool DobbySpecGenerator::getVpuEnabled(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, const std::vector<std::pair<std::string, std::string>>& capabilities) const
 {
 #ifdef ENABLE_RIALTO
     if (!config.mRialtoSocketPath.empty())
@@ -842,40 +1105,21 @@ bool DobbySpecGenerator::getVpuEnabled(const ApplicationConfiguration& config, c
 
 std::string DobbySpecGenerator::getCpuCores()
 {
-    const int nCores = std::min(32, get_nprocs());
-    std::bitset<32> cpuSetBitmask = mAIConfiguration->getAppsCpuSet();
-    cpuSetBitmask &= ((0x1U << nCores) - 1);
-    // check the bitmask so that we have at least one core enabled
-    if (cpuSetBitmask.none())
-    {
-        cpuSetBitmask = ((0x1U << nCores) - 1);
-    }
-
-    // create the json string for the cores to enable
-    std::ostringstream coresStream;
-    for (int core = 0; core < nCores; core++)
+    if ((nullptr != mLaunchProfile) && !mLaunchProfile->cpuCores.empty())
     {
-        if (cpuSetBitmask.test(core))
-        {
-            coresStream << core << ",";
-        }
+        return mLaunchProfile->cpuCores;
     }
-
-    // get the string and remove trailing ','
-    std::string coresStr = coresStream.str();
-    if (!coresStr.empty())
-        coresStr.pop_back();
-
-    return coresStr;
+    return cpuCores(*mAIConfiguration);
 }
 
-Json::Value DobbySpecGenerator::createRdkPlugins(const ApplicationConfiguration& config,
-                                                 const WPEFramework::Exchange::RuntimeConfig& runtimeConfig,
-                                                 const std::vector<std::pair<std::string, std::string>>& capabilities) const
+void DobbySpecGenerator::createRdkPlugins(const ApplicationConfiguration& config,
+                                          const WPEFramework::Exchange::RuntimeConfig& runtimeConfig,
+                                          const std::vector<std::pair<std::string, std::string>>& capabilities,
+                                          DobbySpecModel& spec) const
 {
-    Json::Value rdkPluginsObj(Json::objectValue);
-    rdkPluginsObj["ionmemory"] = createIonMemoryPlugin();
-    rdkPluginsObj["minidump"] = createMinidumpPlugin();
+    spec.ionDefaultLimit = mIonDefaultLimit;
+    spec.ionHeaps = mIonHeaps;
+    spec.minidumpDestinationPath = getMinidumpDestinationPath();
 //MADANA
 /*
     const bool appServicesRequested =
@@ -919,25 +1163,18 @@ Json::Value DobbySpecGenerator::createRdkPlugins(const ApplicationConfiguration&
     }
     */
     //WORK: seccomp
-    return rdkPluginsObj;
 }
 
-Json::Value DobbySpecGenerator::createMinidumpPlugin() const
+std::string DobbySpecGenerator::getMinidumpDestinationPath() const
 {
-    Json::Value pluginObj(Json::objectValue);
-    static const Json::StaticString minidumpPath("/opt/minidumps");
-    static const Json::StaticString minidumpSecurePath("/opt/secure/minidumps");
+    static const std::string minidumpPath("/opt/minidumps");
+    static const std::string minidumpSecurePath("/opt/secure/minidumps");
 
-    pluginObj["required"] = false;
     if (access("/tmp/.SecureDumpDisable", R_OK) == 0)
     {
-        pluginObj["data"]["destinationPath"] = minidumpPath;
-    }
-    else
-    {
-        pluginObj["data"]["destinationPath"] = minidumpSecurePath;
+        return minidumpPath;
     }
-    return pluginObj;
+    return minidumpSecurePath;
 }
 
 //TODO SUPPORT airplay2 ports in appsservice plugin
@@ -1028,11 +1265,10 @@ Json::Value DobbySpecGenerator::createNetworkPlugin(const ApplicationConfigurati
     return pluginObj;
 }
 
-void DobbySpecGenerator::populateClassicPlugins(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, Json::Value& spec)
+void DobbySpecGenerator::populateClassicPlugins(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, DobbySpecModel& spec)
 {
-    Json::Value pluginsArray(Json::arrayValue);
     // enable the logging plugin
-    pluginsArray.append(createEthanLogPlugin(config, runtimeConfig));
+    spec.ethanLogLevels = getEthanLogLevels(config, runtimeConfig);
     
     //TODO SUPPORT Runtime config need to have requiresDrm parameter
     /*
@@ -1078,7 +1314,7 @@ void DobbySpecGenerator::populateClassicPlugins(const ApplicationConfiguration&
     if (true)
     {
     #endif
-    pluginsArray.append(createOpenCDMPlugin(config, runtimeConfig));
+    spec.openCdm = true;
     }
     #ifdef ENABLE_RIALTO
     else
@@ -1086,48 +1322,38 @@ void DobbySpecGenerator::populateClassicPlugins(const ApplicationConfiguration&
         LOGINFO("populateClassicPlugins: Rialto active — skipping OpenCDM for appId='%s'", config.mAppId.c_str());
     }
     #endif
-    spec["plugins"] = std::move(pluginsArray);
 }
 
-Json::Value DobbySpecGenerator::createEthanLogPlugin(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const
+std::vector<std::string> DobbySpecGenerator::getEthanLogLevels(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const
 {
-    Json::Value plugin(Json::objectValue);
-    static const Json::StaticString name("name");
-    static const Json::StaticString data("data");
-    static const Json::StaticString pluginName("EthanLog");
-
-    static const Json::StaticString loglevels("loglevels");
-    static const Json::StaticString fatal("fatal");
-    static const Json::StaticString error("error");
-    static const Json::StaticString warning("warning");
-    static const Json::StaticString milestone("milestone");
-    static const Json::StaticString info("info");
-    static const Json::StaticString debug("debug");
-
-    Json::Value levels(Json::arrayValue);
+    std::vector<std::string> levels;
     if (!runtimeConfig.logLevels.empty())
     {
         Json::Reader reader;
         Json::Value parsed;
         if (reader.parse(runtimeConfig.logLevels, parsed) && parsed.isArray())
-            levels = parsed;
+        {
+            // EthanLog only knows level names, anything else in the list is dropped
+            for (const auto& level : parsed)
+            {
+                if (level.isString())
+                    levels.push_back(level.asString());
+            }
+        }
     }
     if (levels.empty())
     {
         // No explicit levels from package config — apply platform defaults
-        if (mDefaultLoggingMask & static_cast<unsigned>(LogLevel::Fatal))     levels.append(fatal);
-        if (mDefaultLoggingMask & static_cast<unsigned>(LogLevel::Error))     levels.append(error);
-        if (mDefaultLoggingMask & static_cast<unsigned>(LogLevel::Warning))   levels.append(warning);
-        if (mDefaultLoggingMask & static_cast<unsigned>(LogLevel::Info))      levels.append(info);
-        if (mDefaultLoggingMask & static_cast<unsigned>(LogLevel::Debug))     levels.append(debug);
-        if (mDefaultLoggingMask & static_cast<unsigned>(LogLevel::Milestone)) levels.append(milestone);
-        if (levels.empty()) levels.append(milestone);
+        if (mDefaultLoggingMask & static_cast<unsigned>(LogLevel::Fatal))     levels.push_back("fatal");
+        if (mDefaultLoggingMask & static_cast<unsigned>(LogLevel::Error))     levels.push_back("error");
+        if (mDefaultLoggingMask & static_cast<unsigned>(LogLevel::Warning))   levels.push_back("warning");
+        if (mDefaultLoggingMask & static_cast<unsigned>(LogLevel::Info))      levels.push_back("info");
+        if (mDefaultLoggingMask & static_cast<unsigned>(LogLevel::Debug))     levels.push_back("debug");
+        if (mDefaultLoggingMask & static_cast<unsigned>(LogLevel::Milestone)) levels.push_back("milestone");
+        if (levels.empty()) levels.push_back("milestone");
     }
 
-    plugin[name] = pluginName;
-    plugin[data][loglevels] = levels;
-
-    return plugin;
+    return levels;
 }
 
 
@@ -1162,14 +1388,6 @@ Json::Value DobbySpecGenerator::createMulticastSocketPlugin(const ApplicationCon
     return Json::Value::null;
 }
 
-Json::Value DobbySpecGenerator::createIonMemoryPlugin() const
-{
-    Json::Value plugin(Json::objectValue);
-    static const Json::StaticString data("data");
-    plugin[data] = mIonMemoryPluginData;
-    return plugin;
-}
-
 Json::Value DobbySpecGenerator::createThunderPlugin(const ApplicationConfiguration& config,
                                                     const std::vector<std::pair<std::string, std::string>>& capabilities) const
 {
@@ -1201,19 +1419,6 @@ Json::Value DobbySpecGenerator::createThunderPlugin(const ApplicationConfigurati
     return plugin;
 }
 
-Json::Value DobbySpecGenerator::createOpenCDMPlugin(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const
-{
-    static const Json::StaticString name("name");
-    static const Json::StaticString data("data");
-    static const Json::StaticString pluginName("OpenCDM");
-
-    Json::Value plugin(Json::objectValue);
-    plugin[name] = pluginName;
-    plugin[data] = Json::Value::null;
-
-    return plugin;
-}
-
 void DobbySpecGenerator::initialiseDefaultLogLevels()
 {
     for (const auto& level : mAIConfiguration->getDefaultAllowedLogLevels())
@@ -1228,58 +1433,35 @@ void DobbySpecGenerator::initialiseDefaultLogLevels()
     LOGINFO("DobbySpecGenerator: default logging mask 0x%x", mDefaultLoggingMask);
 }
 
-void DobbySpecGenerator::initialiseIonHeapsJson()
+void DobbySpecGenerator::initialiseIonHeaps()
 {
-    Json::Value heapsArray(Json::arrayValue);
     for (const auto &heapQuota : mAIConfiguration->getIonHeapQuotas())
     {
-        Json::Value heapObject(Json::objectValue);
-        heapObject["name"] = heapQuota.first;
-        heapObject["limit"] = heapQuota.second;
-
-        heapsArray.append(std::move(heapObject));
+        mIonHeaps.emplace_back(heapQuota.first, heapQuota.second);
     }
 
-    mIonMemoryPluginData["defaultLimit"] = mAIConfiguration->getIonHeapDefaultQuota();
-    mIonMemoryPluginData["heaps"] = std::move(heapsArray);
+    mIonDefaultLimit = mAIConfiguration->getIonHeapDefaultQuota();
 }
 
-Json::Value DobbySpecGenerator::createPrivateDataMount(const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const
+DobbySpecMount DobbySpecGenerator::createPrivateDataMount(const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const
 {
-    static const Json::StaticString source("source");
-    static const Json::StaticString destination("destination");
-    static const Json::StaticString type("type");
-    static const Json::StaticString loop("loop");
-    static const Json::StaticString fstype("fstype");
-    static const Json::StaticString ext4("ext4");
-    static const Json::StaticString options("options");
-
-    static const Json::StaticString nosuid("nosuid");
-    static const Json::StaticString nodev("nodev");
-    static const Json::StaticString noexec("noexec");
-
-    Json::Value mount(Json::objectValue);
+    DobbySpecMount mount;
     std::string sourcePath(runtimeConfig.unpackedPath);
     if (sourcePath.empty())
     {
-        return Json::nullValue;
+        return mount;
     }
 
-    mount[source] = sourcePath;
-    mount[destination] = "/home/private";
-    mount[type] = loop;
-    mount[fstype] = ext4;
-
-    Json::Value optionsArray(Json::arrayValue);
-    optionsArray.append(nosuid);
-    optionsArray.append(nodev);
-    optionsArray.append(noexec);
-    mount[options] = optionsArray;
+    mount.source = sourcePath;
+    mount.destination = "/home/private";
+    mount.type = "loop";
+    mount.fstype = "ext4";
+    mount.options = { "nosuid", "nodev", "noexec" };
 
     return mount;
 }
 
-void DobbySpecGenerator::createFkpsMounts(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, Json::Value& spec) const
+void DobbySpecGenerator::createFkpsMounts(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, std::vector<DobbySpecMount>& mounts) const
 {
     std::list<std::string> fkpsFiles;
     JsonArray fkpsFilesArray;
@@ -1339,79 +1521,59 @@ void DobbySpecGenerator::createFkpsMounts(const ApplicationConfiguration& config
         }
         close(fd);
         // finally add a bind mount for them
-        spec.append(createBindMount(fkpsFilePath, fkpsFilePath,
+        mounts.push_back(createBindMount(fkpsFilePath, fkpsFilePath,
                                           (MS_BIND | MS_RDONLY | MS_NOSUID | MS_NODEV | MS_NOEXEC)));
     }
 
     // additional tmpfs mount apparently required for YT certification
-    spec.append(createTmpfsMount("/opt/drm/vault",
+    mounts.push_back(createTmpfsMount("/opt/drm/vault",
                                        (MS_NOSUID | MS_NODEV | MS_NOEXEC)));
 
 }
 
-Json::Value DobbySpecGenerator::createTmpfsMount(const std::string &mntDestination,
-                                                 unsigned long mntOptions) const
+DobbySpecMount DobbySpecGenerator::createTmpfsMount(const std::string &mntDestination,
+                                                    unsigned long mntOptions) const
 {
-    static const Json::StaticString source("source");
-    static const Json::StaticString destination("destination");
-    static const Json::StaticString type("type");
-    static const Json::StaticString tmpfs("tmpfs");
-    static const Json::StaticString options("options");
-
-    static const Json::StaticString nosuid("nosuid");
-    static const Json::StaticString nodev("nodev");
-    static const Json::StaticString noexec("noexec");
-    static const Json::StaticString noatime("noatime");
-    static const Json::StaticString relatime("relatime");
-    static const Json::StaticString strictatime("strictatime");
-    static const Json::StaticString sync("sync");
-    static const Json::StaticString nodiratime("nodiratime");
-    static const Json::StaticString size("size=65536k");
-    static const Json::StaticString indoes("nr_inodes=8k");
-    Json::Value mount(Json::objectValue);
-
-    mount[type] = tmpfs;
-    mount[source] = tmpfs;
-    mount[destination] = mntDestination;
-
-    Json::Value optionsArray(Json::arrayValue);
+    DobbySpecMount mount;
+
+    mount.type = "tmpfs";
+    mount.source = "tmpfs";
+    mount.destination = mntDestination;
 
     if (mntOptions & MS_NOSUID)
-        optionsArray.append(nosuid);
+        mount.options.push_back("nosuid");
     if (mntOptions & MS_NODEV)
-        optionsArray.append(nodev);
+        mount.options.push_back("nodev");
     if (mntOptions & MS_NOEXEC)
-        optionsArray.append(noexec);
+        mount.options.push_back("noexec");
 
     if (mntOptions & MS_SYNCHRONOUS)
-        optionsArray.append(sync);
+        mount.options.push_back("sync");
 
     if (mntOptions & MS_NODIRATIME)
-        optionsArray.append(nodiratime);
+        mount.options.push_back("nodiratime");
 
     if (mntOptions & MS_NOATIME)
-        optionsArray.append(noatime);
+        mount.options.push_back("noatime");
     if (mntOptions & MS_RELATIME)
-        optionsArray.append(relatime);
+        mount.options.push_back("relatime");
     if (mntOptions & MS_STRICTATIME)
-        optionsArray.append(strictatime);
+        mount.options.push_back("strictatime");
 
-    optionsArray.append(size);
-    optionsArray.append(indoes);
-
-    mount[options] = std::move(optionsArray);
+    mount.options.push_back("size=65536k");
+    mount.options.push_back("nr_inodes=8k");
 
     return mount;
 }
 
-Json::Value DobbySpecGenerator::createResourceManagerMount(const ApplicationConfiguration& config) const
+DobbySpecMount DobbySpecGenerator::createResourceManagerMount(const ApplicationConfiguration& config) const
 {
     constexpr unsigned long mntOptions = (MS_BIND | MS_NOSUID | MS_NODEV | MS_NOEXEC);
-    static const std::string resmgrMountSource = XDG_RUNTIME_DIR "/resource";
+    const std::string& resmgrMountSource = mResourceManagerSocketPath;
     static const std::string resmgrMountPoint = XDG_RUNTIME_DIR "/resource";
 
     struct stat details;
-    Json::Value resmgrMount;
+    DobbySpecMount resmgrMount;
     int fd = open(resmgrMountSource.c_str(), O_RDONLY | O_NOFOLLOW | O_CLOEXEC);
     if (fd >= 0)
     {
@@ -1541,5 +1703,60 @@ void DobbySpecGenerator::addHolePunchPortToSpec(Json::Value &spec, in_port_t por
         plugins.append(std::move(plugin));
     }
 }
+DobbySpecTemplateCache::DobbySpecTemplateCache(size_t maxEntries)
+    : mLock()
+    , mTemplates()
+    , mInsertionOrder()
+    , mMaxEntries(maxEntries)
+{
+}
+
+bool DobbySpecTemplateCache::find(const std::string& key, std::string& specTemplate) const
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    auto it = mTemplates.find(key);
+    if (it == mTemplates.end())
+    {
+        return false;
+    }
+    specTemplate = it->second;
+    return true;
+}
+
+void DobbySpecTemplateCache::insert(const std::string& key, const std::string& specTemplate)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    auto it = mTemplates.find(key);
+    if (it != mTemplates.end())
+    {
+        it->second = specTemplate;
+        return;
+    }
+
+    // evict the oldest template once the cache is full
+    while (!mInsertionOrder.empty() && (mTemplates.size() >= mMaxEntries))
+    {
+        mTemplates.erase(mInsertionOrder.front());
+        mInsertionOrder.pop_front();
+    }
+    mTemplates[key] = specTemplate;
+    mInsertionOrder.push_back(key);
+}
+
+void DobbySpecTemplateCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    mTemplates.clear();
+    mInsertionOrder.clear();
+}
+
+size_t DobbySpecTemplateCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mTemplates.size();
+}
+
 } // namespace Plugin
 } // namespace WPEFramework
@@ -24,12 +24,17 @@
 // or just path (without quotation, if quotation disabled using path.SetQuoted(false))
 #include <json/json.h>
 #include "tracing/Logging.h"
+#include <list>
+#include <map>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
 #include "ApplicationConfiguration.h"
 #include <interfaces/IRuntimeManager.h>
 #include "AIConfiguration.h"
+#include "DobbySpecModel.h"
+#include "LaunchProfileCache.h"
 
 namespace WPEFramework
 {
@@ -38,6 +43,31 @@ namespace Plugin
 
 //    struct ApplicationConfiguration;
 
+#define DOBBY_SPEC_TEMPLATE_CACHE_MAX_ENTRIES 32
+
+    /**
+     * Pre-serialized Dobby spec templates keyed by app, package paths, capability set
+     * and the other launch inputs that shape the spec. Per-instance fields are left
+     * as placeholders and patched by DobbySpecGenerator on every launch.
+     * Owned by RuntimeManagerImplementation and shared by the per-launch generators.
+     */
+    class DobbySpecTemplateCache
+    {
+        public:
+            explicit DobbySpecTemplateCache(size_t maxEntries = DOBBY_SPEC_TEMPLATE_CACHE_MAX_ENTRIES);
+
+            bool find(const std::string& key, std::string& specTemplate) const;
+            void insert(const std::string& key, const std::string& specTemplate);
+            void clear();
+            size_t size() const;
+
+        private:
+            mutable std::mutex mLock;
+            std::map<std::string, std::string> mTemplates;
+            std::list<std::string> mInsertionOrder;
+            const size_t mMaxEntries;
+    };
+
     class DobbySpecGenerator
     {
         public:
@@ -53,50 +83,87 @@ namespace Plugin
              * Only sets the path if the file exists at call time.
              */
             void setGstreamerRegistryPath(const std::string& registryPath);
+
+            /**
+             * Sets the essos resource manager socket bind mounted into apps that
+             * have a display; it defaults to XDG_RUNTIME_DIR/resource when the
+             * client is enabled in AIConfiguration, empty disables the mount.
+             * Its group owner and mode are fixed up for the app on every launch.
+             */
+            void setResourceManagerSocketPath(const std::string& socketPath);
+
+            /**
+             * Builds specs from cached templates instead of from scratch; the cache
+             * must outlive the generator. Without a cache every spec is built in full.
+             */
+            void setTemplateCache(DobbySpecTemplateCache* cache);
+
+            /**
+             * Uses a launch profile built from the same RuntimeConfig instead of
+             * parsing capabilities, limits and env again; the profile must outlive
+             * the generator. Without a profile everything is derived per launch.
+             */
+            void setLaunchProfile(const LaunchProfile* profile);
+
+            /**
+             * Derives the launch profile of an app from its RuntimeConfig and the
+             * platform configuration. aiConfiguration may be null, in which case
+             * the platform defaults are left unset.
+             */
+            static void buildLaunchProfile(AIConfiguration* aiConfiguration,
+                                           const WPEFramework::Exchange::RuntimeConfig& runtimeConfig,
+                                           LaunchProfile& profile);
             static void parseCapabilities(const std::string& serializedCapabilities,
                               std::vector<std::pair<std::string, std::string>>& parsedCapabilities);
             static bool hasCapability(const std::vector<std::pair<std::string, std::string>>& capabilities,
                            const std::string& capabilityName);
 
         private:
-            Json::Value createEnvVars(const ApplicationConfiguration& config,
-                                      const WPEFramework::Exchange::RuntimeConfig& runtimeConfig,
-                                      const std::vector<std::pair<std::string, std::string>>& capabilities) const;
-            Json::Value createMounts(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const;
-            Json::Value createRdkPlugins(const ApplicationConfiguration& config,
-                                         const WPEFramework::Exchange::RuntimeConfig& runtimeConfig,
-                                         const std::vector<std::pair<std::string, std::string>>& capabilities) const;
-            Json::Value createMinidumpPlugin() const;
+            bool buildSpec(const ApplicationConfiguration& config,
+                           const WPEFramework::Exchange::RuntimeConfig& runtimeConfig,
+                           const std::vector<std::pair<std::string, std::string>>& capabilities,
+                           ssize_t memLimit, bool asTemplate, std::string& resultSpec);
+            std::string getTemplateKey(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const;
+            std::string patchTemplate(const std::string& specTemplate,
+                                      const ApplicationConfiguration& config,
+                                      const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const;
+            std::vector<std::string> createEnvVars(const ApplicationConfiguration& config,
+                                                   const WPEFramework::Exchange::RuntimeConfig& runtimeConfig,
+                                                   const std::vector<std::pair<std::string, std::string>>& capabilities) const;
+            std::vector<DobbySpecMount> createMounts(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, bool asTemplate) const;
+            void createRdkPlugins(const ApplicationConfiguration& config,
+                                  const WPEFramework::Exchange::RuntimeConfig& runtimeConfig,
+                                  const std::vector<std::pair<std::string, std::string>>& capabilities,
+                                  DobbySpecModel& spec) const;
+            std::string getMinidumpDestinationPath() const;
             Json::Value createAppServiceSDKPlugin(const ApplicationConfiguration& config,
                                                   const WPEFramework::Exchange::RuntimeConfig& runtimeConfig,
                                                   const std::vector<std::pair<std::string, std::string>>& capabilities) const;
             Json::Value createNetworkPlugin(const ApplicationConfiguration& config,
                                             const WPEFramework::Exchange::RuntimeConfig& runtimeConfig,
                                             const std::vector<std::pair<std::string, std::string>>& capabilities) const;
-            Json::Value createBindMount(const std::string &source,
-                                        const std::string &destination,
-                                        unsigned long options) const;
+            DobbySpecMount createBindMount(const std::string &source,
+                                           const std::string &destination,
+                                           unsigned long options) const;
 
             bool shouldEnableGpu(const ApplicationConfiguration& config) const;
 
             ssize_t getSysMemoryLimit(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const;
             ssize_t getGPUMemoryLimit(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const;
-            bool getVpuEnabled(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, std::vector<std::pair<std::string, std::string>>& capabilities) const;
+            bool getVpuEnabled(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, const std::vector<std::pair<std::string, std::string>>& capabilities) const;
             std::string getCpuCores();
-            void populateClassicPlugins(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, Json::Value& spec);
-            Json::Value createEthanLogPlugin(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const;
+            void populateClassicPlugins(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, DobbySpecModel& spec);
+            std::vector<std::string> getEthanLogLevels(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const;
             Json::Value createMulticastSocketPlugin(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const;
-            Json::Value createIonMemoryPlugin() const;
             Json::Value createThunderPlugin(const ApplicationConfiguration& config,
                                             const std::vector<std::pair<std::string, std::string>>& capabilities) const;
-            Json::Value createOpenCDMPlugin(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const;
-            Json::Value createPrivateDataMount(const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const;
-            void createFkpsMounts(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, Json::Value& spec) const;
-            Json::Value createTmpfsMount(const std::string &mntDestination,
-                                 unsigned long mntOptions) const;
-            Json::Value createResourceManagerMount(const ApplicationConfiguration& config) const;
-            Json::Value getWorkingDir(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const;
-            void initialiseIonHeapsJson();
+            DobbySpecMount createPrivateDataMount(const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const;
+            void createFkpsMounts(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, std::vector<DobbySpecMount>& mounts) const;
+            DobbySpecMount createTmpfsMount(const std::string &mntDestination,
+                                            unsigned long mntOptions) const;
+            DobbySpecMount createResourceManagerMount(const ApplicationConfiguration& config) const;
+            std::string getWorkingDir(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig) const;
+            void initialiseIonHeaps();
             void initialiseDefaultLogLevels();
             std::string encodeURL(std::string url) const;
             std::string getCapabilityValue(const std::vector<std::pair<std::string, std::string>>& capabilities,
@@ -115,12 +182,16 @@ namespace Plugin
                 Milestone = 0x20,
             };
 
-            Json::Value mIonMemoryPluginData;
+            uint64_t mIonDefaultLimit;
+            std::vector<std::pair<std::string, uint64_t>> mIonHeaps;
 	    std::string mPackageMountPoint;
 	    std::string mRuntimeMountPoint;
             std::string mGstRegistrySourcePath;
             std::string mGstRegistryDestinationPath;
+            std::string mResourceManagerSocketPath;
             AIConfiguration* mAIConfiguration;
+            DobbySpecTemplateCache* mTemplateCache;
+            const LaunchProfile* mLaunchProfile;
             unsigned mDefaultLoggingMask;   ///< pre-computed from aisettings defaultAllowedLogLevels
     };
 } /* namespace Plugin */
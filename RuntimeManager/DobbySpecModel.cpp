@@ -0,0 +1,337 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "DobbySpecModel.h"
+#include "OCIJsonWriter.h"
+
+namespace WPEFramework {
+namespace Plugin {
+
+namespace
+{
+    void writeStrings(OCIJsonWriter& writer, const std::vector<std::string>& strings)
+    {
+        writer.beginArray();
+        for (const std::string& text : strings)
+        {
+            writer.value(text);
+        }
+        writer.endArray();
+    }
+
+    Json::Value stringsToJson(const std::vector<std::string>& strings)
+    {
+        Json::Value array(Json::arrayValue);
+        for (const std::string& text : strings)
+        {
+            array.append(text);
+        }
+        return array;
+    }
+}
+
+void DobbySpecMount::write(OCIJsonWriter& writer) const
+{
+    if (!placeholder.empty())
+    {
+        writer.value(placeholder);
+        return;
+    }
+    if (type.empty())
+    {
+        writer.null();
+        return;
+    }
+    writer.beginObject();
+    writer.key("destination");
+    writer.value(destination);
+    if (!fstype.empty())
+    {
+        writer.key("fstype");
+        writer.value(fstype);
+    }
+    writer.key("options");
+    writeStrings(writer, options);
+    writer.key("source");
+    writer.value(source);
+    writer.key("type");
+    writer.value(type);
+    writer.endObject();
+}
+
+Json::Value DobbySpecMount::toJson() const
+{
+    if (!placeholder.empty())
+    {
+        return Json::Value(placeholder);
+    }
+    if (type.empty())
+    {
+        return Json::Value(Json::nullValue);
+    }
+    Json::Value mount(Json::objectValue);
+    mount["destination"] = destination;
+    if (!fstype.empty())
+    {
+        mount["fstype"] = fstype;
+    }
+    mount["options"] = stringsToJson(options);
+    mount["source"] = source;
+    mount["type"] = type;
+    return mount;
+}
+
+void DobbySpecModel::write(OCIJsonWriter& writer) const
+{
+    writer.beginObject();
+
+    writer.key("args");
+    writeStrings(writer, args);
+
+    if (console)
+    {
+        writer.key("console");
+        writer.beginObject();
+        writer.key("limit");
+        writer.value(consoleLimit);
+        writer.key("path");
+        writer.value(consolePath);
+        writer.endObject();
+    }
+
+    writer.key("cpu");
+    writer.beginObject();
+    writer.key("cores");
+    writer.value(cpuCores);
+    writer.endObject();
+
+    writer.key("cwd");
+    writer.value(cwd);
+
+    if (systemDbus)
+    {
+        writer.key("dbus");
+        writer.beginObject();
+        writer.key("system");
+        writer.value("system");
+        writer.endObject();
+    }
+
+    writer.key("env");
+    writeStrings(writer, env);
+
+    writer.key("etc");
+    writer.beginObject();
+    writer.key("hosts");
+    writeStrings(writer, etcHosts);
+    writer.key("ld-preload");
+    writeStrings(writer, etcLdPreload);
+    writer.key("services");
+    writeStrings(writer, etcServices);
+    writer.endObject();
+
+    if (gpu)
+    {
+        writer.key("gpu");
+        writer.beginObject();
+        writer.key("enable");
+        writer.value(true);
+        writer.key("memLimit");
+        writer.value(gpuMemLimit);
+        writer.endObject();
+    }
+
+    writer.key("memLimit");
+    writer.value(memLimit);
+
+    writer.key("mounts");
+    writer.beginArray();
+    for (const DobbySpecMount& mount : mounts)
+    {
+        mount.write(writer);
+    }
+    writer.endArray();
+
+    writer.key("network");
+    writer.value(network);
+
+    writer.key("plugins");
+    writer.beginArray();
+    writer.beginObject();
+    writer.key("data");
+    writer.beginObject();
+    writer.key("loglevels");
+    writeStrings(writer, ethanLogLevels);
+    writer.endObject();
+    writer.key("name");
+    writer.value("EthanLog");
+    writer.endObject();
+    if (openCdm)
+    {
+        writer.beginObject();
+        writer.key("data");
+        writer.null();
+        writer.key("name");
+        writer.value("OpenCDM");
+        writer.endObject();
+    }
+    writer.endArray();
+
+    writer.key("rdkPlugins");
+    writer.beginObject();
+    writer.key("ionmemory");
+    writer.beginObject();
+    writer.key("data");
+    writer.beginObject();
+    writer.key("defaultLimit");
+    writer.value(ionDefaultLimit);
+    writer.key("heaps");
+    writer.beginArray();
+    for (const auto& heap : ionHeaps)
+    {
+        writer.beginObject();
+        writer.key("limit");
+        writer.value(heap.second);
+        writer.key("name");
+        writer.value(heap.first);
+        writer.endObject();
+    }
+    writer.endArray();
+    writer.endObject();
+    writer.endObject();
+    writer.key("minidump");
+    writer.beginObject();
+    writer.key("data");
+    writer.beginObject();
+    writer.key("destinationPath");
+    writer.value(minidumpDestinationPath);
+    writer.endObject();
+    writer.key("required");
+    writer.value(false);
+    writer.endObject();
+    writer.endObject();
+
+    writer.key("restartOnCrash");
+    writer.value(restartOnCrash);
+
+    writer.key("user");
+    writer.beginObject();
+    writer.key("gid");
+    writer.value(gid);
+    writer.key("uid");
+    if (uidPlaceholder.empty())
+    {
+        writer.value(uid);
+    }
+    else
+    {
+        writer.value(uidPlaceholder);
+    }
+    writer.endObject();
+
+    writer.key("version");
+    writer.value(version);
+
+    writer.key("vpu");
+    writer.beginObject();
+    writer.key("enable");
+    writer.value(vpu);
+    writer.endObject();
+
+    writer.endObject();
+}
+
+Json::Value DobbySpecModel::toJson() const
+{
+    Json::Value spec(Json::objectValue);
+
+    spec["args"] = stringsToJson(args);
+    if (console)
+    {
+        spec["console"]["limit"] = consoleLimit;
+        spec["console"]["path"] = consolePath;
+    }
+    spec["cpu"]["cores"] = cpuCores;
+    spec["cwd"] = cwd;
+    if (systemDbus)
+    {
+        spec["dbus"]["system"] = "system";
+    }
+    spec["env"] = stringsToJson(env);
+    spec["etc"]["hosts"] = stringsToJson(etcHosts);
+    spec["etc"]["ld-preload"] = stringsToJson(etcLdPreload);
+    spec["etc"]["services"] = stringsToJson(etcServices);
+    if (gpu)
+    {
+        spec["gpu"]["enable"] = true;
+        spec["gpu"]["memLimit"] = static_cast<Json::Int64>(gpuMemLimit);
+    }
+    spec["memLimit"] = static_cast<Json::Int64>(memLimit);
+
+    Json::Value mountsArray(Json::arrayValue);
+    for (const DobbySpecMount& mount : mounts)
+    {
+        mountsArray.append(mount.toJson());
+    }
+    spec["mounts"] = std::move(mountsArray);
+    spec["network"] = network;
+
+    Json::Value ethanLog(Json::objectValue);
+    ethanLog["data"]["loglevels"] = stringsToJson(ethanLogLevels);
+    ethanLog["name"] = "EthanLog";
+    spec["plugins"].append(std::move(ethanLog));
+    if (openCdm)
+    {
+        Json::Value openCdmPlugin(Json::objectValue);
+        openCdmPlugin["data"] = Json::Value::null;
+        openCdmPlugin["name"] = "OpenCDM";
+        spec["plugins"].append(std::move(openCdmPlugin));
+    }
+
+    Json::Value heaps(Json::arrayValue);
+    for (const auto& heap : ionHeaps)
+    {
+        Json::Value heapObject(Json::objectValue);
+        heapObject["limit"] = static_cast<Json::UInt64>(heap.second);
+        heapObject["name"] = heap.first;
+        heaps.append(std::move(heapObject));
+    }
+    spec["rdkPlugins"]["ionmemory"]["data"]["defaultLimit"] = static_cast<Json::UInt64>(ionDefaultLimit);
+    spec["rdkPlugins"]["ionmemory"]["data"]["heaps"] = std::move(heaps);
+    spec["rdkPlugins"]["minidump"]["data"]["destinationPath"] = minidumpDestinationPath;
+    spec["rdkPlugins"]["minidump"]["required"] = false;
+
+    spec["restartOnCrash"] = restartOnCrash;
+    spec["user"]["gid"] = gid;
+    if (uidPlaceholder.empty())
+    {
+        spec["user"]["uid"] = uid;
+    }
+    else
+    {
+        spec["user"]["uid"] = uidPlaceholder;
+    }
+    spec["version"] = version;
+    spec["vpu"]["enable"] = vpu;
+
+    return spec;
+}
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,96 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include <json/json.h>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    class OCIJsonWriter;
+
+    /*
+     * One entry of the spec's mounts array. A mount without a type is written
+     * as null, which is what an app without an unpacked package path has always
+     * got for its private data mount. In a spec template the placeholder, when
+     * set, is written as a string in place of the whole mount.
+     */
+    struct DobbySpecMount
+    {
+        std::string destination;
+        std::string fstype;
+        std::vector<std::string> options;
+        std::string source;
+        std::string type;
+        std::string placeholder;
+
+        void write(OCIJsonWriter& writer) const;
+        Json::Value toJson() const;
+    };
+
+    /*
+     * Typed form of the Dobby spec built by DobbySpecGenerator. write() streams
+     * it straight into an OCIJsonWriter, in the same bytes Json::FastWriter
+     * produces for toJson(); the members are listed, and written, in the
+     * ascending key order of the JSON document.
+     *
+     * toJson() is only needed when a capability overlay has to be merged into
+     * the spec before it is serialized.
+     */
+    struct DobbySpecModel
+    {
+        std::vector<std::string> args;
+        bool console = false;
+        uint32_t consoleLimit = 0;
+        std::string consolePath;
+        std::string cpuCores;
+        std::string cwd;
+        bool systemDbus = false;
+        std::vector<std::string> env;
+        std::vector<std::string> etcHosts;
+        std::vector<std::string> etcLdPreload;
+        std::vector<std::string> etcServices;
+        bool gpu = false;
+        int64_t gpuMemLimit = 0;
+        int64_t memLimit = 0;
+        std::vector<DobbySpecMount> mounts;
+        std::string network;
+        std::vector<std::string> ethanLogLevels;
+        bool openCdm = false;
+        uint64_t ionDefaultLimit = 0;
+        std::vector<std::pair<std::string, uint64_t>> ionHeaps;
+        std::string minidumpDestinationPath;
+        bool restartOnCrash = false;
+        uint32_t gid = 0;
+        uint32_t uid = 0;
+        std::string uidPlaceholder;
+        std::string version;
+        bool vpu = false;
+
+        void write(OCIJsonWriter& writer) const;
+        Json::Value toJson() const;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -27,35 +27,262 @@
 #include <unistd.h>
 #include <string.h>
 #include <stdlib.h>
+#include <signal.h>
 #include <sys/stat.h>
 #include <errno.h>
+#include <fstream>
+#include <sstream>
 
 namespace WPEFramework {
 namespace Plugin {
 
+namespace {
+
+// Header of a binary registry as written by gstregistrybinary.c
+const char kRegistryMagic[] = "\xc0\xde\xf0\x0d";
+const size_t kRegistryMagicLen = 4;
+const char kRegistryVersion[] = "1.0.0";
+const size_t kRegistryVersionLen = 64;
+
+std::string stampPathFor(const std::string& registryPath)
+{
+    return registryPath + ".stamp";
+}
+
+std::string resolveExecutable(const std::string& name)
+{
+    if (name.find('/') != std::string::npos)
+        return name;
+
+    const char* envPath = getenv("PATH");
+    std::stringstream dirs((nullptr != envPath) ? envPath : "/usr/bin:/bin");
+    std::string dir;
+    while (std::getline(dirs, dir, ':'))
+    {
+        const std::string candidate = (dir.empty() ? "." : dir) + "/" + name;
+        if (access(candidate.c_str(), X_OK) == 0)
+            return candidate;
+    }
+    return std::string{};
+}
+
+} /* namespace */
+
 GStreamerRegistry::GStreamerRegistry(std::string gstLaunchPath,
-                                     std::string gstRegistryPath)
+                                     std::string gstRegistryPath,
+                                     std::string gstPluginDir)
     : mGstLaunchPath(std::move(gstLaunchPath))
     , mRegistryPath(std::move(gstRegistryPath))
+    , mPluginDir(std::move(gstPluginDir))
+    , mChildPid(-1)
+    , mStopping(false)
+    , mValid(false)
+    , mValidDev(0)
+    , mValidIno(0)
+    , mValidSize(0)
+    , mValidMtime(0)
 {
 }
 
+GStreamerRegistry::~GStreamerRegistry()
+{
+    stop();
+}
+
 // -----------------------------------------------------------------------------
 /**
- * Generates the GStreamer plugin registry file at mRegistryPath.
+ * Starts the registry check on a background thread so that neither plugin
+ * activation nor app launches wait on gst-launch.  path() stays empty until
+ * the check has produced a validated registry.
+ */
+void GStreamerRegistry::start()
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (mThread.joinable() || mStopping)
+        return;
+
+    mThread = std::thread([this]() {
+        if (!generate())
+            LOGWARN("GStreamerRegistry: no usable registry; containers will not have GST registry bind-mount");
+    });
+}
+
+void GStreamerRegistry::stop()
+{
+    std::thread thread;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStopping = true;
+        if (mChildPid > 0)
+            kill(-mChildPid, SIGKILL);
+        thread.swap(mThread);
+    }
+    if (thread.joinable())
+        thread.join();
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Makes sure a valid registry exists at mRegistryPath.
  *
- * Spawns gst-launch-1.0 --version with GST_REGISTRY set so GStreamer writes
- * the registry without starting a pipeline.  Blocks until the child exits
- * (typically < 2 s).
+ * The registry from an earlier run is reused when the stamp file next to it
+ * records the current fingerprint of the plugin directory and gst-launch
+ * binary.  Otherwise gst-launch-1.0 --version is spawned with GST_REGISTRY
+ * pointing at a temporary file, which is validated and renamed into place so
+ * a container never sees a partially written registry.
  *
- * Returns true if the registry file exists after the call.
+ * Returns true if a validated registry is in place after the call.
  */
 bool GStreamerRegistry::generate()
 {
-    if (access(mRegistryPath.c_str(), F_OK) == 0)
-        return true;
+    const std::string currentFingerprint = fingerprint();
+    const std::string stampPath = stampPathFor(mRegistryPath);
 
-    const std::string registryEnvVar = "GST_REGISTRY=" + mRegistryPath;
+    {
+        std::ifstream stamp(stampPath);
+        std::string recordedFingerprint;
+        std::string recordedVersion;
+        if (stamp && std::getline(stamp, recordedFingerprint) && std::getline(stamp, recordedVersion) &&
+            !currentFingerprint.empty() && (recordedFingerprint == currentFingerprint) &&
+            isValidRegistry(mRegistryPath))
+        {
+            LOGINFO("GStreamerRegistry: reusing registry at %s (%s)", mRegistryPath.c_str(), recordedVersion.c_str());
+            adopt(mRegistryPath);
+            return true;
+        }
+    }
+
+    const std::string tmpPath = mRegistryPath + ".tmp";
+    unlink(tmpPath.c_str());
+
+    std::string version;
+    if (!spawnGstLaunch(tmpPath, version))
+    {
+        unlink(tmpPath.c_str());
+        return false;
+    }
+
+    if (!isValidRegistry(tmpPath))
+    {
+        LOGERR("GStreamerRegistry: %s produced an invalid registry, not using it", mGstLaunchPath.c_str());
+        unlink(tmpPath.c_str());
+        return false;
+    }
+
+    // Make registry readable by all users inside containers.
+    struct stat st;
+    if (stat(tmpPath.c_str(), &st) != 0 ||
+        chmod(tmpPath.c_str(), st.st_mode | S_IRGRP | S_IROTH) != 0)
+    {
+        LOGERR("GStreamerRegistry: failed to set read permissions on %s: %s",
+               tmpPath.c_str(), strerror(errno));
+        unlink(tmpPath.c_str());
+        return false;
+    }
+
+    // Containers already running keep the inode they bind-mounted
+    unlink(stampPath.c_str());
+    if (rename(tmpPath.c_str(), mRegistryPath.c_str()) != 0)
+    {
+        LOGERR("GStreamerRegistry: failed to move registry into %s: %s",
+               mRegistryPath.c_str(), strerror(errno));
+        unlink(tmpPath.c_str());
+        return false;
+    }
+
+    if (!currentFingerprint.empty())
+    {
+        const std::string tmpStampPath = stampPath + ".tmp";
+        std::ofstream stamp(tmpStampPath, std::ios::trunc);
+        stamp << currentFingerprint << "\n" << version << "\n";
+        stamp.close();
+        if (!stamp || rename(tmpStampPath.c_str(), stampPath.c_str()) != 0)
+        {
+            LOGWARN("GStreamerRegistry: failed to write %s; registry will be rebuilt next start", stampPath.c_str());
+            unlink(tmpStampPath.c_str());
+        }
+    }
+
+    LOGINFO("GStreamerRegistry: registry created at %s (%s)", mRegistryPath.c_str(), version.c_str());
+    adopt(mRegistryPath);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Returns the registry path if it was validated and has not been replaced or
+ * modified since, otherwise an empty path.  Only a stat(), so it is cheap
+ * enough for every launch.
+ */
+std::string GStreamerRegistry::path() const
+{
+    std::lock_guard<std::mutex> lock(mMutex);
+    if (!mValid)
+        return std::string{};
+
+    struct stat st;
+    if (stat(mRegistryPath.c_str(), &st) != 0 ||
+        st.st_dev != mValidDev || st.st_ino != mValidIno ||
+        st.st_size != mValidSize || st.st_mtime != mValidMtime)
+    {
+        LOGWARN("GStreamerRegistry: %s changed after validation, not mounting it", mRegistryPath.c_str());
+        return std::string{};
+    }
+    return mRegistryPath;
+}
+
+bool GStreamerRegistry::isValidRegistry(const std::string& registryPath)
+{
+    std::ifstream file(registryPath, std::ios::binary);
+    if (!file)
+        return false;
+
+    char header[kRegistryMagicLen + kRegistryVersionLen];
+    if (!file.read(header, sizeof(header)))
+        return false;
+
+    // A header with nothing after it is a registry without a single plugin
+    if (file.peek() == std::ifstream::traits_type::eof())
+        return false;
+
+    if (memcmp(header, kRegistryMagic, kRegistryMagicLen) != 0)
+        return false;
+
+    return strncmp(header + kRegistryMagicLen, kRegistryVersion, kRegistryVersionLen) == 0;
+}
+
+// -----------------------------------------------------------------------------
+/**
+ * Identifies the installed plugin set without spawning anything: the mtime of
+ * the plugin directory changes when plugins are added, removed or replaced,
+ * and the size and mtime of gst-launch change with the GStreamer version.
+ * Returns an empty string if either cannot be stat'ed.
+ */
+std::string GStreamerRegistry::fingerprint() const
+{
+    struct stat pluginDirStat;
+    if (stat(mPluginDir.c_str(), &pluginDirStat) != 0)
+        return std::string{};
+
+    const std::string launcher = resolveExecutable(mGstLaunchPath);
+    struct stat launcherStat;
+    if (launcher.empty() || stat(launcher.c_str(), &launcherStat) != 0)
+        return std::string{};
+
+    std::ostringstream key;
+    key << "plugins=" << mPluginDir << ":" << pluginDirStat.st_mtim.tv_sec << "." << pluginDirStat.st_mtim.tv_nsec
+        << " launcher=" << launcher << ":" << launcherStat.st_size << ":" << launcherStat.st_mtim.tv_sec << "." << launcherStat.st_mtim.tv_nsec;
+    return key.str();
+}
+
+/**
+ * Spawns gst-launch-1.0 --version with GST_REGISTRY=registryPath and returns
+ * the "GStreamer x.y.z" line of its output in version.  Only ever called from
+ * the background thread; stop() kills the child.
+ */
+bool GStreamerRegistry::spawnGstLaunch(const std::string& registryPath, std::string& version)
+{
+    const std::string registryEnvVar = "GST_REGISTRY=" + registryPath;
 
     const size_t slashPos = mGstLaunchPath.rfind('/');
     const std::string gstLaunchFilename = (slashPos == std::string::npos) ? mGstLaunchPath : mGstLaunchPath.substr(slashPos + 1);
@@ -69,31 +296,78 @@ bool GStreamerRegistry::generate()
         nullptr
     };
 
+    int outputPipe[2] = { -1, -1 };
+    if (pipe2(outputPipe, O_CLOEXEC) != 0)
+    {
+        LOGERR("GStreamerRegistry: pipe failed (errno %d)", errno);
+        for (char *p : args) free(p);
+        for (char *p : envs) free(p);
+        return false;
+    }
+
     posix_spawn_file_actions_t actions;
     posix_spawn_file_actions_init(&actions);
-    posix_spawn_file_actions_addopen(&actions, STDOUT_FILENO, "/dev/null", O_WRONLY | O_APPEND, 0);
+    posix_spawn_file_actions_adddup2(&actions, outputPipe[1], STDOUT_FILENO);
     posix_spawn_file_actions_addopen(&actions, STDERR_FILENO, "/dev/null", O_WRONLY | O_APPEND, 0);
 
+    // Own process group so stop() also gets gst-plugin-scanner, which holds the pipe open
     posix_spawnattr_t attr;
     posix_spawnattr_init(&attr);
+    posix_spawnattr_setflags(&attr, POSIX_SPAWN_SETPGROUP);
+    posix_spawnattr_setpgroup(&attr, 0);
 
     pid_t pid = -1;
-    int ret = posix_spawnp(&pid, mGstLaunchPath.c_str(), &actions, &attr, args, envs);
+    int ret = 0;
+    bool stopping = false;
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        stopping = mStopping;
+        if (!stopping)
+        {
+            ret = posix_spawnp(&pid, mGstLaunchPath.c_str(), &actions, &attr, args, envs);
+            if (ret == 0 && pid > 0)
+                mChildPid = pid;
+        }
+    }
 
     posix_spawnattr_destroy(&attr);
     posix_spawn_file_actions_destroy(&actions);
+    close(outputPipe[1]);
 
     for (char *p : args) free(p);
     for (char *p : envs) free(p);
 
+    if (stopping)
+    {
+        close(outputPipe[0]);
+        return false;
+    }
+
     if (ret != 0 || pid <= 0)
     {
         LOGERR("GStreamerRegistry: failed to spawn %s (errno %d)", mGstLaunchPath.c_str(), ret);
+        close(outputPipe[0]);
         return false;
     }
 
+    std::string output;
+    char buffer[256];
+    ssize_t count;
+    while ((count = TEMP_FAILURE_RETRY(read(outputPipe[0], buffer, sizeof(buffer)))) > 0)
+        output.append(buffer, count);
+    close(outputPipe[0]);
+
+    // Leave the child a zombie until mChildPid is cleared so stop() cannot hit a reused pid
+    siginfo_t info;
+    memset(&info, 0, sizeof(info));
+    const int waitResult = TEMP_FAILURE_RETRY(waitid(P_PID, pid, &info, WEXITED | WNOWAIT));
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mChildPid = -1;
+    }
+
     int wstatus = 0;
-    if (TEMP_FAILURE_RETRY(waitpid(pid, &wstatus, 0)) < 0)
+    if (waitResult != 0 || TEMP_FAILURE_RETRY(waitpid(pid, &wstatus, 0)) < 0)
     {
         LOGERR("GStreamerRegistry: waitpid failed (errno %d)", errno);
         return false;
@@ -109,34 +383,38 @@ bool GStreamerRegistry::generate()
     LOGINFO("GStreamerRegistry: %s exited with status %d",
             mGstLaunchPath.c_str(), WEXITSTATUS(wstatus));
 
-    if (access(mRegistryPath.c_str(), F_OK) != 0)
+    std::istringstream lines(output);
+    std::string line;
+    while (std::getline(lines, line))
     {
-        LOGWARN("GStreamerRegistry: %s did not create registry file at %s",
-                mGstLaunchPath.c_str(), mRegistryPath.c_str());
-        return false;
+        if (line.compare(0, 10, "GStreamer ") == 0)
+        {
+            version = line;
+            break;
+        }
     }
 
-    // Make registry readable by all users inside containers.
-    struct stat st;
-    if (stat(mRegistryPath.c_str(), &st) != 0 ||
-        chmod(mRegistryPath.c_str(), st.st_mode | S_IRGRP | S_IROTH) != 0)
+    if (access(registryPath.c_str(), F_OK) != 0)
     {
-        LOGERR("GStreamerRegistry: failed to set read permissions on %s: %s",
-               mRegistryPath.c_str(), strerror(errno));
+        LOGWARN("GStreamerRegistry: %s did not create registry file at %s",
+                mGstLaunchPath.c_str(), registryPath.c_str());
         return false;
     }
-
-    LOGINFO("GStreamerRegistry: registry created at %s", mRegistryPath.c_str());
     return true;
 }
 
-// -----------------------------------------------------------------------------
-/**
- * Returns the registry path if the file exists, otherwise an empty path.
- */
-std::string GStreamerRegistry::path() const
+void GStreamerRegistry::adopt(const std::string& registryPath)
 {
-    return (access(mRegistryPath.c_str(), F_OK) == 0) ? mRegistryPath : std::string{};
+    struct stat st;
+    std::lock_guard<std::mutex> lock(mMutex);
+    mValid = (stat(registryPath.c_str(), &st) == 0);
+    if (mValid)
+    {
+        mValidDev = st.st_dev;
+        mValidIno = st.st_ino;
+        mValidSize = st.st_size;
+        mValidMtime = st.st_mtime;
+    }
 }
 
 } /* namespace Plugin */
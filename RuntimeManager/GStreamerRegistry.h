@@ -20,6 +20,9 @@
 #pragma once
 
 #include <string>
+#include <mutex>
+#include <thread>
+#include <sys/types.h>
 
 namespace WPEFramework {
 namespace Plugin {
@@ -31,27 +34,57 @@ namespace Plugin {
  * with GST_REGISTRY set to the target path so that GStreamer's registry-write
  * logic fires without starting a real pipeline.
  *
- * Intended to be used once at start-up; the generated registry is then
- * bind-mounted read-only into every container via setGstreamerRegistryPath().
+ * Started once at start-up on a background thread; the generated registry is
+ * then bind-mounted read-only into every container via setGstreamerRegistryPath().
+ * A registry built earlier is reused as long as the plugin directory and the
+ * gst-launch binary are unchanged, which is recorded in a stamp file next to it.
  */
 class GStreamerRegistry
 {
 public:
     explicit GStreamerRegistry(
         std::string gstLaunchPath   = "gst-launch-1.0",
-        std::string gstRegistryPath = "/tmp/rdkappmanagers-gstreamer-registry.bin");
+        std::string gstRegistryPath = "/tmp/rdkappmanagers-gstreamer-registry.bin",
+        std::string gstPluginDir    = "/usr/lib/gstreamer-1.0");
 
-    ~GStreamerRegistry() = default;
+    ~GStreamerRegistry();
 
-    /** Generates the registry file.  Blocks up to ~2 s. Returns true on success. */
+    GStreamerRegistry(const GStreamerRegistry&) = delete;
+    GStreamerRegistry& operator=(const GStreamerRegistry&) = delete;
+
+    /** Runs generate() on a background thread.  Returns immediately. */
+    void start();
+
+    /** Kills a running gst-launch child and joins the background thread. */
+    void stop();
+
+    /** Reuses or regenerates the registry file.  Blocks on the child. Returns true on success. */
     bool generate();
 
-    /** Returns the registry path if the file exists, otherwise an empty string. */
+    /** Returns the registry path once it is validated and unchanged, otherwise an empty string. Never blocks. */
     std::string path() const;
 
+    /** Returns true if the file carries a GStreamer binary registry header. */
+    static bool isValidRegistry(const std::string& registryPath);
+
 private:
+    std::string fingerprint() const;
+    bool spawnGstLaunch(const std::string& registryPath, std::string& version);
+    void adopt(const std::string& registryPath);
+
     const std::string mGstLaunchPath;
     const std::string mRegistryPath;
+    const std::string mPluginDir;
+
+    mutable std::mutex mMutex;
+    std::thread mThread;
+    pid_t mChildPid;
+    bool mStopping;
+    bool mValid;
+    dev_t mValidDev;
+    ino_t mValidIno;
+    off_t mValidSize;
+    time_t mValidMtime;
 };
 
 } /* namespace Plugin */
@@ -7,12 +7,16 @@
 
 #include "ContainerUtils.h"
 
+#include <atomic>
 #include <cstring>
+#include <map>
+#include <mutex>
 #include <thread>
 #include <ext/stdio_filebuf.h>
 
 #include <grp.h>
 #include <fcntl.h>
+#include <signal.h>
 #include <unistd.h>
 #include <sys/wait.h>
 #include <sys/syscall.h>
@@ -35,8 +39,33 @@ namespace Plugin
 #  endif
 #endif
 
+#if !defined(SYS_pidfd_open)
+#  define SYS_pidfd_open  434
+#endif
+#if !defined(SYS_pidfd_send_signal)
+#  define SYS_pidfd_send_signal  424
+#endif
+
 # define CLONE_NEWNET   0x40000000      /* New network namespace.  */
 
+// pidfds of running containers, keyed by container id
+struct ContainerPidFd
+{
+    int pidFd;
+    pid_t pid;
+};
+static std::mutex gPidFdsLock;
+static std::map<std::string, ContainerPidFd> gPidFds;
+
+// cleared the first time the kernel refuses setns on a pidfd (before 5.8)
+static std::atomic<bool> gSetnsOnPidFd(true);
+
+// cleared the first time the kernel has no pidfd_open (before 5.3)
+static std::atomic<bool> gPidFdOpen(true);
+
+// where the memory cgroups of Dobby containers live
+static std::string gCgroupMemoryRoot("/sys/fs/cgroup/memory/");
+
 // -----------------------------------------------------------------------------
 /*!
     \static
@@ -48,13 +77,14 @@ namespace Plugin
     namespaces and you don't really want to do this in the main thread.
 
  */
-static void nsThread(int newNsFd, int nsType, bool *success,
+static void nsThread(int newNsFd, int nsType, bool *success, int *error,
                      std::function<void()> &func)
 {
     LOGINFO("nsThread started");
     // unshare the specific namespace from the thread
     if (unshare(nsType) != 0)
     {
+        *error = errno;
         LOGERR("failed to unshare");
         *success = false;
         return;
@@ -63,6 +93,7 @@ static void nsThread(int newNsFd, int nsType, bool *success,
     // switch into the new namespace
     if (setns(newNsFd, nsType) != 0)
     {
+        *error = errno;
         LOGERR("failed to switch into new namespace");
         *success = false;
         return;
@@ -76,6 +107,50 @@ static void nsThread(int newNsFd, int nsType, bool *success,
     LOGINFO("nsThread End");
 }
 
+// -----------------------------------------------------------------------------
+/*!
+    \static
+    \internal
+
+    Runs \a func on a thread that has switched into the \a nsType namespace
+    referred to by \a nsFd, and blocks until the thread completes.
+
+ */
+static bool runInNamespace(int nsFd, int nsType, int *error,
+                           const std::function<void()> &func)
+{
+    bool success = false;
+    *error = 0;
+
+    LOGINFO("thread started");
+    // spawn the thread to run the callback in
+    std::thread thread = std::thread(std::bind(&nsThread, nsFd, nsType, &success, error, func));
+
+    // block until the thread completes
+    thread.join();
+    LOGINFO("thread end");
+
+    return success;
+}
+
+// -----------------------------------------------------------------------------
+/*!
+    \static
+    \internal
+
+    Returns true if the process referred to by \a pidFd has not exited.  Without
+    a pidfd (\a pidFd is -1) the check falls back to \a pid.
+
+ */
+static bool pidFdAlive(int pidFd, pid_t pid)
+{
+    if (pidFd < 0)
+    {
+        return (kill(pid, 0) == 0) || (errno == EPERM);
+    }
+    return (syscall(SYS_pidfd_send_signal, pidFd, 0, nullptr, 0) == 0);
+}
+
 // -----------------------------------------------------------------------------
 /*!
     \static
@@ -88,16 +163,39 @@ static void nsThread(int newNsFd, int nsType, bool *success,
     completes, so although it is multi-threaded it's API is blocking, i.e.
     effectively single threaded.
 
+    The namespace is entered through the container's pidfd, so it can never be
+    the namespace of an unrelated process that was given a recycled pid.  On
+    kernels without setns support for pidfds the /proc/<pid>/ns file is used
+    instead, and the pidfd is checked after opening it to confirm that the
+    pid still belonged to the container at that point.  On kernels without
+    pidfds at all \a pidFd is -1 and only the /proc/<pid>/ns file is used.
+
     The \a nsType argument should be one of the following values:
         CLONE_NEWIPC  - run in a IPC namespace
         CLONE_NEWNET  - run in a network namespace
         CLONE_NEWNS   - run in a mount namespace
 
  */
-static bool nsEnterWithPid(pid_t pid, int nsType,
-                           const std::function<void()> &func)
+static bool nsEnterWithPidFd(int pidFd, pid_t pid, int nsType,
+                             const std::function<void()> &func)
 {
-    LOGINFO("Entering nsEnterWithPid with pid=%d, nsType=%d", pid, nsType);
+    LOGINFO("Entering nsEnterWithPidFd with pid=%d, nsType=%d", pid, nsType);
+    int error = 0;
+
+    if ((pidFd >= 0) && gSetnsOnPidFd)
+    {
+        if (runInNamespace(pidFd, nsType, &error, func))
+        {
+            return true;
+        }
+        if (error != EINVAL)
+        {
+            return false;
+        }
+        LOGINFO("setns on a pidfd not supported, using /proc namespace files");
+        gSetnsOnPidFd = false;
+    }
+
     char nsName[8];
     char nsPath[32];
     strcpy(nsName, "net");
@@ -112,15 +210,14 @@ static bool nsEnterWithPid(pid_t pid, int nsType,
         LOGERR("failed to open container namespace @ '%s'", nsPath);
         success = false;
     }
+    else if (!pidFdAlive(pidFd, pid))
+    {
+        LOGERR("container process %d exited before its namespace was opened", pid);
+        success = false;
+    }
     else
     {
-        LOGINFO("thread started");
-        // spawn the thread to run the callback in
-        std::thread thread = std::thread(std::bind(&nsThread, newNsFd, nsType, &success, func));
-
-        // block until the thread completes
-        thread.join();
-        LOGINFO("thread end");
+        success = runInNamespace(newNsFd, nsType, &error, func);
     }
 
     // close the namespaces
@@ -146,7 +243,12 @@ static bool nsEnterWithPid(pid_t pid, int nsType,
 static pid_t findContainerPid(const std::string &containerId)
 {
     LOGINFO("Container ID: %s", containerId.c_str());
-    const std::string cgroupPath = "/sys/fs/cgroup/memory/" + containerId + "/cgroup.procs";
+    // an empty id would name the root cgroup and so a process of the host
+    if (containerId.empty())
+    {
+        return -1;
+    }
+    const std::string cgroupPath = gCgroupMemoryRoot + containerId + "/cgroup.procs";
     int procsFd = open(cgroupPath.c_str(), O_RDONLY | O_CLOEXEC);
     if (procsFd < 0)
     {
@@ -181,11 +283,144 @@ static pid_t findContainerPid(const std::string &containerId)
         return pid;
 }
 
+// -----------------------------------------------------------------------------
+/*!
+    \static
+    \internal
+
+    Opens a pidfd on the process found by findContainerPid().  The cgroup is
+    read again once the pidfd is open; if the pid is still the container's
+    then, the pidfd refers to the container process and not to a process that
+    was given the same pid later.
+
+    On kernels without pidfd_open \a pidFd is set to -1 and only the pid is
+    returned, as before pidfds were used.  Returns false if the container was
+    not found.
+
+ */
+static bool openContainerPidFd(const std::string &containerId, pid_t *pid, int *pidFd)
+{
+    *pidFd = -1;
+    *pid = findContainerPid(containerId);
+    if (*pid <= 0)
+    {
+        return false;
+    }
+
+    if (gPidFdOpen)
+    {
+        // always opened with close-on-exec
+        *pidFd = static_cast<int>(syscall(SYS_pidfd_open, *pid, 0));
+        if (*pidFd < 0)
+        {
+            if (errno != ENOSYS)
+            {
+                LOGERR("failed to open pidfd for pid %d (errno %d)", *pid, errno);
+                return false;
+            }
+            LOGINFO("pidfd_open not supported, using container pids");
+            gPidFdOpen = false;
+        }
+    }
+
+    if (*pidFd < 0)
+    {
+        return pidFdAlive(-1, *pid);
+    }
+
+    if (findContainerPid(containerId) != *pid)
+    {
+        LOGERR("container '%s' pid %d changed while opening its pidfd", containerId.c_str(), *pid);
+        close(*pidFd);
+        *pidFd = -1;
+        return false;
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+/*!
+    Opens and caches a pidfd for the container with \a containerId, to be
+    called once the container has started.  Later namespace operations on the
+    container use the cached pidfd instead of reading the cgroup again.
+
+    Returns true if the container was found.
+
+ */
+bool ContainerUtils::trackContainer(const std::string &containerId)
+{
+    pid_t pid = -1;
+    int pidFd = -1;
+    if (!openContainerPidFd(containerId, &pid, &pidFd))
+    {
+        LOGERR("no container found with id '%s'", containerId.c_str());
+        return false;
+    }
+
+    int stalePidFd = -1;
+    {
+        std::lock_guard<std::mutex> lock(gPidFdsLock);
+        auto it = gPidFds.find(containerId);
+        if (it != gPidFds.end())
+        {
+            stalePidFd = it->second.pidFd;
+        }
+        gPidFds[containerId] = ContainerPidFd{ pidFd, pid };
+    }
+
+    if (stalePidFd >= 0)
+    {
+        close(stalePidFd);
+    }
+    LOGINFO("tracking container '%s' pid %d", containerId.c_str(), pid);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+/*!
+    Drops the cached pidfd of the container with \a containerId, to be called
+    once the container has stopped.
+
+ */
+void ContainerUtils::untrackContainer(const std::string &containerId)
+{
+    int pidFd = -1;
+    {
+        std::lock_guard<std::mutex> lock(gPidFdsLock);
+        auto it = gPidFds.find(containerId);
+        if (it == gPidFds.end())
+        {
+            return;
+        }
+        pidFd = it->second.pidFd;
+        gPidFds.erase(it);
+    }
+
+    if ((pidFd >= 0) && (close(pidFd) != 0))
+    {
+        LOGERR("failed to close pidfd of container '%s'", containerId.c_str());
+    }
+}
+
+// -----------------------------------------------------------------------------
+/*!
+    Sets the directory holding the memory cgroups of containers, where the
+    pid of a container is read from.  Defaults to /sys/fs/cgroup/memory/.
+
+ */
+void ContainerUtils::setCgroupMemoryRoot(const std::string &path)
+{
+    gCgroupMemoryRoot = path;
+}
+
 // -----------------------------------------------------------------------------
 /*!
     Runs the given function in the context of a namespace of the container with
     \a containerId.
 
+    The container's cached pidfd is used if it is tracked, otherwise one is
+    opened for this call only.
 
     \note This makes lot of assumptions on how Dobby creates containers, so is
     not portable, and prone to breaking if Dobby changes how it works
@@ -195,14 +430,54 @@ static pid_t findContainerPid(const std::string &containerId)
 bool ContainerUtils::nsEnterImpl(const std::string &containerId, std::string type,
                                  const std::function<void()> &func)
 {
-    pid_t containerPid = findContainerPid(containerId);
-    if (containerPid <= 0)
+    pid_t containerPid = -1;
+    int pidFd = -1;
+    bool found = false;
+    {
+        // a duplicate, so an untrackContainer() meanwhile cannot close it under us
+        std::lock_guard<std::mutex> lock(gPidFdsLock);
+        auto it = gPidFds.find(containerId);
+        if (it != gPidFds.end())
+        {
+            containerPid = it->second.pid;
+            if (it->second.pidFd >= 0)
+            {
+                pidFd = fcntl(it->second.pidFd, F_DUPFD_CLOEXEC, 0);
+                found = (pidFd >= 0);
+            }
+            else
+            {
+                found = true;
+            }
+        }
+    }
+
+    if (!found)
+    {
+        found = openContainerPidFd(containerId, &containerPid, &pidFd);
+    }
+
+    if (!found)
     {
         LOGERR("no container found with id '%s'", containerId.c_str());
         return false;
     }
 
-    return nsEnterWithPid(containerPid, CLONE_NEWNET, func);
+    bool success = false;
+    if (!pidFdAlive(pidFd, containerPid))
+    {
+        LOGERR("container '%s' pid %d has exited", containerId.c_str(), containerPid);
+    }
+    else
+    {
+        success = nsEnterWithPidFd(pidFd, containerPid, CLONE_NEWNET, func);
+    }
+
+    if (pidFd >= 0)
+    {
+        close(pidFd);
+    }
+    return success;
 }
 
 // -----------------------------------------------------------------------------
@@ -31,6 +31,11 @@ public:
 
     static in_addr_t getContainerIpAddress(const std::string &containerId);
 
+    static bool trackContainer(const std::string &containerId);
+    static void untrackContainer(const std::string &containerId);
+
+    static void setCgroupMemoryRoot(const std::string &path);
+
 private:
     static bool nsEnterImpl(const std::string &containerId, std::string type,
                             const std::function<void()> &func);
@@ -18,6 +18,12 @@ extern "C" const char *iptc_strerror(int err);
 /// Global lock, used to control access to the iptables ruleset
 NetFilterLock NetFilter::mLock;
 
+/// Serializes threads in this process, the iptables lock is per process
+std::mutex NetFilter::mThreadLock;
+
+/// Rules committed by this process, keyed by comment; guarded by mThreadLock
+std::map<std::string, std::list<NetFilter::IndexedRule>> NetFilter::mCommentIndex;
+
 
 // -----------------------------------------------------------------------------
 /*!
@@ -78,16 +84,38 @@ extern "C" void nfSysError(int error, const char *format, ...)
 static int regexMatcher(const char *str, void *userData)
 {
     auto regex = reinterpret_cast<const std::regex*>(userData);
-    if (std::regex_match(str, *regex))
-    {
-        nfDebug("iptables comment %s does match", str);
-        return 0;
-    }
-    else
-    {
-        nfDebug("iptables comment %s doesn't match", str);
-        return 1;
-    }
+    return std::regex_match(str, *regex) ? 0 : 1;
+}
+
+// -----------------------------------------------------------------------------
+/*!
+    \internal
+    Helper callback used to match a comment string exactly.
+ */
+static int exactMatcher(const char *str, void *userData)
+{
+    auto comment = reinterpret_cast<const std::string*>(userData);
+    return (comment->compare(str) == 0) ? 0 : 1;
+}
+
+// -----------------------------------------------------------------------------
+/*!
+    \internal
+    Called for every rule applied by a committed transaction, adds the rule to
+    the comment index so it can later be deleted without a table scan.
+ */
+void NetFilter::onRuleAdded(const char *table, const char *chain,
+                            const char *comment, const void *entry,
+                            size_t size, void *userData)
+{
+    (void)userData;
+
+    if (!comment || (comment[0] == '\0'))
+        return;
+
+    const uint8_t *bytes = reinterpret_cast<const uint8_t*>(entry);
+    mCommentIndex[comment].push_back(IndexedRule{ table, chain,
+                                                  std::vector<uint8_t>(bytes, bytes + size) });
 }
 
 // -----------------------------------------------------------------------------
@@ -101,9 +129,18 @@ static int regexMatcher(const char *str, void *userData)
 void NetFilter::removeAllRulesMatchingComment(const std::string &commentMatch)
 {
     LOGINFO("removing all iptables rules whose comments match %s", commentMatch.c_str());
+    std::lock_guard<std::mutex> threadLocker(mThreadLock);
     std::lock_guard<NetFilterLock> locker(mLock);
     std::regex regex(commentMatch);
     ::removeAllRulesMatchingComment(regexMatcher, const_cast<std::regex*>(&regex));
+
+    for (auto it = mCommentIndex.begin(); it != mCommentIndex.end(); )
+    {
+        if (std::regex_match(it->first, regex))
+            it = mCommentIndex.erase(it);
+        else
+            ++it;
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -133,9 +170,10 @@ bool NetFilter::openExternalPort(in_port_t port, Protocol protocol,
            (protocol == Protocol::Tcp) ? "tcp" :
            (protocol == Protocol::Udp) ? "udp" : "???",
            port);
-    std::lock_guard<NetFilterLock> locker(mLock);
 
-    return (::openExternalPort(port, static_cast<int>(protocol), comment.c_str()) == 0);
+    Transaction transaction;
+    return transaction.openExternalPort(port, protocol, comment) &&
+           transaction.commit();
 }
 
 // -----------------------------------------------------------------------------
@@ -172,14 +210,11 @@ bool NetFilter::addContainerPortForwarding(const std::string &bridgeIface,
                                            uint16_t containerPort,
                                            const std::string &comment)
 {
-
-    std::lock_guard<NetFilterLock> locker(mLock);
-
-    return (::addContainerHolePunch(bridgeIface.c_str(),
-                                    static_cast<int>(protocol),
-                                    externalPort,
-                                    containerIp, containerPort,
-                                    comment.c_str()) == 0);
+    Transaction transaction;
+    return transaction.addContainerPortForwarding(bridgeIface, protocol,
+                                                  externalPort, containerIp,
+                                                  containerPort, comment) &&
+           transaction.commit();
 }
 
 // -----------------------------------------------------------------------------
@@ -195,6 +230,7 @@ std::list<NetFilter::PortForward> NetFilter::getContainerPortForwardList(const s
                                                                      const in_addr_t &containerIp)
 {
     LOGINFO("finding NAT PREROUTING rules that forward to a container ip address %u", containerIp);
+    std::unique_lock<std::mutex> threadLocker(mThreadLock);
     std::unique_lock<NetFilterLock> locker(mLock);
 
     HolePunchEntry entries[32];
@@ -203,6 +239,7 @@ std::list<NetFilter::PortForward> NetFilter::getContainerPortForwardList(const s
     ::getContainerHolePunchedPorts(bridgeIface.c_str(), containerIp, entries, &count);
 
     locker.unlock();
+    threadLocker.unlock();
 
     std::list<PortForward> values;
     for (size_t i = 0; i < count; i++)
@@ -228,3 +265,121 @@ std::list<NetFilter::PortForward> NetFilter::getContainerPortForwardList(const s
     return values;
 }
 
+// -----------------------------------------------------------------------------
+/*!
+    \class NetFilter::Transaction
+
+    Collects rule changes, typically all the rules for one container, and
+    applies them with a single iptc_init / iptc_commit per table.
+
+    Rules added by a committed transaction are stored in a comment index, so
+    removeRulesWithComment() can delete them directly rather than walking every
+    rule in the filter and nat tables.
+
+ */
+NetFilter::Transaction::Transaction()
+    : mThreadLocker(mThreadLock)
+    , mLocker(mLock)
+    , mTransaction(nfTransactionBegin())
+{
+}
+
+NetFilter::Transaction::~Transaction()
+{
+    // discard anything that wasn't committed
+    nfTransactionAbort(mTransaction);
+}
+
+bool NetFilter::Transaction::openExternalPort(in_port_t port, Protocol protocol,
+                                              const std::string &comment)
+{
+    if (!mTransaction)
+        return false;
+
+    return (::nfTransactionOpenExternalPort(mTransaction, port,
+                                            static_cast<int>(protocol),
+                                            comment.c_str()) == 0);
+}
+
+bool NetFilter::Transaction::addContainerPortForwarding(const std::string &bridgeIface,
+                                                        Protocol protocol,
+                                                        uint16_t externalPort,
+                                                        const in_addr_t &containerIp,
+                                                        uint16_t containerPort,
+                                                        const std::string &comment)
+{
+    if (!mTransaction)
+        return false;
+
+    return (::nfTransactionAddContainerHolePunch(mTransaction, bridgeIface.c_str(),
+                                                 static_cast<int>(protocol),
+                                                 externalPort,
+                                                 containerIp, containerPort,
+                                                 comment.c_str()) == 0);
+}
+
+// -----------------------------------------------------------------------------
+/*!
+    Removes all rules whose comment is exactly \a comment.
+
+    Rules committed by this process are deleted using the comment index.  If
+    the comment isn't indexed (i.e. the rules were added by a previous
+    instance) or an indexed rule can't be found, the tables are scanned.
+
+ */
+void NetFilter::Transaction::removeRulesWithComment(const std::string &comment)
+{
+    if (!mTransaction)
+        return;
+
+    LOGINFO("removing all iptables rules with comment %s", comment.c_str());
+
+    bool scan = true;
+
+    auto it = mCommentIndex.find(comment);
+    if (it != mCommentIndex.end())
+    {
+        scan = false;
+        for (const IndexedRule &rule : it->second)
+        {
+            if (::nfTransactionDeleteRule(mTransaction, rule.table.c_str(),
+                                          rule.chain.c_str(), rule.entry.data(),
+                                          rule.entry.size()) != 0)
+            {
+                scan = true;
+            }
+        }
+    }
+
+    if (scan)
+    {
+        ::nfTransactionDeleteRulesMatchingComment(mTransaction, exactMatcher,
+                                                  const_cast<std::string*>(&comment));
+    }
+
+    mRemovedComments.push_back(comment);
+}
+
+// -----------------------------------------------------------------------------
+/*!
+    Applies the changes, returning \c false if any table failed to commit.
+
+    The transaction can't be used after it has been committed.
+
+ */
+bool NetFilter::Transaction::commit()
+{
+    if (!mTransaction)
+        return false;
+
+    // the removed rules are dropped from the index even if the commit fails,
+    // a later removal then falls back to scanning the tables
+    for (const std::string &comment : mRemovedComments)
+        mCommentIndex.erase(comment);
+    mRemovedComments.clear();
+
+    const int result = ::nfTransactionCommit(mTransaction, onRuleAdded, nullptr);
+    mTransaction = nullptr;
+
+    return (result == 0);
+}
@@ -14,6 +14,11 @@
 #include <netdb.h>
 #include <sys/socket.h>
 #include <list>
+#include <map>
+#include <mutex>
+#include <vector>
+
+struct NfTransaction;
 
 class NetFilter
 {
@@ -46,8 +51,57 @@ public:
     static std::list<NetFilter::PortForward> getContainerPortForwardList(const std::string &bridgeIface,
                                                           const in_addr_t &containerIp = 0);
 
+    // Batches rule changes so each table is read and committed once.  The
+    // iptables lock is held for the lifetime of the object; changes that
+    // aren't committed are discarded on destruction.  The other NetFilter
+    // methods must not be called from the same thread while one is alive.
+    class Transaction
+    {
+    public:
+        Transaction();
+        ~Transaction();
+
+        Transaction(const Transaction&) = delete;
+        Transaction &operator=(const Transaction&) = delete;
+
+    public:
+        bool openExternalPort(in_port_t port, Protocol protocol,
+                              const std::string &comment);
+
+        bool addContainerPortForwarding(const std::string &bridgeIface,
+                                        Protocol protocol,
+                                        uint16_t externalPort,
+                                        const in_addr_t &containerIp,
+                                        uint16_t containerPort,
+                                        const std::string &comment);
+
+        void removeRulesWithComment(const std::string &comment);
+
+        bool commit();
+
+    private:
+        std::unique_lock<std::mutex> mThreadLocker;
+        std::unique_lock<NetFilterLock> mLocker;
+        NfTransaction *mTransaction;
+        std::vector<std::string> mRemovedComments;
+    };
+
+private:
+    struct IndexedRule
+    {
+        std::string table;
+        std::string chain;
+        std::vector<uint8_t> entry;
+    };
+
+    static void onRuleAdded(const char *table, const char *chain,
+                            const char *comment, const void *entry,
+                            size_t size, void *userData);
+
 private:
     static NetFilterLock mLock;
+    static std::mutex mThreadLock;
+    static std::map<std::string, std::list<IndexedRule>> mCommentIndex;
 };
 
 #endif // NETFILTER_H
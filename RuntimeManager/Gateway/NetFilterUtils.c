@@ -44,6 +44,33 @@ struct xt_dnat_info
 };
 
 
+// the tables a transaction can modify, in the order they are committed
+enum NfTable
+{
+    NF_TABLE_NAT,
+    NF_TABLE_FILTER,
+    NF_TABLE_COUNT
+};
+
+static const char * const nfTableNames[NF_TABLE_COUNT] = { "nat", "filter" };
+
+// a rule inserted by a transaction, reported to the caller once committed
+struct NfPendingRule
+{
+    enum NfTable table;
+    xt_chainlabel chainName;
+    struct ipt_entry *entry;
+    struct NfPendingRule *next;
+};
+
+struct NfTransaction
+{
+    struct xtc_handle *tables[NF_TABLE_COUNT];
+    unsigned int changes[NF_TABLE_COUNT];
+    struct NfPendingRule *added;
+};
+
+
 // -----------------------------------------------------------------------------
 /*!
     \internal
@@ -257,37 +284,228 @@ static bool getEntryTcpUdpMatchPort(const struct ipt_entry *entry, int *protocol
 
 // -----------------------------------------------------------------------------
 /*!
-    Removes all rules in iptables that have matching comments files with
-    \a commentMatch.
+    \internal
+
+    Returns the handle for \a table in the transaction, reading the table from
+    the kernel the first time it is used.
 
  */
-int removeAllRulesMatchingComment(NfCommentMatcher matcher, void *userData)
+static struct xtc_handle *transactionTable(struct NfTransaction *tx, enum NfTable table)
 {
-    static const char *tableNames[] = { "filter", "nat", NULL };
-    for (const char **tableName = tableNames; *tableName != NULL; tableName++)
+    if (!tx->tables[table])
     {
-        nfDebug("processing table '%s'", *tableName);
+        tx->tables[table] = iptc_init(nfTableNames[table]);
+        if (!tx->tables[table])
+            nfError("failed to open table '%s'", nfTableNames[table]);
+    }
 
-        // open the table object
-        struct xtc_handle *table = iptc_init(*tableName);
-        if (!table)
-        {
-            nfError("failed to open table '%s'", *tableName);
+    return tx->tables[table];
+}
+
+// -----------------------------------------------------------------------------
+/*!
+    \internal
+
+    Records a rule inserted into \a chainName so it can be reported when the
+    transaction is committed.  Takes ownership of \a entry.
+
+ */
+static void recordAddedRule(struct NfTransaction *tx, enum NfTable table,
+                            const char *chainName, struct ipt_entry *entry)
+{
+    struct NfPendingRule *rule = calloc(1, sizeof(struct NfPendingRule));
+    if (!rule)
+    {
+        nfError("failed to allocate pending rule for '%s:%s'",
+                nfTableNames[table], chainName);
+        free(entry);
+        return;
+    }
+
+    rule->table = table;
+    strncpy(rule->chainName, chainName, sizeof(rule->chainName) - 1);
+    rule->entry = entry;
+    rule->next = tx->added;
+    tx->added = rule;
+}
+
+// -----------------------------------------------------------------------------
+/*!
+    Starts a new transaction.  No tables are read until the first change is
+    made to them.
+
+    The caller is expected to hold the xtables lock until the transaction is
+    committed or aborted.
+
+ */
+struct NfTransaction *nfTransactionBegin(void)
+{
+    struct NfTransaction *tx = calloc(1, sizeof(struct NfTransaction));
+    if (!tx)
+        nfError("failed to allocate netfilter transaction");
+
+    return tx;
+}
+
+// -----------------------------------------------------------------------------
+/*!
+    Commits the changed tables of the transaction, one iptc_commit per table,
+    and then frees it.
+
+    Tables are committed in order nat, filter; if a commit fails the remaining
+    tables are discarded.  \a added (if not NULL) is called for every rule
+    inserted into a table that was committed.
+
+ */
+int nfTransactionCommit(struct NfTransaction *tx, NfRuleCallback added, void *userData)
+{
+    int result = 0;
+    bool committed[NF_TABLE_COUNT] = { false };
+
+    for (int table = 0; table < NF_TABLE_COUNT; table++)
+    {
+        if (!tx->tables[table] || (tx->changes[table] == 0))
             continue;
+
+        if (!iptc_commit(tx->tables[table]))
+        {
+            nfSysError(errno, "failed to commit changes to table '%s'",
+                       nfTableNames[table]);
+            result = -1;
+            break;
         }
 
-        // counts the number of changes make in the table
-        unsigned int changes = 0;
+        committed[table] = true;
+    }
+
+    if (added)
+    {
+        for (const struct NfPendingRule *rule = tx->added; rule; rule = rule->next)
+        {
+            if (!committed[rule->table])
+                continue;
+
+            char comment[XT_MAX_COMMENT_LEN + 1] = { '\0' };
+            getEntryComment(rule->entry, comment);
+
+            added(nfTableNames[rule->table], rule->chainName, comment,
+                  rule->entry, rule->entry->next_offset, userData);
+        }
+    }
+
+    nfTransactionAbort(tx);
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+/*!
+    Discards any uncommitted changes and frees the transaction.
+
+ */
+void nfTransactionAbort(struct NfTransaction *tx)
+{
+    if (!tx)
+        return;
+
+    for (int table = 0; table < NF_TABLE_COUNT; table++)
+    {
+        if (tx->tables[table])
+            iptc_free(tx->tables[table]);
+    }
+
+    struct NfPendingRule *rule = tx->added;
+    while (rule)
+    {
+        struct NfPendingRule *next = rule->next;
+        free(rule->entry);
+        free(rule);
+        rule = next;
+    }
+
+    free(tx);
+}
+
+// -----------------------------------------------------------------------------
+/*!
+    Deletes the rule in \a chainName that is byte-for-byte identical to
+    \a entry, as previously reported by nfTransactionCommit().  This avoids
+    having to walk every rule in the table.
+
+    Returns -1 if the table can't be opened or the rule is no longer present.
+
+ */
+int nfTransactionDeleteRule(struct NfTransaction *tx, const char *tableName,
+                            const char *chainName, const void *entry, size_t size)
+{
+    const struct ipt_entry *rule = (const struct ipt_entry*)entry;
+
+    int table = 0;
+    while ((table < NF_TABLE_COUNT) && (strcmp(nfTableNames[table], tableName) != 0))
+        table++;
+
+    if ((table == NF_TABLE_COUNT) || (size < sizeof(struct ipt_entry)) ||
+        (rule->next_offset != size))
+    {
+        nfError("invalid rule for '%s:%s'", tableName, chainName);
+        return -1;
+    }
+
+    struct xtc_handle *handle = transactionTable(tx, table);
+    if (!handle)
+        return -1;
+
+    // every byte of the matches and target has to be the same
+    unsigned char *matchMask = malloc(size);
+    if (!matchMask)
+    {
+        nfError("failed to allocate match mask");
+        return -1;
+    }
+    memset(matchMask, 0xff, size);
+
+    const int deleted = iptc_delete_entry(chainName, rule, matchMask, handle);
+    free(matchMask);
+
+    if (!deleted)
+    {
+        nfDebug("rule not found in '%s:%s'", tableName, chainName);
+        return -1;
+    }
+
+    tx->changes[table]++;
+    return 0;
+}
+
+// -----------------------------------------------------------------------------
+/*!
+    Deletes all rules in the filter and nat tables whose comment is accepted
+    by \a matcher (i.e. it returns 0).  Every rule with a comment is checked,
+    so prefer nfTransactionDeleteRule() when the rules are known.
+
+    Returns the number of rules deleted.
+
+ */
+int nfTransactionDeleteRulesMatchingComment(struct NfTransaction *tx,
+                                            NfCommentMatcher matcher, void *userData)
+{
+    int deleted = 0;
+
+    for (int table = 0; table < NF_TABLE_COUNT; table++)
+    {
+        const char *tableName = nfTableNames[table];
+        nfDebug("processing table '%s'", tableName);
+
+        struct xtc_handle *handle = transactionTable(tx, table);
+        if (!handle)
+            continue;
 
         // loop through all chains
-        const char *chainName = iptc_first_chain(table);
+        const char *chainName = iptc_first_chain(handle);
         while (chainName)
         {
-            nfDebug("processing chain '%s'", chainName);
-
             // process all the rules in the chain
             unsigned int index = 0;
-            const struct ipt_entry *entry = iptc_first_rule(chainName, table);
+            const struct ipt_entry *entry = iptc_first_rule(chainName, handle);
             while (entry)
             {
                 // check if the entry matches one in the list we're supposed to
@@ -297,46 +515,57 @@ int removeAllRulesMatchingComment(NfCommentMatcher matcher, void *userData)
 
                 // move to the next entry so if the rule is deleted the iterator
                 // is still valid
-                entry = iptc_next_rule(entry, table);
+                entry = iptc_next_rule(entry, handle);
 
                 // skip over if doesn't match
-                if ((strlen(comment) == 0) || (matcher(comment, userData) != 0))
+                if ((comment[0] == '\0') || (matcher(comment, userData) != 0))
                 {
                     index++;
                     continue;
                 }
 
                 nfInfo("deleting rule at index %d from '%s:%s'",
-                            index, *tableName, chainName);
+                            index, tableName, chainName);
 
                 // it is safe to delete the entry we're currently
                 // iterating on
-                if (iptc_delete_num_entry(chainName, index, table))
+                if (iptc_delete_num_entry(chainName, index, handle))
                 {
-                    changes++;
+                    tx->changes[table]++;
+                    deleted++;
                 }
                 else
                 {
                     nfSysError(errno, "failed to delete rule at index %u in '%s:%s'",
-                                    index, *tableName, chainName);
+                                    index, tableName, chainName);
                     index++;
                 }
              }
 
             // move to next chain
-            chainName = iptc_next_chain(table);
+            chainName = iptc_next_chain(handle);
         }
+    }
 
-        // commit the changes (if any)
-        if (changes && !iptc_commit(table))
-        {
-            nfSysError(errno, "failed to commit changes to table '%s'",
-                            *tableName);
-        }
+    return deleted;
+}
 
-        // free the table
-        iptc_free(table);
-    }
+// -----------------------------------------------------------------------------
+/*!
+    Removes all rules in iptables that have matching comments files with
+    \a commentMatch.
+
+ */
+int removeAllRulesMatchingComment(NfCommentMatcher matcher, void *userData)
+{
+    struct NfTransaction *tx = nfTransactionBegin();
+    if (!tx)
+        return -1;
+
+    nfTransactionDeleteRulesMatchingComment(tx, matcher, userData);
+
+    // commit the changes (if any)
+    nfTransactionCommit(tx, NULL, NULL);
 
     return 0;
 }
@@ -689,70 +918,78 @@ static struct ipt_entry *createOutputFilterRule(in_port_t port, int protocol, co
 
     \endcode
 
+    The rules are only applied when \a tx is committed.
+
  */
-int openExternalPort(in_port_t port, int protocol, const char *comment)
+int nfTransactionOpenExternalPort(struct NfTransaction *tx, in_port_t port,
+                                  int protocol, const char *comment)
 {
     static const xt_chainlabel INPUT = "INPUT";
     static const xt_chainlabel OUTPUT = "OUTPUT";
 
-    // open the filter table object
-    struct xtc_handle *table = iptc_init("filter");
+    // get the filter table object
+    struct xtc_handle *table = transactionTable(tx, NF_TABLE_FILTER);
     if (!table)
-    {
-        nfError("failed to open table 'filter'");
         return -1;
-    }
 
 
     struct ipt_entry *inputEntry = createInputFilterRule(port, protocol, comment);
     if (!inputEntry)
     {
         nfError("failed to create input filter rule");
-        iptc_free(table);
         return -1;
     }
-    if (!iptc_insert_entry(INPUT, inputEntry, 1, table))
+    if (!iptc_insert_entry(INPUT, inputEntry, 0, table))
     {
         nfSysError(errno, "failed to insert rule into table 'filter'");
         free(inputEntry);
-        iptc_free(table);
         return -1;
     }
 
-    free(inputEntry);
-
 
     struct ipt_entry *outputEntry = createOutputFilterRule(port, protocol, comment);
     if (!outputEntry)
     {
         nfError("failed to create output filter rule");
-        iptc_delete_num_entry(INPUT, 1, table);
-        iptc_free(table);
+        iptc_delete_num_entry(INPUT, 0, table);
+        free(inputEntry);
         return -1;
     }
-    if (!iptc_insert_entry(OUTPUT, outputEntry, 1, table))
+    if (!iptc_insert_entry(OUTPUT, outputEntry, 0, table))
     {
         nfSysError(errno, "failed to insert rule into table 'filter'");
         free(outputEntry);
-        iptc_delete_num_entry(INPUT, 1, table);
-        iptc_free(table);
+        iptc_delete_num_entry(INPUT, 0, table);
+        free(inputEntry);
         return -1;
     }
 
-    free(outputEntry);
+    tx->changes[NF_TABLE_FILTER] += 2;
 
+    recordAddedRule(tx, NF_TABLE_FILTER, INPUT, inputEntry);
+    recordAddedRule(tx, NF_TABLE_FILTER, OUTPUT, outputEntry);
 
-    // commit the changes (if any)
-    if (!iptc_commit(table))
+    return 0;
+}
+
+// -----------------------------------------------------------------------------
+/*!
+    Single change version of nfTransactionOpenExternalPort().
+
+ */
+int openExternalPort(in_port_t port, int protocol, const char *comment)
+{
+    struct NfTransaction *tx = nfTransactionBegin();
+    if (!tx)
+        return -1;
+
+    if (nfTransactionOpenExternalPort(tx, port, protocol, comment) != 0)
     {
-        nfSysError(errno, "failed to commit changes to table 'filter'");
-        iptc_free(table);
+        nfTransactionAbort(tx);
         return -1;
     }
 
-    // free the table
-    iptc_free(table);
-    return 0;
+    return nfTransactionCommit(tx, NULL, NULL);
 }
 
 // -----------------------------------------------------------------------------
@@ -997,96 +1234,94 @@ static struct ipt_entry *createForwardingRule(const char *bridgeIface, int proto
             -j ACCEPT
     \endcode
 
+    The rules are only applied when \a tx is committed.
+
  */
-int addContainerHolePunch(const char *bridgeIface, int protocol,
-                          in_port_t externalPort, in_addr_t containerIp,
-                          in_port_t containerPort, const char *comment)
+int nfTransactionAddContainerHolePunch(struct NfTransaction *tx,
+                                       const char *bridgeIface, int protocol,
+                                       in_port_t externalPort, in_addr_t containerIp,
+                                       in_port_t containerPort, const char *comment)
 {
     static const xt_chainlabel PREROUTING = "PREROUTING";
     static const xt_chainlabel FORWARD = "FORWARD";
 
-    {
-        // open the nat table object
-        struct xtc_handle *natTable = iptc_init("nat");
-        if (!natTable)
-        {
-            nfError("failed to open table 'nat'");
-            return -1;
-        }
+    // get the nat and filter table objects
+    struct xtc_handle *natTable = transactionTable(tx, NF_TABLE_NAT);
+    if (!natTable)
+        return -1;
+
+    struct xtc_handle *filterTable = transactionTable(tx, NF_TABLE_FILTER);
+    if (!filterTable)
+        return -1;
 
-        struct ipt_entry *natEntry = createDNATRule(bridgeIface, protocol,
-                                                    externalPort,
-                                                    containerIp, containerPort,
-                                                    comment);
-        if (!natEntry)
-        {
-            nfError("failed to create PREROUTING nat rule");
-            iptc_free(natTable);
-            return -1;
-        }
-        if (!iptc_insert_entry(PREROUTING, natEntry, 1, natTable))
-        {
-            nfSysError(errno, "failed to insert rule into table 'nat'");
-            free(natEntry);
-            iptc_free(natTable);
-            return -1;
-        }
 
+    struct ipt_entry *natEntry = createDNATRule(bridgeIface, protocol,
+                                                externalPort,
+                                                containerIp, containerPort,
+                                                comment);
+    if (!natEntry)
+    {
+        nfError("failed to create PREROUTING nat rule");
+        return -1;
+    }
+    if (!iptc_insert_entry(PREROUTING, natEntry, 0, natTable))
+    {
+        nfSysError(errno, "failed to insert rule into table 'nat'");
         free(natEntry);
+        return -1;
+    }
 
-        // commit the changes (if any)
-        if (!iptc_commit(natTable))
-        {
-            nfSysError(errno, "failed to commit changes to table 'nat'");
-            iptc_free(natTable);
-            return -1;
-        }
 
-        // free the table
-        iptc_free(natTable);
+    struct ipt_entry *forwardEntry = createForwardingRule(bridgeIface, protocol,
+                                                          containerIp, containerPort,
+                                                          comment);
+    if (!forwardEntry)
+    {
+        nfError("failed to create FORWARD filter rule");
+        iptc_delete_num_entry(PREROUTING, 0, natTable);
+        free(natEntry);
+        return -1;
     }
-
+    if (!iptc_insert_entry(FORWARD, forwardEntry, 0, filterTable))
     {
-        // open the filter table object
-        struct xtc_handle *filterTable = iptc_init("filter");
-        if (!filterTable)
-        {
-            nfError("failed to open table 'filter'");
-            return -1;
-        }
+        nfSysError(errno, "failed to insert FORWARD rule into table 'filter'");
+        free(forwardEntry);
+        iptc_delete_num_entry(PREROUTING, 0, natTable);
+        free(natEntry);
+        return -1;
+    }
 
-        struct ipt_entry *forwardEntry = createForwardingRule(bridgeIface, protocol,
-                                                              containerIp, containerPort,
-                                                              comment);
-        if (!forwardEntry)
-        {
-            nfError("failed to create FORWARD filter rule");
-            iptc_free(filterTable);
-            return -1;
-        }
-        if (!iptc_insert_entry(FORWARD, forwardEntry, 1, filterTable))
-        {
-            nfSysError(errno, "failed to insert FORWARD rule into table 'filter'");
-            free(forwardEntry);
-            iptc_free(filterTable);
-            return -1;
-        }
+    tx->changes[NF_TABLE_NAT]++;
+    tx->changes[NF_TABLE_FILTER]++;
 
-        free(forwardEntry);
+    recordAddedRule(tx, NF_TABLE_NAT, PREROUTING, natEntry);
+    recordAddedRule(tx, NF_TABLE_FILTER, FORWARD, forwardEntry);
 
-        // commit the changes (if any)
-        if (!iptc_commit(filterTable))
-        {
-            nfSysError(errno, "failed to commit changes to table 'filter'");
-            iptc_free(filterTable);
-            return -1;
-        }
+    return 0;
+}
 
-        // free the table
-        iptc_free(filterTable);
+// -----------------------------------------------------------------------------
+/*!
+    Single change version of nfTransactionAddContainerHolePunch().
+
+ */
+int addContainerHolePunch(const char *bridgeIface, int protocol,
+                          in_port_t externalPort, in_addr_t containerIp,
+                          in_port_t containerPort, const char *comment)
+{
+    struct NfTransaction *tx = nfTransactionBegin();
+    if (!tx)
+        return -1;
+
+    if (nfTransactionAddContainerHolePunch(tx, bridgeIface, protocol,
+                                           externalPort, containerIp,
+                                           containerPort, comment) != 0)
+    {
+        nfTransactionAbort(tx);
+        return -1;
     }
 
-    return 0;
+    return nfTransactionCommit(tx, NULL, NULL);
 }
 
 // -----------------------------------------------------------------------------
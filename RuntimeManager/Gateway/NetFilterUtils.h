@@ -34,6 +34,33 @@ struct HolePunchEntry
 int getContainerHolePunchedPorts(const char *bridgeIface, in_addr_t containerIp,
                                  struct HolePunchEntry *entries, size_t *size);
 
+// A set of rule changes applied with a single iptc_init / iptc_commit per
+// table, rather than one per change.
+struct NfTransaction;
+
+struct NfTransaction *nfTransactionBegin(void);
+
+int nfTransactionOpenExternalPort(struct NfTransaction *tx, in_port_t port,
+                                  int protocol, const char *comment);
+
+int nfTransactionAddContainerHolePunch(struct NfTransaction *tx,
+                                       const char *bridgeIface, int protocol,
+                                       in_port_t externalPort, in_addr_t containerIp,
+                                       in_port_t containerPort, const char *comment);
+
+int nfTransactionDeleteRule(struct NfTransaction *tx, const char *tableName,
+                            const char *chainName, const void *entry, size_t size);
+
+int nfTransactionDeleteRulesMatchingComment(struct NfTransaction *tx,
+                                            NfCommentMatcher matcher, void *userData);
+
+typedef void (*NfRuleCallback)(const char *tableName, const char *chainName,
+                               const char *comment, const void *entry, size_t size,
+                               void *userData);
+int nfTransactionCommit(struct NfTransaction *tx, NfRuleCallback added, void *userData);
+
+void nfTransactionAbort(struct NfTransaction *tx);
+
 #ifdef __cplusplus
 }
 #endif
@@ -57,7 +57,9 @@ WebInspector::~WebInspector()
 {
     LOGINFO("detaching webinspector from %s", mAppId.c_str());
 
-    NetFilter::removeAllRulesMatchingComment(mNetFilterCommentMatcher);
+    NetFilter::Transaction transaction;
+    transaction.removeRulesWithComment(mNetFilterCommentMatcher);
+    transaction.commit();
 }
 
 Debugger::Type WebInspector::type() const
@@ -0,0 +1,81 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "InstanceLockTable.h"
+
+namespace WPEFramework {
+namespace Plugin {
+
+InstanceLockTable::ScopedLock::ScopedLock(InstanceLockTable& table, const std::string& appInstanceId)
+    : mTable(table)
+    , mAppInstanceId(appInstanceId)
+    , mLock(table.acquire(appInstanceId))
+{
+    mLock->lock();
+}
+
+InstanceLockTable::ScopedLock::~ScopedLock()
+{
+    mLock->unlock();
+    mLock.reset();
+    mTable.prune(mAppInstanceId);
+}
+
+InstanceLockTable::InstanceLockTable()
+    : mLock()
+    , mInstanceLocks()
+{
+}
+
+InstanceLockTable::~InstanceLockTable()
+{
+}
+
+size_t InstanceLockTable::size() const
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mInstanceLocks.size();
+}
+
+std::shared_ptr<std::mutex> InstanceLockTable::acquire(const std::string& appInstanceId)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    std::shared_ptr<std::mutex>& entry = mInstanceLocks[appInstanceId];
+    if (!entry)
+    {
+        entry = std::make_shared<std::mutex>();
+    }
+    return entry;
+}
+
+void InstanceLockTable::prune(const std::string& appInstanceId)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    /* References are only added under mLock, so a table-only reference stays unused */
+    auto it = mInstanceLocks.find(appInstanceId);
+    if ((it != mInstanceLocks.end()) && (it->second.use_count() == 1))
+    {
+        mInstanceLocks.erase(it);
+    }
+}
+
+} // namespace Plugin
+} // namespace WPEFramework
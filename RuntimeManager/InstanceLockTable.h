@@ -0,0 +1,70 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace WPEFramework {
+namespace Plugin {
+
+    /*
+     * One lock per appInstanceId. Operations on the same container are serialized,
+     * operations on different containers run in parallel. An entry lives only while
+     * somebody holds or waits for it.
+     */
+    class InstanceLockTable
+    {
+        public:
+            class ScopedLock
+            {
+                public:
+                    ScopedLock(InstanceLockTable& table, const std::string& appInstanceId);
+                    ~ScopedLock();
+
+                    ScopedLock(const ScopedLock&) = delete;
+                    ScopedLock& operator=(const ScopedLock&) = delete;
+
+                private:
+                    InstanceLockTable& mTable;
+                    const std::string mAppInstanceId;
+                    std::shared_ptr<std::mutex> mLock;
+            };
+
+            InstanceLockTable();
+            ~InstanceLockTable();
+
+            InstanceLockTable(const InstanceLockTable&) = delete;
+            InstanceLockTable& operator=(const InstanceLockTable&) = delete;
+
+            size_t size() const;
+
+        private:
+            std::shared_ptr<std::mutex> acquire(const std::string& appInstanceId);
+            void prune(const std::string& appInstanceId);
+
+            mutable std::mutex mLock;
+            std::map<std::string, std::shared_ptr<std::mutex>> mInstanceLocks;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,143 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "LaunchProfileCache.h"
+#include "DobbySpecGenerator.h"
+#include "UtilsLogging.h"
+#include <sstream>
+
+namespace WPEFramework {
+namespace Plugin {
+
+namespace {
+
+const char KEY_SEPARATOR = '\x1f';
+
+/* The RuntimeConfig fields a LaunchProfile is derived from */
+std::string profileInputs(const WPEFramework::Exchange::RuntimeConfig& runtimeConfig)
+{
+    std::ostringstream inputs;
+    inputs << runtimeConfig.capabilities << KEY_SEPARATOR
+           << runtimeConfig.envVariables << KEY_SEPARATOR
+           << runtimeConfig.appType << KEY_SEPARATOR
+           << runtimeConfig.systemMemoryLimit << KEY_SEPARATOR
+           << runtimeConfig.gpuMemoryLimit;
+    return inputs.str();
+}
+
+std::string packageVersion(const WPEFramework::Exchange::RuntimeConfig& runtimeConfig)
+{
+    return runtimeConfig.unpackedPath.empty() ? runtimeConfig.appPath : runtimeConfig.unpackedPath;
+}
+
+} // namespace
+
+LaunchProfileCache::LaunchProfileCache(size_t maxEntries)
+    : mLock()
+    , mProfiles()
+    , mInsertionOrder()
+    , mMaxEntries(maxEntries)
+    , mBuildCount(0)
+{
+}
+
+std::shared_ptr<const LaunchProfile> LaunchProfileCache::get(const std::string& appId,
+                                                             const WPEFramework::Exchange::RuntimeConfig& runtimeConfig,
+                                                             AIConfiguration* aiConfiguration)
+{
+    const std::string inputs = profileInputs(runtimeConfig);
+
+    const std::string key = appId + KEY_SEPARATOR + packageVersion(runtimeConfig) + KEY_SEPARATOR + inputs;
+
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        auto it = mProfiles.find(key);
+        if (it != mProfiles.end())
+        {
+            return it->second.profile;
+        }
+    }
+
+    /* Built without the lock; a concurrent launch of the same app may build it too */
+    std::shared_ptr<LaunchProfile> profile = std::make_shared<LaunchProfile>();
+    DobbySpecGenerator::buildLaunchProfile(aiConfiguration, runtimeConfig, *profile);
+    LOGINFO("Built launch profile for appId=%s", appId.c_str());
+
+    std::lock_guard<std::mutex> lock(mLock);
+    mBuildCount++;
+
+    auto it = mProfiles.find(key);
+    if (it == mProfiles.end())
+    {
+        /* evict the oldest profile once the cache is full */
+        while (!mInsertionOrder.empty() && (mProfiles.size() >= mMaxEntries))
+        {
+            mProfiles.erase(mInsertionOrder.front());
+            mInsertionOrder.pop_front();
+        }
+        mInsertionOrder.push_back(key);
+    }
+
+    Entry& entry = mProfiles[key];
+    entry.appId = appId;
+    entry.profile = profile;
+
+    return profile;
+}
+
+void LaunchProfileCache::invalidate(const std::string& appId)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    for (auto it = mInsertionOrder.begin(); it != mInsertionOrder.end(); )
+    {
+        auto entry = mProfiles.find(*it);
+        if ((entry != mProfiles.end()) && (entry->second.appId == appId))
+        {
+            mProfiles.erase(entry);
+            it = mInsertionOrder.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void LaunchProfileCache::clear()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    mProfiles.clear();
+    mInsertionOrder.clear();
+}
+
+size_t LaunchProfileCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mProfiles.size();
+}
+
+uint32_t LaunchProfileCache::buildCount() const
+{
+    std::lock_guard<std::mutex> lock(mLock);
+    return mBuildCount;
+}
+
+} // namespace Plugin
+} // namespace WPEFramework
@@ -0,0 +1,101 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <interfaces/IRuntimeManager.h>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <sys/types.h>
+#include <utility>
+#include <vector>
+
+#define LAUNCH_PROFILE_CACHE_MAX_ENTRIES 32
+
+namespace WPEFramework {
+namespace Plugin {
+
+    class AIConfiguration;
+
+    /*
+     * Everything a launch derives from the app's RuntimeConfig and the platform
+     * configuration alone: the parsed capabilities, the resource limits, the
+     * cpuset and the env list. Built once by
+     * DobbySpecGenerator::buildLaunchProfile() and read by Run() and by the
+     * spec generator instead of parsing the same strings on every launch.
+     */
+    struct LaunchProfile
+    {
+        std::vector<std::pair<std::string, std::string>> capabilities;
+        std::string windowManagerCapabilities;
+        bool requiresRialto = false;
+        ssize_t sysMemoryLimit = 0;
+        ssize_t gpuMemoryLimit = 0;
+        std::string cpuCores;
+        std::vector<std::string> envVariables;
+    };
+
+    /*
+     * Launch profiles keyed by appId, package version and the RuntimeConfig
+     * fields they are derived from. RuntimeConfig carries no version, so the unpacked package
+     * path, which is unique per installed version, stands in for it.
+     *
+     * invalidate() drops every profile of an app and is called when a package
+     * is installed or removed, so a reinstall into the same path is picked up.
+     */
+    class LaunchProfileCache
+    {
+        public:
+            explicit LaunchProfileCache(size_t maxEntries = LAUNCH_PROFILE_CACHE_MAX_ENTRIES);
+
+            LaunchProfileCache(const LaunchProfileCache&) = delete;
+            LaunchProfileCache& operator=(const LaunchProfileCache&) = delete;
+
+            /* Returns the cached profile, building it on a miss; aiConfiguration may be null */
+            std::shared_ptr<const LaunchProfile> get(const std::string& appId,
+                                                     const WPEFramework::Exchange::RuntimeConfig& runtimeConfig,
+                                                     AIConfiguration* aiConfiguration);
+
+            void invalidate(const std::string& appId);
+            void clear();
+            size_t size() const;
+
+            /* Number of profiles built since construction */
+            uint32_t buildCount() const;
+
+        private:
+            struct Entry
+            {
+                std::string appId;
+                std::shared_ptr<const LaunchProfile> profile;
+            };
+
+            mutable std::mutex mLock;
+            std::map<std::string, Entry> mProfiles;
+            std::list<std::string> mInsertionOrder;
+            const size_t mMaxEntries;
+            uint32_t mBuildCount;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
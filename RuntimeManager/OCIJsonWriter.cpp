@@ -0,0 +1,259 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include "OCIJsonWriter.h"
+
+#include <cstring>
+
+namespace WPEFramework {
+namespace Plugin {
+
+OCIJsonWriter::OCIJsonWriter(size_t reserveBytes)
+    : mAfterKey(false)
+{
+    mBuffer.reserve(reserveBytes);
+}
+
+void OCIJsonWriter::separate()
+{
+    if (mAfterKey)
+    {
+        mAfterKey = false;
+        return;
+    }
+    if (!mFirstElement.empty())
+    {
+        if (!mFirstElement.back())
+        {
+            mBuffer.push_back(',');
+        }
+        mFirstElement.back() = false;
+    }
+}
+
+void OCIJsonWriter::beginObject()
+{
+    separate();
+    mBuffer.push_back('{');
+    mFirstElement.push_back(true);
+}
+
+void OCIJsonWriter::endObject()
+{
+    mBuffer.push_back('}');
+    mFirstElement.pop_back();
+}
+
+void OCIJsonWriter::beginArray()
+{
+    separate();
+    mBuffer.push_back('[');
+    mFirstElement.push_back(true);
+}
+
+void OCIJsonWriter::endArray()
+{
+    mBuffer.push_back(']');
+    mFirstElement.pop_back();
+}
+
+void OCIJsonWriter::key(const std::string& name)
+{
+    separate();
+    appendQuoted(mBuffer, name.data(), name.size());
+    mBuffer.push_back(':');
+    mAfterKey = true;
+}
+
+void OCIJsonWriter::value(const std::string& text)
+{
+    separate();
+    appendQuoted(mBuffer, text.data(), text.size());
+}
+
+void OCIJsonWriter::value(const char* text)
+{
+    separate();
+    appendQuoted(mBuffer, text, strlen(text));
+}
+
+void OCIJsonWriter::value(int64_t number)
+{
+    separate();
+    mBuffer.append(std::to_string(number));
+}
+
+void OCIJsonWriter::value(uint64_t number)
+{
+    separate();
+    mBuffer.append(std::to_string(number));
+}
+
+void OCIJsonWriter::value(double number)
+{
+    separate();
+    mBuffer.append(Json::valueToString(number));
+}
+
+void OCIJsonWriter::value(bool flag)
+{
+    separate();
+    mBuffer.append(flag ? "true" : "false");
+}
+
+void OCIJsonWriter::value(const Json::Value& node)
+{
+    separate();
+    appendNode(mBuffer, node);
+}
+
+void OCIJsonWriter::null()
+{
+    separate();
+    mBuffer.append("null");
+}
+
+const std::string& OCIJsonWriter::finish()
+{
+    mBuffer.push_back('\n');
+    return mBuffer;
+}
+
+void OCIJsonWriter::clear()
+{
+    mBuffer.clear();
+    mFirstElement.clear();
+    mAfterKey = false;
+}
+
+std::string OCIJsonWriter::write(const Json::Value& root, size_t reserveBytes)
+{
+    std::string out;
+    out.reserve(reserveBytes);
+    appendNode(out, root);
+    out.push_back('\n');
+    return out;
+}
+
+void OCIJsonWriter::appendQuoted(std::string& out, const char* text, size_t length)
+{
+    const size_t start = out.size();
+    out.push_back('"');
+    for (size_t i = 0; i < length; i++)
+    {
+        const unsigned char c = static_cast<unsigned char>(text[i]);
+        switch (c)
+        {
+            case '"':  out.append("\\\""); break;
+            case '\\': out.append("\\\\"); break;
+            case '\b': out.append("\\b"); break;
+            case '\f': out.append("\\f"); break;
+            case '\n': out.append("\\n"); break;
+            case '\r': out.append("\\r"); break;
+            case '\t': out.append("\\t"); break;
+            default:
+                if ((c < 0x20) || (c >= 0x80))
+                {
+                    // Other control characters and UTF-8 are escaped differently across
+                    // jsoncpp releases, so leave those rare strings to jsoncpp itself
+                    out.resize(start);
+                    Json::FastWriter writer;
+                    writer.omitEndingLineFeed();
+                    out.append(writer.write(Json::Value(text, text + length)));
+                    return;
+                }
+                out.push_back(static_cast<char>(c));
+                break;
+        }
+    }
+    out.push_back('"');
+}
+
+void OCIJsonWriter::appendNode(std::string& out, const Json::Value& node)
+{
+    switch (node.type())
+    {
+        case Json::nullValue:
+            out.append("null");
+            break;
+        case Json::intValue:
+            out.append(std::to_string(node.asLargestInt()));
+            break;
+        case Json::uintValue:
+            out.append(std::to_string(node.asLargestUInt()));
+            break;
+        case Json::realValue:
+            out.append(Json::valueToString(node.asDouble()));
+            break;
+        case Json::stringValue:
+        {
+            const char* begin = nullptr;
+            const char* end = nullptr;
+            if (node.getString(&begin, &end))
+            {
+                appendQuoted(out, begin, static_cast<size_t>(end - begin));
+            }
+            else
+            {
+                out.append("\"\"");
+            }
+            break;
+        }
+        case Json::booleanValue:
+            out.append(node.asBool() ? "true" : "false");
+            break;
+        case Json::arrayValue:
+        {
+            out.push_back('[');
+            const Json::ArrayIndex size = node.size();
+            for (Json::ArrayIndex index = 0; index < size; index++)
+            {
+                if (index > 0)
+                {
+                    out.push_back(',');
+                }
+                appendNode(out, node[index]);
+            }
+            out.push_back(']');
+            break;
+        }
+        case Json::objectValue:
+        {
+            // Members are stored ordered by name, which is the order FastWriter emits them in
+            out.push_back('{');
+            for (Json::Value::const_iterator it = node.begin(); it != node.end(); ++it)
+            {
+                if (it != node.begin())
+                {
+                    out.push_back(',');
+                }
+                const char* nameEnd = nullptr;
+                const char* name = it.memberName(&nameEnd);
+                appendQuoted(out, name, static_cast<size_t>(nameEnd - name));
+                out.push_back(':');
+                appendNode(out, *it);
+            }
+            out.push_back('}');
+            break;
+        }
+    }
+}
+
+} // namespace Plugin
+} // namespace WPEFramework
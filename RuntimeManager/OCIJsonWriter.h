@@ -0,0 +1,91 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:
+*
+* Copyright 2026 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <json/json.h>
+
+#define OCI_JSON_WRITER_DEFAULT_RESERVE 8192
+
+namespace WPEFramework {
+namespace Plugin {
+
+    /*
+     * Streaming writer for compact OCI spec JSON. It appends straight into one
+     * preallocated buffer and produces exactly the bytes Json::FastWriter produces
+     * for the same document: no whitespace, object keys in ascending byte order
+     * and a trailing newline added by finish().
+     *
+     * A document can be streamed member by member, or a whole Json::Value subtree
+     * can be written with value(). When streaming, callers emit object keys in
+     * ascending order themselves so that the output stays deterministic.
+     *
+     * DobbySpecModel streams Dobby specs through it; write() serializes the
+     * specs that had a capability overlay merged into their Json::Value form.
+     */
+    class OCIJsonWriter
+    {
+        public:
+            explicit OCIJsonWriter(size_t reserveBytes = OCI_JSON_WRITER_DEFAULT_RESERVE);
+
+            OCIJsonWriter(const OCIJsonWriter&) = delete;
+            OCIJsonWriter& operator=(const OCIJsonWriter&) = delete;
+
+            void beginObject();
+            void endObject();
+            void beginArray();
+            void endArray();
+            void key(const std::string& name);
+
+            void value(const std::string& text);
+            void value(const char* text);
+            void value(int64_t number);
+            void value(uint64_t number);
+            void value(int32_t number) { value(static_cast<int64_t>(number)); }
+            void value(uint32_t number) { value(static_cast<uint64_t>(number)); }
+            void value(double number);
+            void value(bool flag);
+            void value(const Json::Value& node);
+            void null();
+
+            /* Terminates the document and returns it; the writer can be reused after clear(). */
+            const std::string& finish();
+            void clear();
+
+            /* Serializes a complete document, equivalent to Json::FastWriter().write(root). */
+            static std::string write(const Json::Value& root, size_t reserveBytes = OCI_JSON_WRITER_DEFAULT_RESERVE);
+
+            /* Appends text as a quoted JSON string, escaped the way Json::FastWriter escapes it. */
+            static void appendQuoted(std::string& out, const char* text, size_t length);
+
+        private:
+            void separate();
+            static void appendNode(std::string& out, const Json::Value& node);
+
+            std::string mBuffer;
+            // One entry per open object or array: true until its first element is written
+            std::vector<bool> mFirstElement;
+            bool mAfterKey;
+    };
+
+} // namespace Plugin
+} // namespace WPEFramework
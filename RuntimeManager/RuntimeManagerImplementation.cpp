@@ -19,7 +19,6 @@
 
 #include "RuntimeManagerImplementation.h"
 #include "DobbySpecGenerator.h"
-#include "GStreamerRegistry.h"
 #include "UtilsAppManagerTelemetry.h"
 #ifdef RDK_APPMANAGERS_DEBUG
 #include "ContainerUtils.h"
@@ -27,6 +26,8 @@
 #endif
 #include <errno.h>
 #include <fstream>
+#include <system_error>
+#include <thread>
 
 #ifdef RALF_PACKAGE_SUPPORT_ENABLED
 #include "ralf/RalfPackageBuilder.h"
@@ -43,7 +44,7 @@ namespace WPEFramework
         RuntimeManagerImplementation *RuntimeManagerImplementation::_instance = nullptr;
 
         RuntimeManagerImplementation::RuntimeManagerImplementation()
-            : mRuntimeManagerImplLock(), mCurrentservice(nullptr), mOciContainerObject(nullptr), mStorageManagerObject(nullptr), mWindowManagerConnector(nullptr), mDobbyEventListener(nullptr), mUserIdManager(nullptr), mRuntimeAppPortal(""), mRuntimeConfigFile(""), mAIConfiguration(nullptr)
+            : mRuntimeManagerImplLock(), mInstanceLocks(), mCurrentservice(nullptr), mOciContainerObject(nullptr), mStorageManagerObject(nullptr), mWindowManagerConnector(nullptr), mContainerReaper(nullptr), mDobbyEventListener(nullptr), mUserIdManager(nullptr), mRuntimeAppPortal(""), mRuntimeConfigFile(""), mAIConfiguration(nullptr), mPackageInstallerLock(), mPackageInstallerObject(nullptr), mPackageManagerNotification(*this), mPluginStateNotification(*this), mGstRegistry(nullptr), mCgroupStatsSampler(nullptr)
         {
             LOGINFO("Create RuntimeManagerImplementation Instance");
             if (nullptr == RuntimeManagerImplementation::_instance)
@@ -68,8 +69,26 @@ namespace WPEFramework
 
             if (nullptr != mCurrentservice)
             {
-                mCurrentservice->Release();
-                mCurrentservice = nullptr;
+                mCurrentservice->Unregister(&mPluginStateNotification);
+            }
+
+            /* Teardown steps use the plugin objects below; queued ones are resumed on the next start */
+            if (nullptr != mContainerReaper)
+            {
+                delete mContainerReaper;
+                mContainerReaper = nullptr;
+            }
+
+            if (nullptr != mGstRegistry)
+            {
+                delete mGstRegistry;
+                mGstRegistry = nullptr;
+            }
+
+            if (nullptr != mCgroupStatsSampler)
+            {
+                delete mCgroupStatsSampler;
+                mCgroupStatsSampler = nullptr;
             }
 
             if (nullptr != mStorageManagerObject)
@@ -77,6 +96,14 @@ namespace WPEFramework
                 releaseStorageManagerPluginObject();
             }
 
+            {
+                Core::SafeSyncType<Core::CriticalSection> lock(mPackageInstallerLock);
+                if (nullptr != mPackageInstallerObject)
+                {
+                    releasePackageInstallerObject();
+                }
+            }
+
             if (nullptr != mWindowManagerConnector)
             {
                 mWindowManagerConnector->releasePlugin();
@@ -101,6 +128,13 @@ namespace WPEFramework
                 mAIConfiguration = nullptr;
             }
 
+            /* Released last, the plugin objects above were obtained through it */
+            if (nullptr != mCurrentservice)
+            {
+                mCurrentservice->Release();
+                mCurrentservice = nullptr;
+            }
+
             /* Clear any remaining runtime app info entries */
             {
                 Core::SafeSyncType<Core::CriticalSection> lock(mRuntimeManagerImplLock);
@@ -159,14 +193,19 @@ namespace WPEFramework
 
         void RuntimeManagerImplementation::Dispatch(RuntimeEventType event, const JsonValue params)
         {
-            Core::SafeSyncType<Core::CriticalSection> lock(mRuntimeManagerImplLock);
-
-            std::list<Exchange::IRuntimeManager::INotification *>::const_iterator index(mRuntimeManagerNotification.begin());
+            std::list<Exchange::IRuntimeManager::INotification *> notifications;
+#ifdef ENABLE_RIALTO
+            bool usesRialto = false;
+#endif
 
             JsonObject obj = params.Object();
             string appIdFromContainer = obj["containerId"].String();
             string appInstanceId = "";
 
+            /* Map work and a referenced copy of the observers under the lock; the callbacks
+               themselves run unlocked so they may call back into this plugin */
+            mRuntimeManagerImplLock.Lock();
+
             for (const auto& entry : mRuntimeAppInfo)
             {
                 if (entry.second.containerId == appIdFromContainer)
@@ -175,23 +214,16 @@ namespace WPEFramework
                     break;
                 }
             }
+            /* Events raised after the container stopped, such as a failed teardown, name the instance themselves */
+            if (appInstanceId.empty() && obj.HasLabel("appInstanceId"))
+            {
+                appInstanceId = obj["appInstanceId"].String();
+            }
             string eventName = obj["eventName"].String();
             LOGINFO("Dispatching event[%s] for appInstanceId[%s]", eventName.c_str(), appInstanceId.c_str());
 
             switch (event)
             {
-            case RUNTIME_MANAGER_EVENT_STATECHANGED:
-                while (index != mRuntimeManagerNotification.end())
-                {
-                    string containerState = obj["state"];
-                    int containerStateInt = std::stoi(containerState);
-                    RuntimeState state = static_cast<RuntimeState>(containerStateInt);
-                    LOGINFO("state[%d]", state);
-                    (*index)->OnStateChanged(appInstanceId, state);
-                    ++index;
-                }
-                break;
-
             case RUNTIME_MANAGER_EVENT_CONTAINERSTARTED:
             {
                 auto it = mRuntimeAppInfo.find(appInstanceId);
@@ -208,10 +240,9 @@ namespace WPEFramework
                 {
                     LOGERR("RuntimeAppInfo not found for appInstanceId: %s", appInstanceId.c_str());
                 }
-                while (index != mRuntimeManagerNotification.end())
+                if (nullptr != mCgroupStatsSampler)
                 {
-                    (*index)->OnStarted(appInstanceId);
-                    ++index;
+                    mCgroupStatsSampler->addContainer(appIdFromContainer);
                 }
                 break;
             }
@@ -226,28 +257,75 @@ namespace WPEFramework
                     {
                         recordTelemetryData(TELEMETRY_MARKER_CLOSE_TIME, appInfo.appId, appInfo.requestTime);
                     }
+#ifdef ENABLE_RIALTO
+                    usesRialto = appInfo.usesRialto;
+#endif
                 }
                 else
                 {
                     LOGERR("RuntimeAppInfo not found for appInstanceId: %s", appInstanceId.c_str());
                 }
                 /* Remove the runtime app info entry to prevent map from growing indefinitely */
-#ifdef ENABLE_RIALTO
-                bool usesRialto = false;
+                mRuntimeAppInfo.erase(appInstanceId);
+                if (nullptr != mCgroupStatsSampler)
                 {
-                    auto rIt = mRuntimeAppInfo.find(appInstanceId);
-                    if (rIt != mRuntimeAppInfo.end())
-                        usesRialto = rIt->second.usesRialto;
+                    mCgroupStatsSampler->removeContainer(appIdFromContainer);
                 }
-#endif
+                break;
+            }
+
+            case RUNTIME_MANAGER_EVENT_CONTAINERFAILED:
+                /* Remove the runtime app info entry to prevent map from growing indefinitely */
+                mRuntimeAppInfo.erase(appInstanceId);
+                if (nullptr != mCgroupStatsSampler)
+                {
+                    mCgroupStatsSampler->removeContainer(appIdFromContainer);
+                }
+                break;
+
+            default:
+                break;
+            }
+
+            for (auto notification : mRuntimeManagerNotification)
+            {
+                notification->AddRef();
+                notifications.push_back(notification);
+            }
+
+            mRuntimeManagerImplLock.Unlock();
+
+            std::list<Exchange::IRuntimeManager::INotification *>::const_iterator index(notifications.begin());
+
+            switch (event)
+            {
+            case RUNTIME_MANAGER_EVENT_STATECHANGED:
+                while (index != notifications.end())
                 {
-                    mRuntimeAppInfo.erase(appInstanceId);
+                    string containerState = obj["state"];
+                    int containerStateInt = std::stoi(containerState);
+                    RuntimeState state = static_cast<RuntimeState>(containerStateInt);
+                    LOGINFO("state[%d]", state);
+                    (*index)->OnStateChanged(appInstanceId, state);
+                    ++index;
                 }
+                break;
+
+            case RUNTIME_MANAGER_EVENT_CONTAINERSTARTED:
+                while (index != notifications.end())
+                {
+                    (*index)->OnStarted(appInstanceId);
+                    ++index;
+                }
+                break;
+
+            case RUNTIME_MANAGER_EVENT_CONTAINERSTOPPED:
+            {
                 {
                     int32_t exitCode = 0;
                     if (obj.HasLabel("exitCode"))
                         exitCode = static_cast<int32_t>(obj["exitCode"].Number());
-                    while (index != mRuntimeManagerNotification.end())
+                    while (index != notifications.end())
                     {
                         (*index)->OnTerminated(appInstanceId, exitCode);
                         ++index;
@@ -261,6 +339,7 @@ namespace WPEFramework
 #endif // RALF_PACKAGE_SUPPORT_ENABLED
 
 #ifdef ENABLE_RIALTO
+                /* The Rialto state wait can take seconds, keep it outside the map lock */
                 if (usesRialto)
                 {
                     mRialtoConnector->deactivateSession(appInstanceId);
@@ -274,16 +353,12 @@ namespace WPEFramework
             }
 
             case RUNTIME_MANAGER_EVENT_CONTAINERFAILED:
-                while (index != mRuntimeManagerNotification.end())
+                while (index != notifications.end())
                 {
                     string error = obj["errorCode"].String();
                     (*index)->OnFailure(appInstanceId, error);
                     ++index;
                 }
-                /* Remove the runtime app info entry to prevent map from growing indefinitely */
-                {
-                    mRuntimeAppInfo.erase(appInstanceId);
-                }
 #ifdef RALF_PACKAGE_SUPPORT_ENABLED
                 {
                     ralf::RalfPackageBuilder ralfBuilder;
@@ -296,6 +371,11 @@ namespace WPEFramework
                 LOGWARN("Unhandled RuntimeManager event: id=%u", event);
                 break;
             }
+
+            for (auto notification : notifications)
+            {
+                notification->Release();
+            }
         }
 
         uint32_t RuntimeManagerImplementation::Configure(PluginHost::IShell *service)
@@ -334,6 +414,12 @@ namespace WPEFramework
                     LOGINFO("created OCIContainerPluginObject");
                     result = Core::ERROR_NONE;
                 }
+
+                if (nullptr == mContainerReaper)
+                {
+                    mContainerReaper = new ContainerReaper(ContainerReaper::Config());
+                    resumeUnfinishedTeardowns();
+                }
                 RuntimeManagerImplementation::Configuration config;
                 config.FromString(service->ConfigLine());
                 if (!config.runtimeAppPortal.Value().empty())
@@ -348,14 +434,35 @@ namespace WPEFramework
                 LOGINFO("runtimeConfigFile=%s", mRuntimeConfigFile.c_str());
                 mAIConfiguration = new AIConfiguration();
                 mAIConfiguration->initialize(mRuntimeConfigFile);
+                /* Templates and launch profiles were built from the previous platform configuration */
+                mSpecTemplateCache.clear();
+                mLaunchProfileCache.clear();
 
-                if (mAIConfiguration->getGstreamerRegistryEnabled())
+                /* Without install notifications a reinstall into the same path keeps its old profile */
                 {
-                    GStreamerRegistry gstRegistry;
-                    if (gstRegistry.generate())
-                        mGstRegistrySourcePath = gstRegistry.path();
-                    else
-                        LOGWARN("GStreamerRegistry generation failed; containers will not have GST registry bind-mount");
+                    Core::SafeSyncType<Core::CriticalSection> installerLock(mPackageInstallerLock);
+                    if (Core::ERROR_NONE != createPackageInstallerObject())
+                    {
+                        LOGWARN("Package installer unavailable until AppPackageManager is activated");
+                    }
+                }
+                /* Activations are reported right away for plugins that are already up */
+                mCurrentservice->Register(&mPluginStateNotification);
+
+                /* Launches before the check completes simply run without the registry bind-mount */
+                if (mAIConfiguration->getGstreamerRegistryEnabled() && (nullptr == mGstRegistry))
+                {
+                    mGstRegistry = new GStreamerRegistry();
+                    mGstRegistry->start();
+                }
+
+                if ((nullptr == mCgroupStatsSampler) && (mAIConfiguration->getStatsSamplerIntervalMs() > 0))
+                {
+                    CgroupStatsSampler::Config samplerConfig;
+                    samplerConfig.intervalMs = mAIConfiguration->getStatsSamplerIntervalMs();
+                    samplerConfig.cgroupRoot = mAIConfiguration->getStatsSamplerCgroupRoot();
+                    mCgroupStatsSampler = new CgroupStatsSampler(samplerConfig);
+                    mCgroupStatsSampler->start();
                 }
             }
             else
@@ -478,6 +585,104 @@ namespace WPEFramework
             }
         }
 
+        Core::hresult RuntimeManagerImplementation::createPackageInstallerObject()
+        {
+            Core::hresult status = Core::ERROR_GENERAL;
+
+            if (nullptr == mCurrentservice)
+            {
+                LOGERR("mCurrentservice is null");
+            }
+            else if (nullptr != mPackageInstallerObject)
+            {
+                status = Core::ERROR_NONE;
+            }
+            else if (nullptr == (mPackageInstallerObject = mCurrentservice->QueryInterfaceByCallsign<WPEFramework::Exchange::IPackageInstaller>("org.rdk.AppPackageManager")))
+            {
+                LOGERR("mPackageInstallerObject is null");
+            }
+            else
+            {
+                LOGINFO("Registered for package installation status");
+                mPackageInstallerObject->Register(&mPackageManagerNotification);
+                status = Core::ERROR_NONE;
+            }
+            return status;
+        }
+
+        void RuntimeManagerImplementation::releasePackageInstallerObject()
+        {
+            ASSERT(nullptr != mPackageInstallerObject);
+            if (mPackageInstallerObject)
+            {
+                mPackageInstallerObject->Unregister(&mPackageManagerNotification);
+                mPackageInstallerObject->Release();
+                mPackageInstallerObject = nullptr;
+            }
+        }
+
+        /*
+         * @brief : Acquires the package installer once AppPackageManager comes up after Configure
+         */
+        void RuntimeManagerImplementation::onPluginActivated(const string& callsign)
+        {
+            if (callsign != "org.rdk.AppPackageManager")
+            {
+                return;
+            }
+
+            bool acquired = false;
+            {
+                Core::SafeSyncType<Core::CriticalSection> lock(mPackageInstallerLock);
+                acquired = (nullptr == mPackageInstallerObject) && (Core::ERROR_NONE == createPackageInstallerObject());
+            }
+            if (acquired)
+            {
+                /* Installs reported while it was unreachable were missed, so the profiles built meanwhile are dropped */
+                mLaunchProfileCache.clear();
+            }
+        }
+
+        void RuntimeManagerImplementation::onPluginDeactivated(const string& callsign)
+        {
+            if (callsign != "org.rdk.AppPackageManager")
+            {
+                return;
+            }
+
+            Core::SafeSyncType<Core::CriticalSection> lock(mPackageInstallerLock);
+            if (nullptr != mPackageInstallerObject)
+            {
+                LOGINFO("AppPackageManager deactivated, releasing the package installer");
+                releasePackageInstallerObject();
+            }
+        }
+
+        /*
+         * @brief : Drops the launch profiles of apps whose package was installed or removed
+         */
+        void RuntimeManagerImplementation::onAppInstallationStatus(const string& jsonresponse)
+        {
+            JsonArray list;
+            if (jsonresponse.empty() || !list.FromString(jsonresponse))
+            {
+                LOGERR("Failed to parse installation status payload");
+                return;
+            }
+
+            for (size_t i = 0; i < list.Length(); ++i)
+            {
+                JsonObject params = list[i].Object();
+                const string packageId = params["packageId"].String();
+                const string state = params["state"].String();
+                if (!packageId.empty() && ((state == "INSTALLED") || (state == "UNINSTALLED")))
+                {
+                    LOGINFO("Package %s %s, dropping its launch profiles", packageId.c_str(), state.c_str());
+                    mLaunchProfileCache.invalidate(packageId);
+                }
+            }
+        }
+
         /*
          * @brief : Returns the storage information for a given app id using Storage Manager plugin interface
          */
@@ -519,7 +724,8 @@ namespace WPEFramework
             return status;
         }
 
-        bool RuntimeManagerImplementation::generate(const ApplicationConfiguration &config, const WPEFramework::Exchange::RuntimeConfig &runtimeConfigObject, std::string &dobbySpec)
+        bool RuntimeManagerImplementation::generate(const ApplicationConfiguration &config, const WPEFramework::Exchange::RuntimeConfig &runtimeConfigObject, std::string &dobbySpec,
+                                                    const LaunchProfile *launchProfile)
         {
 #ifdef RALF_PACKAGE_SUPPORT_ENABLED
             LOGINFO("Generating Ralf Package Config : %s", runtimeConfigObject.ralfPkgPath.c_str());
@@ -532,8 +738,11 @@ namespace WPEFramework
             return false;
         }
         DobbySpecGenerator generator(*mAIConfiguration);
-        if (!mGstRegistrySourcePath.empty())
-            generator.setGstreamerRegistryPath(mGstRegistrySourcePath);
+        const std::string gstRegistryPath = (nullptr != mGstRegistry) ? mGstRegistry->path() : std::string();
+        if (!gstRegistryPath.empty())
+            generator.setGstreamerRegistryPath(gstRegistryPath);
+        generator.setTemplateCache(&mSpecTemplateCache);
+        generator.setLaunchProfile(launchProfile);
         return generator.generate(config, runtimeConfigObject, dobbySpec);
 #endif // RALF_PACKAGE_SUPPORT_ENABLED
         }
@@ -574,6 +783,7 @@ namespace WPEFramework
             string containerId = "";
 	        if (!appInstanceId.empty())
             {
+                Core::SafeSyncType<Core::CriticalSection> lock(mRuntimeManagerImplLock);
                 auto infoIt = mRuntimeAppInfo.find(appInstanceId);
                 if (infoIt != mRuntimeAppInfo.end())
                 {
@@ -604,6 +814,17 @@ namespace WPEFramework
             /* Get current timestamp at the start of run for telemetry */
             time_t requestTime = getCurrentTimestamp();
 
+            /* A relaunch must not race the teardown of the previous instance */
+            if ((nullptr != mContainerReaper) && !mContainerReaper->waitFor(appInstanceId, RUNTIMEMANAGER_TEARDOWN_WAIT_MILLIS))
+            {
+                LOGERR("Teardown of previous %s still running, not launching", appInstanceId.c_str());
+                return Core::ERROR_GENERAL;
+            }
+
+            /* Serializes against other operations on this instance only; launches of
+               other apps and calls on other containers are not blocked */
+            InstanceLockTable::ScopedLock instanceLock(mInstanceLocks, appInstanceId);
+
             JsonObject eventData;
             eventData["containerId"] = appInstanceId;
             eventData["state"] = static_cast<int>(RUNTIME_STATE_STARTING);
@@ -668,7 +889,15 @@ namespace WPEFramework
                 LOGERR("envVariables is empty inside Run()");
             }
 
+            /* Capabilities, limits and env parsed once per app version and shared with the spec generator */
+            const std::shared_ptr<const LaunchProfile> launchProfile = mLaunchProfileCache.get(appId, runtimeConfigObject, mAIConfiguration);
+
+            /* Stage 1: storage lookup over COM. Nothing else depends on it until the spec is
+               generated, so it runs on its own thread while the display and the Rialto session
+               are set up; the stages are joined before the spec generation. */
             std::string appIdForStorage = appId;
+            Core::hresult storageStatus = Core::ERROR_GENERAL;
+            std::thread storageStage;
 
             if (!appIdForStorage.empty())
             {
@@ -680,22 +909,21 @@ namespace WPEFramework
                 appStorageInfo.userId = 0;
                 appStorageInfo.groupId = 0;
 #endif //RALF_PACKAGE_SUPPORT_ENABLED
-                if (Core::ERROR_NONE == getAppStorageInfo(appIdForStorage, appStorageInfo))
+                try
                 {
-                    config.mAppStorageInfo.path = std::move(appStorageInfo.path);
-#ifdef RALF_PACKAGE_SUPPORT_ENABLED
-                    config.mAppStorageInfo.userId = uid;
-                    config.mAppStorageInfo.groupId = gid;
-#else
-                    config.mAppStorageInfo.userId = uid;
-                    config.mAppStorageInfo.groupId = gid;
-#endif // RALF_PACKAGE_SUPPORT_ENABLED
-                    config.mAppStorageInfo.size = std::move(appStorageInfo.size);
-                    config.mAppStorageInfo.used = std::move(appStorageInfo.used);
+                    storageStage = std::thread([this, &appIdForStorage, &appStorageInfo, &storageStatus]() {
+                        storageStatus = getAppStorageInfo(appIdForStorage, appStorageInfo);
+                    });
+                }
+                catch (const std::system_error& ex)
+                {
+                    LOGWARN("Unable to start storage lookup thread, running it inline: %s", ex.what());
+                    storageStatus = getAppStorageInfo(appIdForStorage, appStorageInfo);
                 }
             }
 
-            /* Creating Display — no lock needed, operates on local/connector state */
+            /* Stage 2: display, then the Rialto session that connects to it — no lock needed,
+               operates on local/connector state */
             if (nullptr != mWindowManagerConnector)
             {
 
@@ -730,14 +958,13 @@ namespace WPEFramework
 #endif
 #ifdef ENABLE_RIALTO
             bool rialtoSetupFailed = false;
+            bool rialtoSessionCreated = false;
             if (displayResult && !xdgRuntimeDir.empty() && !waylandDisplay.empty())
             {
 #ifdef RALF_PACKAGE_SUPPORT_ENABLED
             const bool requiresRialto = true;
 #else
-            std::vector<std::pair<std::string, std::string>> parsedCaps;
-            DobbySpecGenerator::parseCapabilities(runtimeConfigObject.capabilities, parsedCaps);
-            const bool appRequiresRialto = DobbySpecGenerator::hasCapability(parsedCaps, "rialto");
+            const bool appRequiresRialto = launchProfile->requiresRialto;
             const int rialtoOverride = (nullptr != mAIConfiguration) ? mAIConfiguration->getRialtoOverride() : -1;
             const bool requiresRialto = (rialtoOverride >= 0) ? (rialtoOverride > 0) : appRequiresRialto;
 #endif
@@ -762,6 +989,7 @@ namespace WPEFramework
 #endif // RALF_PACKAGE_SUPPORT_ENABLED
                 if (mRialtoConnector->createAppSession(appInstanceId, westerosSocket, rialtoSocket))
                 {
+                    rialtoSessionCreated = true;
                     LOGINFO("[RIALTO] createAppSession succeeded, waiting for ACTIVE state (timeout=%d ms)",
                             RIALTO_TIMEOUT_MILLIS);
                     if (!mRialtoConnector->waitForStateChange(appInstanceId, RialtoServerStates::ACTIVE, RIALTO_TIMEOUT_MILLIS))
@@ -793,6 +1021,20 @@ namespace WPEFramework
 	    }
 #endif // ENABLE_RIALTO
 
+            /* Join the stages before anything reads the storage information */
+            if (storageStage.joinable())
+            {
+                storageStage.join();
+            }
+            if (Core::ERROR_NONE == storageStatus)
+            {
+                config.mAppStorageInfo.path = std::move(appStorageInfo.path);
+                config.mAppStorageInfo.userId = uid;
+                config.mAppStorageInfo.groupId = gid;
+                config.mAppStorageInfo.size = std::move(appStorageInfo.size);
+                config.mAppStorageInfo.used = std::move(appStorageInfo.used);
+            }
+
             LOGINFO("legacyContainer: %s", legacyContainer ? "true" : "false");
             if (xdgRuntimeDir.empty() || waylandDisplay.empty() || !displayResult)
             {
@@ -814,7 +1056,7 @@ namespace WPEFramework
             }
 #endif // ENABLE_RIALTO
             /* Generate dobbySpec for the selected container mode (legacy or non-legacy) */
-            else if (false == generate(config, runtimeConfigObject, dobbySpec))
+            else if (false == generate(config, runtimeConfigObject, dobbySpec, launchProfile.get()))
             {
                 LOGERR("Failed to generate dobbySpec");
                 status = Core::ERROR_GENERAL;
@@ -924,6 +1166,19 @@ namespace WPEFramework
                 }
             }
 
+#ifdef ENABLE_RIALTO
+            /* Roll back the Rialto session when the container did not start */
+            if (rialtoSessionCreated && !success)
+            {
+                LOGINFO("[RIALTO] Releasing Rialto session of appInstanceId='%s' after failed launch", appInstanceId.c_str());
+                mRialtoConnector->deactivateSession(appInstanceId);
+                if (!mRialtoConnector->waitForStateChange(appInstanceId, RialtoServerStates::NOT_RUNNING, RIALTO_TIMEOUT_MILLIS))
+                {
+                    LOGERR("Rialto session state change failed when changing to not running.");
+                }
+            }
+#endif // ENABLE_RIALTO
+
             if (notifyParamCheckFailure)
             {
                 notifyParameterCheckFailure(appInstanceId, errorCode);
@@ -938,19 +1193,24 @@ namespace WPEFramework
             std::string errorReason = "";
             std::string appId = "";
             bool success = false;
+            bool ociValid = false;
+            string containerId = "";
 
             /* Get current timestamp at the start of hibernate for telemetry */
             time_t requestTime = getCurrentTimestamp();
 
-            mRuntimeManagerImplLock.Lock();
+            InstanceLockTable::ScopedLock instanceLock(mInstanceLocks, appInstanceId);
+            {
+                Core::SafeSyncType<Core::CriticalSection> lock(mRuntimeManagerImplLock);
+                ociValid = isOCIPluginObjectValid();
+                containerId = getContainerId(appInstanceId);
+            }
 
-            if(!isOCIPluginObjectValid())
+            if(!ociValid)
             {
-                mRuntimeManagerImplLock.Unlock();
                 LOGERR("OCI Plugin object is not valid. Aborting Hibernate.");
                 return status;
             }
-               string containerId = getContainerId(appInstanceId);
                 if (!containerId.empty())
                 {
                     status = mOciContainerObject->HibernateContainer(containerId, options, success, errorReason);
@@ -961,10 +1221,12 @@ namespace WPEFramework
                     }
                     else
                     {
-                        if (mRuntimeAppInfo.find(appInstanceId) != mRuntimeAppInfo.end())
+                        Core::SafeSyncType<Core::CriticalSection> lock(mRuntimeManagerImplLock);
+                        auto it = mRuntimeAppInfo.find(appInstanceId);
+                        if (it != mRuntimeAppInfo.end())
                         {
-                            mRuntimeAppInfo[appInstanceId].containerState = Exchange::IRuntimeManager::RUNTIME_STATE_HIBERNATING;
-                            appId = mRuntimeAppInfo[appInstanceId].appId;
+                            it->second.containerState = Exchange::IRuntimeManager::RUNTIME_STATE_HIBERNATING;
+                            appId = it->second.appId;
                         }
                     }
                 }
@@ -973,8 +1235,6 @@ namespace WPEFramework
                     LOGERR("appInstanceId is not found or mOciContainerObject is not ready");
                 }
 
-            mRuntimeManagerImplLock.Unlock();
-
             recordTelemetryData(TELEMETRY_MARKER_HIBERNATE_TIME, appId, requestTime);
 
             return status;
@@ -986,22 +1246,31 @@ namespace WPEFramework
             std::string errorReason = "";
             std::string appId = "";
             bool success = false;
+            bool ociValid = false;
+            string containerId = "";
+            RuntimeState currentRuntimeState = Exchange::IRuntimeManager::RUNTIME_STATE_UNKNOWN;
 
             /* Get current timestamp at the start of wake for telemetry */
             time_t requestTime = getCurrentTimestamp();
 
-            mRuntimeManagerImplLock.Lock();
+            InstanceLockTable::ScopedLock instanceLock(mInstanceLocks, appInstanceId);
+            {
+                Core::SafeSyncType<Core::CriticalSection> lock(mRuntimeManagerImplLock);
+                ociValid = isOCIPluginObjectValid();
+                containerId = getContainerId(appInstanceId);
+                if (!containerId.empty())
+                {
+                    currentRuntimeState = getRuntimeState(appInstanceId);
+                }
+            }
 
-            if(!isOCIPluginObjectValid())
+            if(!ociValid)
             {
-                mRuntimeManagerImplLock.Unlock();
                 LOGERR("OCI Plugin object is not valid. Aborting Wake.");
                 return status;
             }
-                string containerId = getContainerId(appInstanceId);
                 if (!containerId.empty())
                 {
-                    RuntimeState currentRuntimeState = getRuntimeState(appInstanceId);
                     if (Exchange::IRuntimeManager::RUNTIME_STATE_HIBERNATING == currentRuntimeState ||
                         Exchange::IRuntimeManager::RUNTIME_STATE_HIBERNATED == currentRuntimeState)
                     {
@@ -1012,18 +1281,28 @@ namespace WPEFramework
                         }
                         else
                         {
-                            if (mRuntimeAppInfo.find(appInstanceId) != mRuntimeAppInfo.end())
+                            bool usesRialto = false;
                             {
-                                mRuntimeAppInfo[appInstanceId].containerState = Exchange::IRuntimeManager::RUNTIME_STATE_WAKING;
-                                appId = mRuntimeAppInfo[appInstanceId].appId;
+                                Core::SafeSyncType<Core::CriticalSection> lock(mRuntimeManagerImplLock);
+                                auto it = mRuntimeAppInfo.find(appInstanceId);
+                                if (it != mRuntimeAppInfo.end())
+                                {
+                                    it->second.containerState = Exchange::IRuntimeManager::RUNTIME_STATE_WAKING;
+                                    appId = it->second.appId;
+#ifdef ENABLE_RIALTO
+                                    usesRialto = it->second.usesRialto;
+#endif
+                                }
                             }
 #ifdef ENABLE_RIALTO
-                            if (!appId.empty() && mRuntimeAppInfo[appInstanceId].usesRialto)
+                            if (!appId.empty() && usesRialto)
                             {
                                 LOGINFO("Rialto session resume for %s", appId.c_str());
                                 if (!mRialtoConnector->resumeSession(appInstanceId))
                                     LOGWARN("Rialto resumeSession failed for %s", appId.c_str());
                             }
+#else
+                            (void)usesRialto;
 #endif
                         }
                     }
@@ -1037,8 +1316,6 @@ namespace WPEFramework
                     LOGERR("appInstanceId is not found ");
                 }
 
-            mRuntimeManagerImplLock.Unlock();
-
             recordTelemetryData(TELEMETRY_MARKER_WAKE_TIME, appId, requestTime);
 
             return status;
@@ -1050,19 +1327,24 @@ namespace WPEFramework
             std::string errorReason = "";
             std::string appId = "";
             bool success = false;
+            bool ociValid = false;
+            string containerId = "";
 
             /* Get current timestamp at the start of suspend for telemetry */
             time_t requestTime = getCurrentTimestamp();
 
-            mRuntimeManagerImplLock.Lock();
+            InstanceLockTable::ScopedLock instanceLock(mInstanceLocks, appInstanceId);
+            {
+                Core::SafeSyncType<Core::CriticalSection> lock(mRuntimeManagerImplLock);
+                ociValid = isOCIPluginObjectValid();
+                containerId = getContainerId(appInstanceId);
+            }
 
-            if(!isOCIPluginObjectValid())
+            if(!ociValid)
             {
-                mRuntimeManagerImplLock.Unlock();
                 LOGERR("OCI Plugin object is not valid. Aborting Suspend.");
                 return status;
             }
-                string containerId = getContainerId(appInstanceId);
 
                 if (!containerId.empty())
                 {
@@ -1073,17 +1355,27 @@ namespace WPEFramework
                     }
                     else
                     {
-                        if (mRuntimeAppInfo.find(appInstanceId) != mRuntimeAppInfo.end())
+                        bool usesRialto = false;
                         {
-                            appId = mRuntimeAppInfo[appInstanceId].appId;
+                            Core::SafeSyncType<Core::CriticalSection> lock(mRuntimeManagerImplLock);
+                            auto it = mRuntimeAppInfo.find(appInstanceId);
+                            if (it != mRuntimeAppInfo.end())
+                            {
+                                appId = it->second.appId;
+#ifdef ENABLE_RIALTO
+                                usesRialto = it->second.usesRialto;
+#endif
+                            }
                         }
 #ifdef ENABLE_RIALTO
-                        if (!appId.empty() && mRuntimeAppInfo[appInstanceId].usesRialto)
+                        if (!appId.empty() && usesRialto)
                         {
                             LOGINFO("Rialto session suspend for %s", appId.c_str());
                             if (!mRialtoConnector->suspendSession(appInstanceId))
                                 LOGWARN("Rialto suspendSession failed for %s", appId.c_str());
                         }
+#else
+                        (void)usesRialto;
 #endif
                     }
                 }
@@ -1092,8 +1384,6 @@ namespace WPEFramework
                     LOGERR("appInstanceId is not found ");
                 }
 
-            mRuntimeManagerImplLock.Unlock();
-
             recordTelemetryData(TELEMETRY_MARKER_SUSPEND_TIME, appId, requestTime);
 
             return status;
@@ -1105,19 +1395,24 @@ namespace WPEFramework
             std::string errorReason = "";
             std::string appId = "";
             bool success = false;
+            bool ociValid = false;
+            string containerId = "";
 
             /* Get current timestamp at the start of resume for telemetry */
             time_t requestTime = getCurrentTimestamp();
 
-            mRuntimeManagerImplLock.Lock();
+            InstanceLockTable::ScopedLock instanceLock(mInstanceLocks, appInstanceId);
+            {
+                Core::SafeSyncType<Core::CriticalSection> lock(mRuntimeManagerImplLock);
+                ociValid = isOCIPluginObjectValid();
+                containerId = getContainerId(appInstanceId);
+            }
 
-            if(!isOCIPluginObjectValid())
+            if(!ociValid)
             {
-                mRuntimeManagerImplLock.Unlock();
                 LOGERR("OCI Plugin object is not valid. Aborting Resume.");
                 return status;
             }
-                string containerId = getContainerId(appInstanceId);
 
                 if (!containerId.empty())
                 {
@@ -1128,17 +1423,27 @@ namespace WPEFramework
                     }
                     else
                     {
-                        if (mRuntimeAppInfo.find(appInstanceId) != mRuntimeAppInfo.end())
+                        bool usesRialto = false;
                         {
-                            appId = mRuntimeAppInfo[appInstanceId].appId;
+                            Core::SafeSyncType<Core::CriticalSection> lock(mRuntimeManagerImplLock);
+                            auto it = mRuntimeAppInfo.find(appInstanceId);
+                            if (it != mRuntimeAppInfo.end())
+                            {
+                                appId = it->second.appId;
+#ifdef ENABLE_RIALTO
+                                usesRialto = it->second.usesRialto;
+#endif
+                            }
                         }
 #ifdef ENABLE_RIALTO
-                        if (!appId.empty() && mRuntimeAppInfo[appInstanceId].usesRialto)
+                        if (!appId.empty() && usesRialto)
                         {
                             LOGINFO("Rialto session resume for %s", appId.c_str());
                             if (!mRialtoConnector->resumeSession(appInstanceId))
                                 LOGWARN("Rialto resumeSession failed for %s", appId.c_str());
                         }
+#else
+                        (void)usesRialto;
 #endif
                     }
                 }
@@ -1146,7 +1451,6 @@ namespace WPEFramework
                 {
                     LOGERR("appInstanceId is empty ");
                 }
-            mRuntimeManagerImplLock.Unlock();
 
             recordTelemetryData(TELEMETRY_MARKER_RESUME_TIME, appId, requestTime);
 
@@ -1154,144 +1458,201 @@ namespace WPEFramework
         }
 
         Core::hresult RuntimeManagerImplementation::Terminate(const string &appInstanceId)
+        {
+            return stopContainer(appInstanceId, false);
+        }
+
+        Core::hresult RuntimeManagerImplementation::Kill(const string &appInstanceId)
+        {
+            return stopContainer(appInstanceId, true);
+        }
+
+        Core::hresult RuntimeManagerImplementation::stopContainer(const string &appInstanceId, const bool force)
         {
             Core::hresult status = Core::ERROR_GENERAL;
-            std::string errorReason = "";
-            bool success = false;
+            bool ociValid = false;
+            bool usesRialto = false;
+            string containerId = "";
+            const char* operation = force ? "Kill" : "Terminate";
 
             /* Get current timestamp at the start of terminate for telemetry */
             time_t requestTime = getCurrentTimestamp();
 
-            mRuntimeManagerImplLock.Lock();
-
-            if(!isOCIPluginObjectValid())
+            InstanceLockTable::ScopedLock instanceLock(mInstanceLocks, appInstanceId);
             {
-                mRuntimeManagerImplLock.Unlock();
-                LOGERR("OCI Plugin object is not valid. Aborting Terminate.");
-                return status;
-            }
-
-            auto it = mRuntimeAppInfo.find(appInstanceId);
-            if (it != mRuntimeAppInfo.end())
-            {
-                it->second.requestTime = requestTime;
-                it->second.requestType = REQUEST_TYPE_TERMINATE;
-            }
-            else
-            {
-                LOGERR("Terminate called for unknown appInstanceId: %s, skipping telemetry update", appInstanceId.c_str());
-            }
-            string containerId = getContainerId(appInstanceId);
-
-                if (!containerId.empty())
+                Core::SafeSyncType<Core::CriticalSection> lock(mRuntimeManagerImplLock);
+                ociValid = isOCIPluginObjectValid();
+                if (ociValid)
                 {
-                    status = mOciContainerObject->StopContainer(containerId, false, success, errorReason);
-                    if (errorReason.compare("Container not found") == 0)
-                    {
-                        LOGINFO("Container is not running, no need to StopContainer");
-                        status = Core::ERROR_NONE;
-                        mUserIdManager->clearUserId(appInstanceId);
-                    }
-                    else if ((success == false) || (status != Core::ERROR_NONE))
+                    auto it = mRuntimeAppInfo.find(appInstanceId);
+                    if (it != mRuntimeAppInfo.end())
                     {
-                        LOGERR("StopContainer failed to terminate %s", errorReason.c_str());
+                        it->second.requestTime = requestTime;
+                        it->second.requestType = force ? REQUEST_TYPE_KILL : REQUEST_TYPE_TERMINATE;
+#ifdef ENABLE_RIALTO
+                        usesRialto = it->second.usesRialto;
+#endif
                     }
                     else
                     {
-                        mUserIdManager->clearUserId(appInstanceId);
-                        if (mRuntimeAppInfo.find(appInstanceId) != mRuntimeAppInfo.end())
-                        {
-                            mRuntimeAppInfo[appInstanceId].containerState = Exchange::IRuntimeManager::RUNTIME_STATE_TERMINATING;
-                        }
+                        LOGERR("%s called for unknown appInstanceId: %s, skipping telemetry update", operation, appInstanceId.c_str());
                     }
+                    containerId = getContainerId(appInstanceId);
                 }
-                else
-                {
-                    LOGERR("appInstanceId is not found");
-                }
-#ifdef ENABLE_RIALTO
-           if (mRuntimeAppInfo.count(appInstanceId) && mRuntimeAppInfo[appInstanceId].usesRialto)
-           {
-               LOGINFO("Rialto session deactivate on terminate.");
-               mRialtoConnector->deactivateSession(appInstanceId);
-               if (!mRialtoConnector->waitForStateChange(appInstanceId, RialtoServerStates::NOT_RUNNING, RIALTO_TIMEOUT_MILLIS))
-               {
-                   LOGERR("Rialto session state change failed when changing to not running.");
-                   status = Core::ERROR_GENERAL;
-               }
-           }
-#endif
-
-            mRuntimeManagerImplLock.Unlock();
-            return status;
-        }
-
-        Core::hresult RuntimeManagerImplementation::Kill(const string &appInstanceId)
-        {
-            Core::hresult status = Core::ERROR_GENERAL;
-            std::string errorReason = "";
-            bool success = false;
-
-            /* Get current timestamp at the start of terminate for telemetry */
-            time_t requestTime = getCurrentTimestamp();
+            }
 
-            mRuntimeManagerImplLock.Lock();
+            if(!ociValid)
+            {
+                LOGERR("OCI Plugin object is not valid. Aborting %s.", operation);
+                return status;
+            }
 
-            if(!isOCIPluginObjectValid())
+            if (containerId.empty())
             {
-                mRuntimeManagerImplLock.Unlock();
-                LOGERR("OCI Plugin object is not valid. Aborting Kill.");
+                LOGERR("appInstanceId is not found");
                 return status;
             }
 
-            auto it = mRuntimeAppInfo.find(appInstanceId);
-            if (it != mRuntimeAppInfo.end())
+            /* The stop and the cleanup run on the reaper; onTerminated reports the end of it */
+            if (submitTeardown(appInstanceId, containerId, force, usesRialto))
             {
-                it->second.requestTime = requestTime;
-                it->second.requestType = REQUEST_TYPE_KILL;
+                Core::SafeSyncType<Core::CriticalSection> lock(mRuntimeManagerImplLock);
+                auto it = mRuntimeAppInfo.find(appInstanceId);
+                if (it != mRuntimeAppInfo.end())
+                {
+                    it->second.containerState = Exchange::IRuntimeManager::RUNTIME_STATE_TERMINATING;
+                }
+                status = Core::ERROR_NONE;
             }
             else
             {
-                LOGERR("Kill called for unknown appInstanceId: %s, skipping telemetry update", appInstanceId.c_str());
+                LOGERR("Unable to queue %s of %s", operation, appInstanceId.c_str());
             }
-            //if (isOCIPluginObjectValid())
-            //{
-                string containerId = getContainerId(appInstanceId);
+            return status;
+        }
 
-                if (!containerId.empty())
+        bool RuntimeManagerImplementation::submitTeardown(const string &appInstanceId, const string &containerId, const bool force, const bool usesRialto)
+        {
+            if (nullptr == mContainerReaper)
+            {
+                LOGERR("Container reaper is not available");
+                return false;
+            }
+
+            /* Every step may run again after a restart, so each one tolerates finding its work done */
+            std::vector<ContainerReaper::Step> steps;
+            ContainerReaper::Step step;
+
+            step.name = "stopContainer";
+            /* No instance lock here: a Kill() must be able to take over while a graceful stop blocks */
+            step.run = [this, containerId, force]() {
+                Exchange::IOCIContainer* ociContainer = nullptr;
                 {
-                    status = mOciContainerObject->StopContainer(containerId, true, success, errorReason);
-                    if ((success == false) || (status != Core::ERROR_NONE))
-                    {
-                        LOGERR("Failed to StopContainer for Kill %s", errorReason.c_str());
-                    }
-                    else
+                    Core::SafeSyncType<Core::CriticalSection> lock(mRuntimeManagerImplLock);
+                    if (isOCIPluginObjectValid())
                     {
-                        mUserIdManager->clearUserId(appInstanceId);
-                        if (mRuntimeAppInfo.find(appInstanceId) != mRuntimeAppInfo.end())
-                        {
-                            mRuntimeAppInfo[appInstanceId].containerState = Exchange::IRuntimeManager::RUNTIME_STATE_TERMINATING;
-                        }
+                        ociContainer = mOciContainerObject;
+                        ociContainer->AddRef();
                     }
                 }
-                else
+                if (nullptr == ociContainer)
                 {
-                    LOGERR("appInstanceId is not found");
+                    LOGERR("OCI Plugin object is not valid, cannot stop %s", containerId.c_str());
+                    return false;
                 }
-#ifdef ENABLE_RIALTO
-            if (mRuntimeAppInfo.count(appInstanceId) && mRuntimeAppInfo[appInstanceId].usesRialto)
-            {
-                LOGINFO("Rialto Session deactivate on kill..");
-                mRialtoConnector->deactivateSession(appInstanceId);
-                if (!mRialtoConnector->waitForStateChange(appInstanceId, RialtoServerStates::NOT_RUNNING, RIALTO_TIMEOUT_MILLIS))
+
+                bool success = false;
+                std::string errorReason = "";
+                Core::hresult status = ociContainer->StopContainer(containerId, force, success, errorReason);
+                ociContainer->Release();
+                if (errorReason.compare("Container not found") == 0)
                 {
-                    LOGERR("Rialto session state change failed when changing to not running ");
-                    status = Core::ERROR_GENERAL;
+                    LOGINFO("Container is not running, no need to StopContainer");
+                    return true;
+                }
+                if ((success == false) || (status != Core::ERROR_NONE))
+                {
+                    LOGERR("StopContainer failed to %s %s", force ? "kill" : "terminate", errorReason.c_str());
+                    return false;
                 }
+                return true;
+            };
+            steps.push_back(step);
+
+            step.name = "clearUserId";
+            step.run = [this, appInstanceId]() {
+                if (nullptr != mUserIdManager)
+                {
+                    mUserIdManager->clearUserId(appInstanceId);
+                }
+                return true;
+            };
+            steps.push_back(step);
+
+#ifdef ENABLE_RIALTO
+            if (usesRialto)
+            {
+                step.name = "deactivateRialtoSession";
+                step.run = [this, appInstanceId]() {
+                    LOGINFO("Rialto session deactivate for %s.", appInstanceId.c_str());
+                    mRialtoConnector->deactivateSession(appInstanceId);
+                    if (!mRialtoConnector->waitForStateChange(appInstanceId, RialtoServerStates::NOT_RUNNING, RIALTO_TIMEOUT_MILLIS))
+                    {
+                        LOGERR("Rialto session state change failed when changing to not running.");
+                        return false;
+                    }
+                    return true;
+                };
+                steps.push_back(step);
             }
 #endif // ENABLE_RIALTO
-            mRuntimeManagerImplLock.Unlock();
-            return status;
+
+#ifdef RALF_PACKAGE_SUPPORT_ENABLED
+            step.name = "unmountRootfs";
+            step.run = [appInstanceId]() {
+                ralf::RalfPackageBuilder ralfBuilder;
+                return ralfBuilder.unmountOverlayfsIfExists(appInstanceId) ||
+                       !ralf::checkIfPathExists(ralf::RALF_APP_ROOTFS_DIR + appInstanceId + "/rootfs");
+            };
+            steps.push_back(step);
+#endif // RALF_PACKAGE_SUPPORT_ENABLED
+
+            JsonObject record;
+            record["containerId"] = containerId;
+            record["force"] = force;
+            record["usesRialto"] = usesRialto;
+            std::string recordString;
+            record.ToString(recordString);
+
+            return mContainerReaper->submit(appInstanceId, recordString, steps,
+                [this, containerId](const std::string& instanceId, const std::string& failedStep) {
+                    if (!failedStep.empty())
+                    {
+                        LOGERR("Teardown of %s failed at %s", instanceId.c_str(), failedStep.c_str());
+                        JsonObject data;
+                        data["containerId"] = containerId;
+                        data["appInstanceId"] = instanceId;
+                        data["errorCode"] = "teardown failed at " + failedStep;
+                        data["eventName"] = "onTeardownFailed";
+                        dispatchEvent(RuntimeManagerImplementation::RuntimeEventType::RUNTIME_MANAGER_EVENT_CONTAINERFAILED, data);
+                    }
+                });
+        }
+
+        void RuntimeManagerImplementation::resumeUnfinishedTeardowns()
+        {
+            if (nullptr == mContainerReaper)
+            {
+                return;
+            }
+            for (const auto& unfinished : mContainerReaper->unfinished())
+            {
+                JsonObject record;
+                record.FromString(unfinished.second);
+                LOGWARN("Resuming teardown of %s left by a previous run", unfinished.first.c_str());
+                /* The Rialto session belonged to the previous process and went away with it */
+                submitTeardown(unfinished.first, record["containerId"].String(), record["force"].Boolean(), false);
+            }
         }
 
         Core::hresult RuntimeManagerImplementation::GetInfo(const string &appInstanceId, string &info)
@@ -1300,16 +1661,31 @@ namespace WPEFramework
             LOGINFO("Entered GetInfo Implementation");
             std::string errorReason = "";
             bool success = false;
+            bool ociValid = false;
+            string containerId = "";
 
-            mRuntimeManagerImplLock.Lock();
+            /* Answer from the latest in-process sample when there is one, without a call into the OCI plugin */
+            if (nullptr != mCgroupStatsSampler)
+            {
+                containerId = getContainerId(appInstanceId);
+                if (!containerId.empty() && mCgroupStatsSampler->getInfo(containerId, info))
+                {
+                    return Core::ERROR_NONE;
+                }
+            }
 
-            if(!isOCIPluginObjectValid())
+            InstanceLockTable::ScopedLock instanceLock(mInstanceLocks, appInstanceId);
+            {
+                Core::SafeSyncType<Core::CriticalSection> lock(mRuntimeManagerImplLock);
+                ociValid = isOCIPluginObjectValid();
+                containerId = getContainerId(appInstanceId);
+            }
+
+            if(!ociValid)
             {
-                mRuntimeManagerImplLock.Unlock();
                 LOGERR("OCI Plugin object is not valid. Aborting GetInfo.");
                 return status;
             }
-                string containerId = getContainerId(appInstanceId);
 
                 if (!containerId.empty())
                 {
@@ -1327,7 +1703,6 @@ namespace WPEFramework
                 {
                     LOGERR("appInstanceId is not found or mOciContainerObject is not ready");
                 }
-            mRuntimeManagerImplLock.Unlock();
             return status;
         }
 
@@ -1336,16 +1711,21 @@ namespace WPEFramework
             Core::hresult status = Core::ERROR_GENERAL;
             std::string errorReason = "";
             bool success = false;
+            bool ociValid = false;
+            string containerId = "";
 
-            mRuntimeManagerImplLock.Lock();
+            InstanceLockTable::ScopedLock instanceLock(mInstanceLocks, appInstanceId);
+            {
+                Core::SafeSyncType<Core::CriticalSection> lock(mRuntimeManagerImplLock);
+                ociValid = isOCIPluginObjectValid();
+                containerId = getContainerId(appInstanceId);
+            }
 
-            if(!isOCIPluginObjectValid())
+            if(!ociValid)
             {
-                mRuntimeManagerImplLock.Unlock();
                 LOGERR("OCI Plugin object is not valid. Aborting Annotate.");
                 return status;
             }
-                string containerId = getContainerId(appInstanceId);
 
                 if (!containerId.empty())
                 {
@@ -1366,7 +1746,6 @@ namespace WPEFramework
                 {
                     LOGERR("appInstanceId is empty ");
                 }
-            mRuntimeManagerImplLock.Unlock();
             return status;
         }
 
@@ -1436,6 +1815,9 @@ namespace WPEFramework
             }
 #endif
 */
+#ifdef RDK_APPMANAGERS_DEBUG
+            ContainerUtils::trackContainer(name);
+#endif
             dispatchEvent(RuntimeManagerImplementation::RuntimeEventType::RUNTIME_MANAGER_EVENT_CONTAINERSTARTED, data);
         }
 
@@ -1454,11 +1836,17 @@ namespace WPEFramework
             }
 #endif
 */
+#ifdef RDK_APPMANAGERS_DEBUG
+            ContainerUtils::untrackContainer(name);
+#endif
             dispatchEvent(RuntimeManagerImplementation::RuntimeEventType::RUNTIME_MANAGER_EVENT_CONTAINERSTOPPED, data);
         }
 
         void RuntimeManagerImplementation::onOCIContainerFailureEvent(std::string name, JsonObject &data)
         {
+#ifdef RDK_APPMANAGERS_DEBUG
+            ContainerUtils::untrackContainer(name);
+#endif
             dispatchEvent(RuntimeManagerImplementation::RuntimeEventType::RUNTIME_MANAGER_EVENT_CONTAINERFAILED, data);
         }
 
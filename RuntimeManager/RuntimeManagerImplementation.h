@@ -27,13 +27,20 @@
 #include <mutex>
 #include <interfaces/IOCIContainer.h>
 #include <interfaces/IAppStorageManager.h>
+#include <interfaces/IAppPackageManager.h>
 #include <condition_variable>
 #include "AIConfiguration.h"
+#include "DobbySpecGenerator.h"
+#include "LaunchProfileCache.h"
 #include "ApplicationConfiguration.h"
 #include "WindowManagerConnector.h"
 #include "IEventHandler.h"
 #include "DobbyEventListener.h"
 #include "UserIdManager.h"
+#include "InstanceLockTable.h"
+#include "ContainerReaper.h"
+#include "GStreamerRegistry.h"
+#include "CgroupStatsSampler.h"
 #include "RuntimeManagerTelemetryReporting.h"
 #include "TelemetryMarkers.h"
 
@@ -46,6 +53,8 @@ class WebInspector;
 #define RIALTO_TIMEOUT_MILLIS 5000
 #endif
 
+#define RUNTIMEMANAGER_TEARDOWN_WAIT_MILLIS 10000
+
 namespace WPEFramework
 {
     namespace Plugin
@@ -75,6 +84,53 @@ namespace WPEFramework
                         Core::JSON::String runtimeConfigFile;
                 };
 
+                class PackageManagerNotification : public Exchange::IPackageInstaller::INotification
+                {
+                    public:
+                        PackageManagerNotification(RuntimeManagerImplementation& parent) : mParent(parent) {}
+                        ~PackageManagerNotification() {}
+
+                        void OnAppInstallationStatus(const string& jsonresponse) override
+                        {
+                            mParent.onAppInstallationStatus(jsonresponse);
+                        }
+
+                        BEGIN_INTERFACE_MAP(PackageManagerNotification)
+                        INTERFACE_ENTRY(Exchange::IPackageInstaller::INotification)
+                        END_INTERFACE_MAP
+
+                    private:
+                        RuntimeManagerImplementation& mParent;
+                };
+
+                class PluginStateNotification : public PluginHost::IPlugin::INotification
+                {
+                    public:
+                        PluginStateNotification(RuntimeManagerImplementation& parent) : mParent(parent) {}
+                        ~PluginStateNotification() {}
+
+                        void Activated(const string& callsign, PluginHost::IShell* plugin) override
+                        {
+                            mParent.onPluginActivated(callsign);
+                        }
+
+                        void Deactivated(const string& callsign, PluginHost::IShell* plugin) override
+                        {
+                            mParent.onPluginDeactivated(callsign);
+                        }
+
+                        void Unavailable(const string& callsign, PluginHost::IShell* plugin) override
+                        {
+                        }
+
+                        BEGIN_INTERFACE_MAP(PluginStateNotification)
+                        INTERFACE_ENTRY(PluginHost::IPlugin::INotification)
+                        END_INTERFACE_MAP
+
+                    private:
+                        RuntimeManagerImplementation& mParent;
+                };
+
             public:
                 enum RuntimeEventType
                 {
@@ -189,7 +245,8 @@ namespace WPEFramework
                 // IConfiguration methods
                 uint32_t Configure(PluginHost::IShell* service) override;
 
-                bool generate(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, std::string& dobbySpec);
+                bool generate(const ApplicationConfiguration& config, const WPEFramework::Exchange::RuntimeConfig& runtimeConfig, std::string& dobbySpec,
+                              const LaunchProfile* launchProfile = nullptr);
 
                 // IEventHandler methods
                 virtual void onOCIContainerStartedEvent(std::string name, JsonObject& data) override;
@@ -202,14 +259,22 @@ namespace WPEFramework
                 void releaseOCIContainerPluginObject();
                 Core::hresult createStorageManagerPluginObject();
                 void releaseStorageManagerPluginObject();
+                Core::hresult createPackageInstallerObject();
+                void releasePackageInstallerObject();
 
                 std::string getContainerId(const string& appInstanceId);
                 bool isOCIPluginObjectValid(void);
                 Exchange::IRuntimeManager::RuntimeState getRuntimeState(const string& appInstanceId);
                 Core::hresult getAppStorageInfo(const string& appId, AppStorageInfo& appStorageInfo);
+                Core::hresult stopContainer(const string& appInstanceId, const bool force);
+                bool submitTeardown(const string& appInstanceId, const string& containerId, const bool force, const bool usesRialto);
+                void resumeUnfinishedTeardowns();
 
             private: /* members */
+                /* Guards mRuntimeAppInfo, the notification list and the plugin objects; never held
+                   across OCI or Rialto calls. Container operations serialize on mInstanceLocks. */
                 mutable Core::CriticalSection mRuntimeManagerImplLock;
+                InstanceLockTable mInstanceLocks;
                 PluginHost::IShell* mCurrentservice;
                 Exchange::IOCIContainer* mOciContainerObject;
                 std::list<Exchange::IRuntimeManager::INotification*> mRuntimeManagerNotification;
@@ -221,6 +286,7 @@ namespace WPEFramework
                 #endif
                 Exchange::IAppStorageManager *mStorageManagerObject;
                 WindowManagerConnector* mWindowManagerConnector;
+                ContainerReaper* mContainerReaper;  ///< runs Terminate/Kill teardowns in the background
                 DobbyEventListener *mDobbyEventListener;
                 UserIdManager* mUserIdManager;
                 std::string mRuntimeAppPortal;
@@ -229,12 +295,22 @@ namespace WPEFramework
 #endif
                 std::string mRuntimeConfigFile;
                 AIConfiguration* mAIConfiguration;
-                std::string mGstRegistrySourcePath;  ///< path to pre-built GST registry (empty if disabled/failed)
+                DobbySpecTemplateCache mSpecTemplateCache;  ///< spec templates shared by the per-launch generators
+                LaunchProfileCache mLaunchProfileCache;  ///< per-app parsed capabilities and limits, dropped on (un)install
+                Core::CriticalSection mPackageInstallerLock;  ///< guards mPackageInstallerObject, which is set from plugin notifications
+                Exchange::IPackageInstaller* mPackageInstallerObject;  ///< install notifications (null if unavailable)
+                Core::Sink<PackageManagerNotification> mPackageManagerNotification;
+                Core::Sink<PluginStateNotification> mPluginStateNotification;  ///< picks up AppPackageManager when it comes up
+                GStreamerRegistry* mGstRegistry;  ///< GST registry checked in the background (null if disabled)
+                CgroupStatsSampler* mCgroupStatsSampler;  ///< in-process container stats for GetInfo (null if disabled)
 
             private: /* internal methods */
                 void dispatchEvent(RuntimeEventType, const JsonValue &params);
                 void Dispatch(RuntimeEventType event, const JsonValue params);
                 void notifyParameterCheckFailure(const string& appInstanceId, const string& errorCode);
+                void onAppInstallationStatus(const string& jsonresponse);
+                void onPluginActivated(const string& callsign);
+                void onPluginDeactivated(const string& callsign);
 
                 void recordTelemetryData(const std::string& marker, const std::string& appId, uint64_t requestTime, const std::string& fieldName = "");
                 time_t getCurrentTimestamp();
@@ -244,6 +320,7 @@ namespace WPEFramework
 
                 friend class WindowManagerConnector;
                 friend class Job;
+                friend struct RuntimeManagerImplementationInspector;  ///< L0 tests only
 
             public/*members*/:
                 static RuntimeManagerImplementation* _instance;
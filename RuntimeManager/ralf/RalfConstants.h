@@ -18,6 +18,7 @@
  **/
 
 #pragma once
+#include <cstdint>
 #include <string>
 #include <utility>
 
@@ -29,6 +30,8 @@ namespace ralf
     const std::string RALF_GRAPHICS_LAYER_CONFIG = RALF_GRAPHICS_LAYER_PATH + "config.json";
     const std::string RALF_OVERLAYFS_TYPE = "overlay";
     const std::string RALF_APP_ROOTFS_DIR = "/tmp/ralf/";
+    const std::string RALF_LAYER_STACK_DIR = RALF_APP_ROOTFS_DIR + ".layers/";
+    const uint32_t RALF_LAYER_STACK_GRACE_MS = 30000;
     const std::string RALF_USER_NAME = "ralf";
 
     typedef std::pair<std::string, std::string> RalfPkgInfoPair; // <packageMetadataJsonPath, mountPoint>
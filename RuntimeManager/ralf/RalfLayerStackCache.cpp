@@ -0,0 +1,304 @@
+
+/**
+ * If not stated otherwise in this file or this component's LICENSE
+ * file the following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+#include "../Module.h" // To make logging work
+#include "UtilsLogging.h"
+#include "RalfConstants.h"
+#include "RalfLayerStackCache.h"
+#include "RalfSupport.h"
+
+#include <cerrno>
+#include <cstring> //for strerror
+#include <system_error>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/mount.h>
+#include <unistd.h>
+
+namespace ralf
+{
+    namespace
+    {
+        bool mountLayerStack(const std::string &lowerDirs, const std::string &target)
+        {
+            create_directories(target);
+            // Without an upperdir the overlay is read-only, so it can be shared between instances
+            std::string options = "lowerdir=" + lowerDirs;
+            if (mount(RALF_OVERLAYFS_TYPE.c_str(), target.c_str(), RALF_OVERLAYFS_TYPE.c_str(), MS_RDONLY, options.c_str()) != 0)
+            {
+                LOGERR("Error mounting layer stack at %s: %s\n", target.c_str(), strerror(errno));
+                rmdir(target.c_str());
+                return false;
+            }
+            return true;
+        }
+
+        bool unmountLayerStack(const std::string &target)
+        {
+            // Lazy detach: the stack goes away once the last instance overlay on top of it is gone
+            if (umount2(target.c_str(), MNT_DETACH) != 0 && errno != EINVAL)
+            {
+                LOGERR("Error detaching layer stack at %s: %s\n", target.c_str(), strerror(errno));
+                return false;
+            }
+            rmdir(target.c_str());
+            return true;
+        }
+    }
+
+    RalfLayerStackCache &RalfLayerStackCache::getInstance()
+    {
+        static RalfLayerStackCache instance(RALF_LAYER_STACK_DIR, RALF_LAYER_STACK_GRACE_MS, mountLayerStack, unmountLayerStack);
+        static std::once_flag swept;
+        std::call_once(swept, []() { instance.sweepStale(); });
+        return instance;
+    }
+
+    RalfLayerStackCache::RalfLayerStackCache(const std::string &stackDir, uint32_t graceMs, const MountFunction &mountFn, const UnmountFunction &unmountFn)
+        : mStackDir(stackDir), mGrace(graceMs), mMount(mountFn), mUnmount(unmountFn), mLock(), mWakeup(), mMounted(), mStacks(), mInstanceStacks(), mNextStackId(0), mStats(), mStopping(false), mReaper()
+    {
+    }
+
+    RalfLayerStackCache::~RalfLayerStackCache()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            mStopping = true;
+        }
+        mWakeup.notify_all();
+        if (mReaper.joinable())
+        {
+            mReaper.join();
+        }
+        expireIdle(true);
+    }
+
+    bool RalfLayerStackCache::acquire(const std::string &appInstanceId, const std::string &lowerDirs, std::string &stackPath)
+    {
+        if (lowerDirs.find(':') == std::string::npos)
+        {
+            // A single layer is used as lowerdir directly; a stack would not save anything
+            return false;
+        }
+
+        std::unique_lock<std::mutex> lock(mLock);
+        if (mInstanceStacks.find(appInstanceId) != mInstanceStacks.end())
+        {
+            LOGWARN("Instance %s already holds a layer stack, not stacking again\n", appInstanceId.c_str());
+            return false;
+        }
+
+        auto it = mStacks.find(lowerDirs);
+        // Another launch is mounting the same layers; wait for it instead of mounting twice
+        while (it != mStacks.end() && it->second.mounting)
+        {
+            mMounted.wait(lock);
+            it = mStacks.find(lowerDirs);
+        }
+
+        if (it != mStacks.end())
+        {
+            if (it->second.refs == 0)
+            {
+                --mStats.idle;
+                ++mStats.pinned;
+            }
+            ++mStats.reuses;
+        }
+        else
+        {
+            // The entry marks the mount as pending, so the lock is not held across the mount itself
+            Stack stack;
+            stack.path = mStackDir + std::to_string(getpid()) + "-" + std::to_string(mNextStackId++);
+            stack.refs = 0;
+            stack.mounting = true;
+            it = mStacks.insert(std::make_pair(lowerDirs, stack)).first;
+            const std::string path = stack.path;
+
+            lock.unlock();
+            const bool mounted = mMount(lowerDirs, path);
+            lock.lock();
+
+            it = mStacks.find(lowerDirs);
+            if (!mounted)
+            {
+                mStacks.erase(it);
+                mMounted.notify_all();
+                return false;
+            }
+            it->second.mounting = false;
+            ++mStats.mounts;
+            ++mStats.pinned;
+            mMounted.notify_all();
+        }
+
+        ++it->second.refs;
+        mInstanceStacks[appInstanceId] = lowerDirs;
+        stackPath = it->second.path;
+        LOGDBG("Layer stack %s pinned by %s (%u refs)\n", stackPath.c_str(), appInstanceId.c_str(), it->second.refs);
+        return true;
+    }
+
+    void RalfLayerStackCache::release(const std::string &appInstanceId)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        auto instance = mInstanceStacks.find(appInstanceId);
+        if (instance == mInstanceStacks.end())
+        {
+            return;
+        }
+
+        auto it = mStacks.find(instance->second);
+        mInstanceStacks.erase(instance);
+        if (it == mStacks.end() || it->second.refs == 0 || --it->second.refs > 0)
+        {
+            return;
+        }
+
+        it->second.idleSince = std::chrono::steady_clock::now();
+        --mStats.pinned;
+        ++mStats.idle;
+        LOGINFO("Layer stack %s unused, detaching in %lld ms (%u pinned, %u idle)\n", it->second.path.c_str(),
+                static_cast<long long>(mGrace.count()), mStats.pinned, mStats.idle);
+
+        if (!mReaper.joinable() && !mStopping)
+        {
+            try
+            {
+                mReaper = std::thread(&RalfLayerStackCache::reaperLoop, this);
+            }
+            catch (const std::system_error &ex)
+            {
+                LOGWARN("Unable to start layer stack reaper, unused stacks stay mounted: %s\n", ex.what());
+            }
+        }
+        mWakeup.notify_all();
+    }
+
+    void RalfLayerStackCache::expireIdle(bool force)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        const auto now = std::chrono::steady_clock::now();
+        for (auto it = mStacks.begin(); it != mStacks.end();)
+        {
+            if (it->second.refs == 0 && !it->second.mounting && (force || now - it->second.idleSince >= mGrace))
+            {
+                mUnmount(it->second.path);
+                ++mStats.unmounts;
+                --mStats.idle;
+                it = mStacks.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+    }
+
+    uint32_t RalfLayerStackCache::sweepStale()
+    {
+        DIR *dir = opendir(mStackDir.c_str());
+        if (nullptr == dir)
+        {
+            return 0;
+        }
+
+        std::vector<std::string> stale;
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            struct dirent *entry;
+            while ((entry = readdir(dir)) != nullptr)
+            {
+                const std::string name = entry->d_name;
+                if (name == "." || name == "..")
+                {
+                    continue;
+                }
+                const std::string path = mStackDir + name;
+                bool owned = false;
+                for (const auto &stack : mStacks)
+                {
+                    if (stack.second.path == path)
+                    {
+                        owned = true;
+                        break;
+                    }
+                }
+                if (!owned)
+                {
+                    stale.push_back(path);
+                }
+            }
+        }
+        closedir(dir);
+
+        uint32_t detached = 0;
+        for (const auto &path : stale)
+        {
+            LOGINFO("Detaching layer stack %s left by an earlier run\n", path.c_str());
+            if (mUnmount(path))
+            {
+                ++detached;
+            }
+        }
+        return detached;
+    }
+
+    RalfLayerStackCache::Stats RalfLayerStackCache::stats() const
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        return mStats;
+    }
+
+    void RalfLayerStackCache::reaperLoop()
+    {
+        std::unique_lock<std::mutex> lock(mLock);
+        while (!mStopping)
+        {
+            // Sleep until the oldest unused stack is due, or until a stack becomes unused
+            bool haveIdle = false;
+            std::chrono::steady_clock::time_point due;
+            for (const auto &entry : mStacks)
+            {
+                if (entry.second.refs == 0 && !entry.second.mounting && (!haveIdle || entry.second.idleSince + mGrace < due))
+                {
+                    due = entry.second.idleSince + mGrace;
+                    haveIdle = true;
+                }
+            }
+
+            if (!haveIdle)
+            {
+                mWakeup.wait(lock);
+            }
+            else if (std::chrono::steady_clock::now() < due)
+            {
+                mWakeup.wait_until(lock, due);
+            }
+            else
+            {
+                lock.unlock();
+                expireIdle();
+                lock.lock();
+            }
+        }
+    }
+} // namespace ralf
@@ -0,0 +1,131 @@
+
+/**
+ * If not stated otherwise in this file or this component's LICENSE
+ * file the following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+#pragma once
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace ralf
+{
+    /**
+     * Read-only overlay mounts of package layer sets, shared by every instance launched on the same layers.
+     * An instance rootfs mounts its own overlay with a fresh upperdir on top of the shared stack, so a
+     * relaunch only pays for a single-lower mount. A stack nobody uses is kept for a grace period and then
+     * lazily detached; a launch inside the grace period pins it again.
+     */
+    class RalfLayerStackCache
+    {
+    public:
+        /**
+         * Mount and unmount accounting.
+         */
+        struct Stats
+        {
+            uint32_t pinned;   ///< stacks used by at least one instance
+            uint32_t idle;     ///< stacks waiting for their grace period to expire
+            uint64_t mounts;   ///< stacks mounted since start
+            uint64_t reuses;   ///< launches that found their stack already mounted
+            uint64_t unmounts; ///< stacks detached since start
+        };
+
+        typedef std::function<bool(const std::string &lowerDirs, const std::string &target)> MountFunction;
+        typedef std::function<bool(const std::string &target)> UnmountFunction;
+
+        /**
+         * Returns the process wide cache, which mounts below RALF_LAYER_STACK_DIR.
+         */
+        static RalfLayerStackCache &getInstance();
+
+        /**
+         * @param stackDir Directory the stack mount points are created in.
+         * @param graceMs Time an unused stack stays mounted.
+         * @param mountFn Mounts the colon separated lowerDirs read-only at target.
+         * @param unmountFn Lazily detaches the stack at target.
+         */
+        RalfLayerStackCache(const std::string &stackDir, uint32_t graceMs, const MountFunction &mountFn, const UnmountFunction &unmountFn);
+        virtual ~RalfLayerStackCache();
+
+        RalfLayerStackCache(const RalfLayerStackCache &) = delete;
+        RalfLayerStackCache &operator=(const RalfLayerStackCache &) = delete;
+
+        /**
+         * Pins the stack of the given layers for an application instance, mounting it if needed.
+         * Layer sets with a single layer are not stacked.
+         * @param appInstanceId The application instance ID taking the reference.
+         * @param lowerDirs The colon separated list of package mount paths.
+         * @param stackPath [out parameter] Mount point of the stack, to be used as the only lowerdir.
+         * @return true if a stack is pinned, false if the caller has to mount lowerDirs itself.
+         */
+        bool acquire(const std::string &appInstanceId, const std::string &lowerDirs, std::string &stackPath);
+
+        /**
+         * Drops the reference of an application instance. Does nothing if it holds none.
+         * @param appInstanceId The application instance ID.
+         */
+        void release(const std::string &appInstanceId);
+
+        /**
+         * Detaches every stack left below the stack directory by an earlier run of the plugin.
+         * Those stacks belong to no instance of this process and would otherwise stay mounted.
+         * @return The number of stacks detached.
+         */
+        uint32_t sweepStale();
+
+        /**
+         * Detaches every unused stack whose grace period is over.
+         * @param force Detach unused stacks regardless of the grace period.
+         */
+        void expireIdle(bool force = false);
+
+        Stats stats() const;
+
+    private:
+        struct Stack
+        {
+            std::string path;
+            uint32_t refs;
+            bool mounting; ///< set while the mount runs without the lock; other launches wait for it
+            std::chrono::steady_clock::time_point idleSince;
+        };
+
+        void reaperLoop();
+
+        const std::string mStackDir;
+        const std::chrono::milliseconds mGrace;
+        MountFunction mMount;
+        UnmountFunction mUnmount;
+
+        mutable std::mutex mLock;
+        std::condition_variable mWakeup;
+        std::condition_variable mMounted;
+        std::map<std::string, Stack> mStacks;               ///< lowerDirs -> stack
+        std::map<std::string, std::string> mInstanceStacks; ///< appInstanceId -> lowerDirs
+        uint64_t mNextStackId;
+        Stats mStats;
+        bool mStopping;
+        std::thread mReaper;
+    };
+} // namespace ralf
@@ -23,23 +23,71 @@
 #include "RalfSupport.h"
 #include "OCISpecConstants.h"
 #include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
 
 #define PERSIST_STORAGE_PATH "/data"
+#define RALF_GENERATED_CONFIG_CACHE_MAX_ENTRIES 32
 
 namespace ralf
 {
-    bool RalfOCIConfigGenerator::generateRalfOCIConfig(const WPEFramework::Plugin::ApplicationConfiguration &config, const WPEFramework::Exchange::RuntimeConfig &runtimeConfigObject)
+    namespace
     {
-        Json::Value ociConfigRootNode;
+        // Base spec merged with the graphics and package configs, keyed by the fingerprint of those
+        // inputs. Nothing instance specific goes in, so every launch of the same package set hits it.
+        std::mutex gGeneratedConfigLock;
+        std::map<std::string, Json::Value> gGeneratedConfigs;
+
+        void appendStamp(std::ostringstream &out, const std::string &path, const FileStamp &stamp)
+        {
+            out << path << '@' << stamp.device << ':' << stamp.inode << ':' << stamp.size << ':'
+                << stamp.mtimeSec << '.' << stamp.mtimeNsec << '\n';
+        }
+    } // namespace
+
+    void RalfOCIConfigGenerator::clearGeneratedConfigCache()
+    {
+        std::lock_guard<std::mutex> lock(gGeneratedConfigLock);
+        gGeneratedConfigs.clear();
+    }
+
+    bool RalfOCIConfigGenerator::buildConfigFingerprint(std::string &fingerprint)
+    {
+        std::ostringstream out;
+        FileStamp stamp;
+        if (!getFileStamp(RALF_OCI_BASE_SPEC_FILE, stamp))
+        {
+            return false;
+        }
+        appendStamp(out, RALF_OCI_BASE_SPEC_FILE, stamp);
+        if (!getFileStamp(RALF_GRAPHICS_LAYER_CONFIG, stamp))
+        {
+            return false;
+        }
+        appendStamp(out, RALF_GRAPHICS_LAYER_CONFIG, stamp);
+        for (const auto &ralfPkgInfo : mRalfPackages)
+        {
+            if (!getFileStamp(ralfPkgInfo.first, stamp))
+            {
+                return false;
+            }
+            appendStamp(out, ralfPkgInfo.first, stamp);
+        }
+        fingerprint = out.str();
+        return true;
+    }
 
-        if (!JsonFromFile(RALF_OCI_BASE_SPEC_FILE, ociConfigRootNode))
+    bool RalfOCIConfigGenerator::buildPackageConfig(Json::Value &ociConfigRootNode)
+    {
+        if (!JsonFromFileCached(RALF_OCI_BASE_SPEC_FILE, ociConfigRootNode))
         {
             LOGERR("Failed to load base OCI config template");
             return false;
         }
         // Load graphics config and integrate into OCI config
         Json::Value graphicsConfigNode;
-        if (!JsonFromFile(RALF_GRAPHICS_LAYER_CONFIG, graphicsConfigNode))
+        if (!JsonFromFileCached(RALF_GRAPHICS_LAYER_CONFIG, graphicsConfigNode))
         {
             LOGERR("Failed to load Ralf graphics config JSON from file: %s", RALF_GRAPHICS_LAYER_CONFIG.c_str());
             return false;
@@ -55,7 +103,7 @@ namespace ralf
         for (const auto &ralfPkgInfo : mRalfPackages)
         {
             Json::Value ralfPackageConfigNode;
-            if (!JsonFromFile(ralfPkgInfo.first, ralfPackageConfigNode))
+            if (!JsonFromFileCached(ralfPkgInfo.first, ralfPackageConfigNode))
             {
                 LOGERR("Failed to load Ralf package config JSON from file: %s", ralfPkgInfo.first.c_str());
                 return false;
@@ -68,6 +116,47 @@ namespace ralf
             // Apply permissions if exists
             // TODO tracked under RDKEMW-13995
         }
+        return true;
+    }
+
+    bool RalfOCIConfigGenerator::generateRalfOCIConfig(const WPEFramework::Plugin::ApplicationConfiguration &config, const WPEFramework::Exchange::RuntimeConfig &runtimeConfigObject)
+    {
+        // The package part of the config only depends on the package set, so relaunches skip merging it again
+        Json::Value ociConfigRootNode;
+        std::string fingerprint;
+        bool cached = false;
+        if (buildConfigFingerprint(fingerprint))
+        {
+            std::lock_guard<std::mutex> lock(gGeneratedConfigLock);
+            auto it = gGeneratedConfigs.find(fingerprint);
+            if (it != gGeneratedConfigs.end())
+            {
+                ociConfigRootNode = it->second;
+                cached = true;
+            }
+        }
+        if (!cached)
+        {
+            if (!buildPackageConfig(ociConfigRootNode))
+            {
+                return false;
+            }
+            if (!fingerprint.empty())
+            {
+                std::lock_guard<std::mutex> lock(gGeneratedConfigLock);
+                if (gGeneratedConfigs.size() >= RALF_GENERATED_CONFIG_CACHE_MAX_ENTRIES && gGeneratedConfigs.find(fingerprint) == gGeneratedConfigs.end())
+                {
+                    gGeneratedConfigs.erase(gGeneratedConfigs.begin());
+                }
+                gGeneratedConfigs[fingerprint] = ociConfigRootNode;
+            }
+        }
+        else
+        {
+            LOGDBG("Reusing merged package config for %s\n", mConfigFilePath.c_str());
+        }
+
+        // Everything from here on is specific to this instance and is applied to every launch
         if (generateHooksForOCIConfig(ociConfigRootNode) == false)
         {
             LOGERR("Failed to generate hooks for OCI config");
@@ -86,7 +175,9 @@ namespace ralf
         //Log name update.
         addLogNameToOCIConfig(ociConfigRootNode, config.mAppStorageInfo.path, config.mAppId);
         // Finally save the modified OCI config to file
-        return saveOCIConfigToFile(ociConfigRootNode, config.mUserId, config.mGroupId);
+        Json::StreamWriterBuilder writer;
+        const std::string ociConfigJson = Json::writeString(writer, ociConfigRootNode);
+        return saveOCIConfigToFile(ociConfigJson, config.mUserId, config.mGroupId);
     }
 
     void RalfOCIConfigGenerator::addLogNameToOCIConfig(Json::Value &ociConfigRootNode, const std::string &appStoragePath, const std::string &appId)
@@ -228,13 +319,9 @@ namespace ralf
 
         ociConfigRootNode[MOUNT].append(mountEntry);
     }
-    bool RalfOCIConfigGenerator::saveOCIConfigToFile(const Json::Value &ociConfigRootNode, int uid, int gid)
+    bool RalfOCIConfigGenerator::saveOCIConfigToFile(const std::string &ociConfigJson, int uid, int gid)
     {
         bool status = false;
-        std::string ociConfigJson;
-        Json::StreamWriterBuilder writer;
-        ociConfigJson = Json::writeString(writer, ociConfigRootNode);
-
         LOGDBG("Generated OCI config JSON: Writing to file  %s\n", mConfigFilePath.c_str());
         // Write to file
         std::ofstream outFile(mConfigFilePath.c_str());
@@ -38,7 +38,27 @@ namespace ralf
          */
         bool generateRalfOCIConfig(const WPEFramework::Plugin::ApplicationConfiguration &config, const WPEFramework::Exchange::RuntimeConfig &runtimeConfigObject);
 
+        /**
+         * Drops every merged package config remembered for reuse.
+         */
+        static void clearGeneratedConfigCache();
+
     private:
+        /**
+         * Builds a fingerprint of the inputs merged by buildPackageConfig: the stamps of the base spec,
+         * graphics config and package config files. Nothing instance specific is part of it.
+         * @param fingerprint [out parameter] The fingerprint.
+         * @return true if the fingerprint was built, false if an input file could not be stat'ed.
+         */
+        bool buildConfigFingerprint(std::string &fingerprint);
+
+        /**
+         * Loads the base OCI spec and applies the graphics config and every package config to it.
+         * @param ociConfigRootNode [out parameter] The merged OCI config.
+         * @return true if the config was built, false otherwise.
+         */
+        bool buildPackageConfig(Json::Value &ociConfigRootNode);
+
         /**
          * Applies the graphics configuration to the OCI config JSON.
          * @param ociConfigRootNode The root node of the OCI config JSON.
@@ -71,13 +91,13 @@ namespace ralf
         bool addEntryPointToOCIConfig(Json::Value &ociConfigRootNode, const Json::Value &ralfPackageConfigNode);
 
         /**
-         * Saves the OCI config JSON to mConfigFilePath.
-         * @param ociConfigRootNode The root node of the OCI config JSON.
+         * Saves the serialized OCI config JSON to mConfigFilePath.
+         * @param ociConfigJson The serialized OCI config JSON.
          * @param uid The user ID to set as the owner of the file.
          * @param gid The group ID to set as the owner of the file.
          * @return true if the OCI config was saved successfully, false otherwise.
          */
-        bool saveOCIConfigToFile(const Json::Value &ociConfigRootNode, int uid, int gid);
+        bool saveOCIConfigToFile(const std::string &ociConfigJson, int uid, int gid);
 
         /**
          * Applies runtime and application configuration to the OCI config JSON.
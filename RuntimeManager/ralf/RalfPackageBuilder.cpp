@@ -21,6 +21,7 @@
 #include "RalfPackageBuilder.h"
 #include "RalfOCIConfigGenerator.h"
 #include "RalfSupport.h"
+#include "RalfLayerStackCache.h"
 
 #include <fstream>
 
@@ -111,6 +112,8 @@ namespace ralf
             LOGDBG("No overlayfs mount exists at path: %s", overlayMountPath.c_str());
             status = false;
         }
+        // The shared layer stack is detached lazily, so it can be released even if the unmount above failed
+        RalfLayerStackCache::getInstance().release(appInstanceId);
         return status;
     }
 } // namespace ralf
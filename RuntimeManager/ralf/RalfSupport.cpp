@@ -22,6 +22,7 @@
 #include "UtilsLogging.h"
 #include "RalfConstants.h"
 #include "RalfSupport.h"
+#include "RalfLayerStackCache.h"
 
 #include <iostream>
 
@@ -42,6 +43,11 @@
 
 #include <pwd.h> //For getting user id and group id of ralf user
 
+#include <map>
+#include <mutex>
+
+#define RALF_JSON_FILE_CACHE_MAX_ENTRIES 64
+
 namespace ralf
 {
 
@@ -152,6 +158,81 @@ namespace ralf
         return status;
     }
 
+    namespace
+    {
+        struct CachedJsonFile
+        {
+            FileStamp stamp;
+            Json::Value root;
+        };
+        std::mutex gJsonFileCacheLock;
+        std::map<std::string, CachedJsonFile> gJsonFileCache;
+    } // namespace
+
+    bool getFileStamp(const std::string &path, FileStamp &stamp)
+    {
+        struct stat st;
+        if (stat(path.c_str(), &st) != 0)
+        {
+            return false;
+        }
+        stamp.device = st.st_dev;
+        stamp.inode = st.st_ino;
+        stamp.size = st.st_size;
+        stamp.mtimeSec = st.st_mtim.tv_sec;
+        stamp.mtimeNsec = st.st_mtim.tv_nsec;
+        return true;
+    }
+
+    bool JsonFromFileCached(const std::string &filePath, Json::Value &rootNode)
+    {
+        FileStamp stamp;
+        if (!getFileStamp(filePath, stamp))
+        {
+            std::lock_guard<std::mutex> lock(gJsonFileCacheLock);
+            gJsonFileCache.erase(filePath);
+            LOGERR("Failed to open JSON file: %s\n", filePath.c_str());
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> lock(gJsonFileCacheLock);
+            auto it = gJsonFileCache.find(filePath);
+            if (it != gJsonFileCache.end() && it->second.stamp == stamp)
+            {
+                LOGDBG("JsonFromFileCached [%s] served from cache\n", filePath.c_str());
+                rootNode = it->second.root;
+                return true;
+            }
+        }
+        // Parse outside the lock so that concurrent launches reading other files are not serialised
+        Json::Value parsed;
+        if (!JsonFromFile(filePath, parsed))
+        {
+            return false;
+        }
+        // Only keep the result if the file did not change while it was being read
+        FileStamp after;
+        if (getFileStamp(filePath, after) && after == stamp)
+        {
+            std::lock_guard<std::mutex> lock(gJsonFileCacheLock);
+            if (gJsonFileCache.size() >= RALF_JSON_FILE_CACHE_MAX_ENTRIES && gJsonFileCache.find(filePath) == gJsonFileCache.end())
+            {
+                gJsonFileCache.erase(gJsonFileCache.begin());
+            }
+            CachedJsonFile &entry = gJsonFileCache[filePath];
+            entry.stamp = stamp;
+            entry.root = parsed;
+        }
+        rootNode.swap(parsed);
+        return true;
+    }
+
+    void clearJsonFileCache()
+    {
+        std::lock_guard<std::mutex> lock(gJsonFileCacheLock);
+        gJsonFileCache.clear();
+    }
+
     bool generateOCIRootfs(const std::string appInstanceId, const std::string &pkgmountPaths, const int uid, const int gid, std::string &ociRootfsPath)
     {
         // Let us create a directory for app as RALF_APP_ROOTFS_DIR/appInstanceId
@@ -163,14 +244,32 @@ namespace ralf
         create_directories(workSubDir, uid, gid);
         create_directories(upperSubDir, uid, gid);
 
+        // The package layers come from a shared read-only stack when possible; upperdir and workdir stay per instance
+        RalfLayerStackCache &stackCache = RalfLayerStackCache::getInstance();
+        std::string stackPath;
+        const bool stacked = stackCache.acquire(appInstanceId, pkgmountPaths, stackPath);
+        std::string lowerDirs = stacked ? stackPath : pkgmountPaths;
+
         // Now we can mount the overlay filesystem
-        std::string options = "lowerdir=" + pkgmountPaths + ",upperdir=" + upperSubDir + ",workdir=" + workSubDir;
+        std::string options = "lowerdir=" + lowerDirs + ",upperdir=" + upperSubDir + ",workdir=" + workSubDir;
         LOGDBG("Mounting overlayfs with options: %s\n", options.c_str());
 
         if (mount(RALF_OVERLAYFS_TYPE.c_str(), appRootfsDir.c_str(), RALF_OVERLAYFS_TYPE.c_str(), 0, options.c_str()) != 0)
         {
-            LOGERR("Error mounting overlayfs: %s\n", strerror(errno));
-            return false;
+            if (!stacked)
+            {
+                LOGERR("Error mounting overlayfs: %s\n", strerror(errno));
+                return false;
+            }
+            // e.g. the packages are overlays themselves and stacking exceeds the kernel depth limit
+            LOGWARN("Error mounting overlayfs on layer stack: %s, mounting package layers directly\n", strerror(errno));
+            stackCache.release(appInstanceId);
+            options = "lowerdir=" + pkgmountPaths + ",upperdir=" + upperSubDir + ",workdir=" + workSubDir;
+            if (mount(RALF_OVERLAYFS_TYPE.c_str(), appRootfsDir.c_str(), RALF_OVERLAYFS_TYPE.c_str(), 0, options.c_str()) != 0)
+            {
+                LOGERR("Error mounting overlayfs: %s\n", strerror(errno));
+                return false;
+            }
         }
         ociRootfsPath = baseDir;
         return true;
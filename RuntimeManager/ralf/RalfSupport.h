@@ -21,6 +21,7 @@
 
 #include <string>
 #include <vector>
+#include <sys/types.h>
 #include <json/json.h>
 
 #include "RalfConstants.h"
@@ -52,12 +53,57 @@ namespace ralf
      * @return true on success, false on failure
      */
     bool JsonFromFile(const std::string &filePath, Json::Value &rootNode);
+
+    /**
+     * Identity of a file as reported by stat(): device, inode, size and modification time.
+     * Two equal stamps mean the file was neither replaced nor rewritten in between.
+     */
+    struct FileStamp
+    {
+        dev_t device;
+        ino_t inode;
+        off_t size;
+        time_t mtimeSec;
+        long mtimeNsec;
+
+        bool operator==(const FileStamp &other) const
+        {
+            return device == other.device && inode == other.inode && size == other.size &&
+                   mtimeSec == other.mtimeSec && mtimeNsec == other.mtimeNsec;
+        }
+        bool operator!=(const FileStamp &other) const { return !(*this == other); }
+    };
+
+    /**
+     * Function to read the stamp of a file
+     * @param path The path to the file
+     * @param stamp [out parameter] The stamp of the file
+     * @return true on success, false if the file cannot be stat'ed
+     */
+    bool getFileStamp(const std::string &path, FileStamp &stamp);
+
+    /**
+     * Same as JsonFromFile, but keeps the parsed document in a process wide cache.
+     * A cached document is returned as long as the file stamp is unchanged; a file that was
+     * replaced, rewritten or removed is read and parsed again. Failed reads are not cached.
+     * @param filePath The path to the JSON file
+     * @param rootNode [out parameter] The parsed JSON data
+     * @return true on success, false on failure
+     */
+    bool JsonFromFileCached(const std::string &filePath, Json::Value &rootNode);
+
+    /**
+     * Drops every document held by JsonFromFileCached.
+     */
+    void clearJsonFileCache();
     /**
      *
      * Function to mount overlay filesystem. This function will create the directories if they do not exist.
      * The directory structure is as follows
      * RALF_APP_ROOTFS_DIR/appInstanceId/rootfs  (this is the mount point)
      * The overlay filesystem will use the pkgmountPaths as lowerdir and RALF_APP_ROOTFS_DIR/appInstanceId as workdir
+     * When there are several package layers they are taken from a shared RalfLayerStackCache stack, pinned for
+     * appInstanceId until RalfPackageBuilder::unmountOverlayfsIfExists releases it
      * @param appInstanceId The application instance ID
      * @param pkgmountPaths The colon separated list of package mount paths to be used as lowerdir
      * @param uid The user ID to set as owner of the created directories
@@ -47,6 +47,10 @@ using string = std::string;
 
 class FakeRuntimeManager final : public WPEFramework::Exchange::IRuntimeManager {
 public:
+    // Called with the method name and appInstanceId before Hibernate/Wake return,
+    // so a test can record the call order or park a transition worker.
+    using CallHook = std::function<void(const string& method, const string& appInstanceId)>;
+
     FakeRuntimeManager()
         : _refCount(1)
         , registerCalls(0)
@@ -86,8 +90,20 @@ public:
         IValueIterator* const& /*ports*/, IStringIterator* const& /*paths*/,
         IStringIterator* const& /*debugSettings*/,
         const WPEFramework::Exchange::RuntimeConfig& /*runtimeConfigObject*/) override { return WPEFramework::Core::ERROR_NONE; }
-    WPEFramework::Core::hresult Hibernate(const string& /*appInstanceId*/) override { return WPEFramework::Core::ERROR_NONE; }
-    WPEFramework::Core::hresult Wake(const string& /*appInstanceId*/, RuntimeState /*runtimeState*/) override { return WPEFramework::Core::ERROR_NONE; }
+    WPEFramework::Core::hresult Hibernate(const string& appInstanceId) override
+    {
+        if (_callHook) {
+            _callHook("Hibernate", appInstanceId);
+        }
+        return WPEFramework::Core::ERROR_NONE;
+    }
+    WPEFramework::Core::hresult Wake(const string& appInstanceId, RuntimeState /*runtimeState*/) override
+    {
+        if (_callHook) {
+            _callHook("Wake", appInstanceId);
+        }
+        return WPEFramework::Core::ERROR_NONE;
+    }
     WPEFramework::Core::hresult Suspend(const string& /*appInstanceId*/) override { return WPEFramework::Core::ERROR_NONE; }
     WPEFramework::Core::hresult Resume(const string& /*appInstanceId*/) override { return WPEFramework::Core::ERROR_NONE; }
     WPEFramework::Core::hresult Terminate(const string& /*appInstanceId*/) override { return WPEFramework::Core::ERROR_NONE; }
@@ -97,9 +113,14 @@ public:
     WPEFramework::Core::hresult Mount() override { return WPEFramework::Core::ERROR_NONE; }
     WPEFramework::Core::hresult Unmount() override { return WPEFramework::Core::ERROR_NONE; }
 
+    void SetCallHook(CallHook hook) { _callHook = hook; }
+
     mutable std::atomic<uint32_t> _refCount;
     std::atomic<uint32_t> registerCalls;
     std::atomic<uint32_t> unregisterCalls;
+
+private:
+    CallHook _callHook;
 };
 
 // ──────────────────────────────────────────────────────────────────────────────
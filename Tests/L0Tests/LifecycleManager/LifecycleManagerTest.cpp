@@ -25,6 +25,7 @@
  *   - LifecycleManager_ShellTests.cpp        (LCM-001 to LCM-015)
  *   - LifecycleManager_ImplementationTests.cpp (LCM-016 to LCM-073)
  *   - LifecycleManager_ContextTests.cpp       (LCM-074 to LCM-123)
+ *   - LifecycleManager_AllocationTests.cpp
  */
 
 #include <cstdint>
@@ -88,6 +89,10 @@ extern uint32_t Test_Impl_GetLoadedAppsVerboseNoRuntimeHandler();
 extern uint32_t Test_Impl_SendIntentToActiveAppActiveApp();
 extern uint32_t Test_Impl_DispatchAppStateChangedUnloadedRemovesApp();
 extern uint32_t Test_Impl_CloseAppKillAndRunDefersRespawnUntilUnloaded();
+extern uint32_t Test_Impl_SpawnAppAsyncReturnsGeneratedInstanceId();
+extern uint32_t Test_Impl_SetTargetAppStatesReportsBatchCompletion();
+extern uint32_t Test_Impl_SetTargetAppStatesTimesOut();
+extern uint32_t Test_Impl_GetTransitionLatenciesThroughLocalInterface();
 extern uint32_t Test_Impl_RuntimeEventOnTerminatedUnknownApp();
 extern uint32_t Test_Impl_RuntimeEventOnTerminatedAppInTerminatingState();
 extern uint32_t Test_Impl_RuntimeEventOnTerminatedUnexpected();
@@ -102,6 +107,9 @@ extern uint32_t Test_Impl_WindowEventOnReadyUnknownApp();
 extern uint32_t Test_Impl_WindowEventOnReadyKnownAppWrongTransition();
 extern uint32_t Test_Impl_RuntimeEventOnStateChangedMatchingPendingTransition();
 
+// ── LifecycleManager_AllocationTests.cpp ─────────────────────────────────────
+extern uint32_t Test_ApplicationRegistry_EventStormAllocationBenchmark();
+
 // ── LifecycleManager_ContextTests.cpp ────────────────────────────────────────
 extern uint32_t Test_AppCtx_ConstructorInitialisesState();
 extern uint32_t Test_AppCtx_DestructorDoesNotCrash();
@@ -117,6 +125,13 @@ extern uint32_t Test_AppCtx_StateRoundTrip();
 extern uint32_t Test_AppCtx_GetCurrentLifecycleStateReturnsUnloadedInitially();
 extern uint32_t Test_AppCtx_ApplicationLaunchParamsDefaultConstructor();
 extern uint32_t Test_AppCtx_ApplicationKillParamsDefaultConstructor();
+extern uint32_t Test_ApplicationRegistry_IndexesByAppIdAndInstanceId();
+extern uint32_t Test_ApplicationRegistry_ConcurrentLookupsDuringUpdates();
+extern uint32_t Test_AtomTable_InternsAndReleasesIds();
+extern uint32_t Test_RuntimeStatsCollector_CachesStatsWithinTtl();
+extern uint32_t Test_PendingEventTimer_ExpiresStalledEvents();
+extern uint32_t Test_RespawnGovernor_BacksOffAndOpensCircuit();
+extern uint32_t Test_TelemetryReporting_RecordsTransitionLatencyHistograms();
 extern uint32_t Test_RequestHandler_NullifyStaleEventHandler();
 extern uint32_t Test_StateHandler_InitializePopulatesMap();
 extern uint32_t Test_StateHandler_ChangeStateNullContextReturnsFalse();
@@ -149,6 +164,11 @@ extern uint32_t Test_RequestHandler_SendIntentStoresIntentOnContext();
 extern uint32_t Test_RequestHandler_GetWindowManagerHandlerReturnsNull();
 extern uint32_t Test_AppCtx_GetRequestTypeDefaultIsNone();
 extern uint32_t Test_StateHandler_ChangeStateLoadingToTerminatingPath();
+extern uint32_t Test_StateHandler_TransitionTableMatchesLegacySearchBenchmark();
+extern uint32_t Test_StateTransitionHandler_SlowContextDoesNotBlockOthers();
+extern uint32_t Test_StateTransitionHandler_CoalescesPendingRequests();
+extern uint32_t Test_StateTransitionHandler_KeepsPendingTermination();
+extern uint32_t Test_StateTransitionHandler_ReportsPriorityLaneStats();
 
 // ── Telemetry tests (TelemetryMetricsClient) ─────────────────────────────────
 extern uint32_t Test_TelemetryMetricsClient_IsAvailableReturnsTrue();
@@ -221,6 +241,10 @@ int main()
         { "Impl_SendIntentToActiveAppActiveApp",                    Test_Impl_SendIntentToActiveAppActiveApp },
         { "Impl_DispatchAppStateChangedUnloadedRemovesApp",         Test_Impl_DispatchAppStateChangedUnloadedRemovesApp },
         { "Impl_CloseAppKillAndRunDefersRespawnUntilUnloaded",      Test_Impl_CloseAppKillAndRunDefersRespawnUntilUnloaded },
+        { "Impl_SpawnAppAsyncReturnsGeneratedInstanceId",           Test_Impl_SpawnAppAsyncReturnsGeneratedInstanceId },
+        { "Impl_SetTargetAppStatesReportsBatchCompletion",          Test_Impl_SetTargetAppStatesReportsBatchCompletion },
+        { "Impl_SetTargetAppStatesTimesOut",                        Test_Impl_SetTargetAppStatesTimesOut },
+        { "Impl_GetTransitionLatenciesThroughLocalInterface",       Test_Impl_GetTransitionLatenciesThroughLocalInterface },
         { "Impl_RuntimeEventOnTerminatedUnknownApp",                  Test_Impl_RuntimeEventOnTerminatedUnknownApp },
         { "Impl_RuntimeEventOnTerminatedAppInTerminatingState",        Test_Impl_RuntimeEventOnTerminatedAppInTerminatingState },
         { "Impl_RuntimeEventOnTerminatedUnexpected",                   Test_Impl_RuntimeEventOnTerminatedUnexpected },
@@ -250,6 +274,14 @@ int main()
         { "AppCtx_GetCurrentLifecycleStateReturnsUnloadedInitially",Test_AppCtx_GetCurrentLifecycleStateReturnsUnloadedInitially },
         { "AppCtx_ApplicationLaunchParamsDefaultConstructor",       Test_AppCtx_ApplicationLaunchParamsDefaultConstructor },
         { "AppCtx_ApplicationKillParamsDefaultConstructor",         Test_AppCtx_ApplicationKillParamsDefaultConstructor },
+        { "ApplicationRegistry_IndexesByAppIdAndInstanceId",        Test_ApplicationRegistry_IndexesByAppIdAndInstanceId },
+        { "ApplicationRegistry_ConcurrentLookupsDuringUpdates",     Test_ApplicationRegistry_ConcurrentLookupsDuringUpdates },
+        { "AtomTable_InternsAndReleasesIds",                        Test_AtomTable_InternsAndReleasesIds },
+        { "ApplicationRegistry_EventStormAllocationBenchmark",      Test_ApplicationRegistry_EventStormAllocationBenchmark },
+        { "RuntimeStatsCollector_CachesStatsWithinTtl",            Test_RuntimeStatsCollector_CachesStatsWithinTtl },
+        { "PendingEventTimer_ExpiresStalledEvents",                Test_PendingEventTimer_ExpiresStalledEvents },
+        { "RespawnGovernor_BacksOffAndOpensCircuit",               Test_RespawnGovernor_BacksOffAndOpensCircuit },
+        { "TelemetryReporting_RecordsTransitionLatencyHistograms", Test_TelemetryReporting_RecordsTransitionLatencyHistograms },
         { "AppCtx_GetRequestTypeDefaultIsNone",                     Test_AppCtx_GetRequestTypeDefaultIsNone },
 
         // ── StateHandler tests ───────────────────────────────────────────────
@@ -271,6 +303,11 @@ int main()
         { "StateHandler_CreateStateHibernatedViaSuspendedToHibernated",      Test_StateHandler_CreateStateHibernatedViaSuspendedToHibernated },
         { "StateHandler_InvalidTransitionReturnsFalse",                      Test_StateHandler_InvalidTransitionReturnsFalse },
         { "StateHandler_ChangeStateLoadingToTerminatingPath",                    Test_StateHandler_ChangeStateLoadingToTerminatingPath },
+        { "StateHandler_TransitionTableMatchesLegacySearchBenchmark",           Test_StateHandler_TransitionTableMatchesLegacySearchBenchmark },
+        { "StateTransitionHandler_SlowContextDoesNotBlockOthers",               Test_StateTransitionHandler_SlowContextDoesNotBlockOthers },
+        { "StateTransitionHandler_CoalescesPendingRequests",                    Test_StateTransitionHandler_CoalescesPendingRequests },
+        { "StateTransitionHandler_KeepsPendingTermination",                     Test_StateTransitionHandler_KeepsPendingTermination },
+        { "StateTransitionHandler_ReportsPriorityLaneStats",                    Test_StateTransitionHandler_ReportsPriorityLaneStats },
 
         // ── State subclass tests ─────────────────────────────────────────────
         { "State_UnloadedHandleReturnsTrue",                                     Test_State_UnloadedHandleReturnsTrue },
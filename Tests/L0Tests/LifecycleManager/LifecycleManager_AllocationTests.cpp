@@ -0,0 +1,142 @@
+/**
+ * If not stated otherwise in this file or this component's LICENSE
+ * file the following copyright and licenses apply:
+ *
+ * Copyright 2024 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+/**
+ * @file LifecycleManager_AllocationTests.cpp
+ *
+ * L0 tests that count heap allocations, covering:
+ *   - the allocation-free event lookup path through interned ids
+ *
+ * This file replaces the global operator new and operator delete for the whole
+ * test executable. The replacements only count allocations of a thread while it
+ * sets tCountAllocations and otherwise behave like the default ones.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "ApplicationContext.h"
+#include "ApplicationRegistry.h"
+#include "common/L0Expect.hpp"
+#include "common/L0TestTypes.hpp"
+
+namespace {
+    // Allocations made by the current thread while counting is enabled
+    thread_local bool tCountAllocations = false;
+    thread_local uint64_t tAllocationCount = 0;
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    if (tCountAllocations) {
+        tAllocationCount++;
+    }
+    void* ptr = std::malloc((0 == size) ? 1 : size);
+    if (nullptr == ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Event storm over 50 apps: lookups and id reads do not allocate
+// ─────────────────────────────────────────────────────────────────────────────
+
+uint32_t Test_ApplicationRegistry_EventStormAllocationBenchmark()
+{
+    L0Test::TestResult tr;
+
+    const size_t appCount = 50;
+    const size_t eventsPerApp = 200;
+    WPEFramework::Plugin::ApplicationRegistry registry;
+    std::vector<std::string> eventInstanceIds;
+    std::vector<std::string> eventAppIds;
+    for (size_t index = 0; index < appCount; index++) {
+        auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.storm.app" + std::to_string(index));
+        std::string instance = WPEFramework::Plugin::ApplicationContext::generateAppInstanceId();
+        ctx->setAppInstanceId(instance);
+        registry.add(ctx);
+        // Ids as they arrive in runtime and window manager event payloads
+        eventInstanceIds.push_back(instance);
+        eventAppIds.push_back(ctx->getAppId());
+    }
+
+    // Resolves the context of every event, as Dispatch and the state handler do
+    size_t matched = 0;
+    tAllocationCount = 0;
+    tCountAllocations = true;
+    const auto internedStart = std::chrono::steady_clock::now();
+    for (size_t round = 0; round < eventsPerApp; round++) {
+        for (size_t index = 0; index < appCount; index++) {
+            std::shared_ptr<WPEFramework::Plugin::ApplicationContext> ctx = registry.findByAppInstanceId(eventInstanceIds[index]);
+            if ((nullptr != ctx) && (ctx->getAppId() == eventAppIds[index]) &&
+                (ctx->getAppIdAtom() == registry.findByAppId(eventAppIds[index])->getAppIdAtom()) &&
+                (false == ctx->getAppInstanceId().empty())) {
+                matched++;
+            }
+        }
+    }
+    const auto internedEnd = std::chrono::steady_clock::now();
+    tCountAllocations = false;
+    const uint64_t internedAllocations = tAllocationCount;
+
+    // The same storm with the by-value copies the getters used to return
+    size_t legacyMatched = 0;
+    tAllocationCount = 0;
+    tCountAllocations = true;
+    const auto legacyStart = std::chrono::steady_clock::now();
+    for (size_t round = 0; round < eventsPerApp; round++) {
+        for (size_t index = 0; index < appCount; index++) {
+            std::shared_ptr<WPEFramework::Plugin::ApplicationContext> ctx = registry.findByAppInstanceId(eventInstanceIds[index]);
+            const std::string appId = ctx->getAppId();
+            const std::string appInstanceId = ctx->getAppInstanceId();
+            if ((appId == eventAppIds[index]) && (false == appInstanceId.empty())) {
+                legacyMatched++;
+            }
+        }
+    }
+    const auto legacyEnd = std::chrono::steady_clock::now();
+    tCountAllocations = false;
+    const uint64_t legacyAllocations = tAllocationCount;
+
+    std::cout << "Event storm benchmark: " << (appCount * eventsPerApp) << " events over " << appCount << " apps, interned "
+              << internedAllocations << " allocations "
+              << std::chrono::duration_cast<std::chrono::microseconds>(internedEnd - internedStart).count() << "us, by-value copies "
+              << legacyAllocations << " allocations "
+              << std::chrono::duration_cast<std::chrono::microseconds>(legacyEnd - legacyStart).count() << "us" << std::endl;
+
+    L0Test::ExpectTrue(tr, (matched == (appCount * eventsPerApp)) && (legacyMatched == matched),
+        "every event resolves to the context of its app");
+    L0Test::ExpectTrue(tr, 0 == internedAllocations,
+        "resolving events through interned ids does not allocate");
+    L0Test::ExpectTrue(tr, legacyAllocations >= (2 * appCount * eventsPerApp),
+        "by-value id copies allocate on every event");
+
+    return tr.failures;
+}
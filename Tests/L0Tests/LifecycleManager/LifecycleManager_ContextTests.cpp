@@ -23,24 +23,41 @@
  * L0 tests for ApplicationContext and StateHandler covering:
  *   - ApplicationContext constructor / destructor / getter / setter round-trips
  *   - ApplicationLaunchParams / ApplicationKillParams default construction
+ *   - ApplicationRegistry lookups by appId and appInstanceId
+ *   - AtomTable interning
+ *   - RespawnGovernor backoff and crash-loop circuit breaker
  *   - StateHandler::initialize populates state transition map
  *   - StateHandler::changeState with null context
  *   - StateHandler::changeState already at target
- *   - StateHandler isValidTransition (tested via changeState behavior)
- *   - StateHandler::createState returns correct subclass
+ *   - StateHandler transition table (tested via changeState behavior)
+ *   - State::getInstance returns the flyweight handler for each state
  *   LCM-074 to LCM-101
  */
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <list>
+#include <map>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "ApplicationContext.h"
+#include "ApplicationRegistry.h"
+#include "AtomTable.h"
+#include "RuntimeStatsCollector.h"
+#include "PendingEventTimer.h"
+#include "RespawnGovernor.h"
 #include "StateHandler.h"
 #include "StateTransitionRequest.h"
+#include "StateTransitionHandler.h"
 #include "State.h"
 #include "RequestHandler.h"
+#include "LifecycleManagerTelemetryReporting.h"
 #include "UtilsTelemetryMetrics.h"
 #include "LifecycleManagerServiceMock.h"
 #include "common/L0Expect.hpp"
@@ -59,7 +76,6 @@ namespace {
     static L0Test::FakeWindowManager  gCtxTestWm;
 } // namespace
 
-
 // ─────────────────────────────────────────────────────────────────────────────
 // ApplicationContext constructor initialises state and semaphores
 // ─────────────────────────────────────────────────────────────────────────────
@@ -285,9 +301,7 @@ uint32_t Test_AppCtx_StateRoundTrip()
         "getState() returns non-null after construction (UnloadedState)");
 
     // Create a new state and set it
-    WPEFramework::Plugin::LoadingState* loadingState = new WPEFramework::Plugin::LoadingState(&ctx);
-    // Replace state manually (note: this leaks the original, handled below)
-    void* oldState = ctx.getState();
+    WPEFramework::Plugin::State* loadingState = WPEFramework::Plugin::State::getInstance(WPEFramework::Exchange::ILifecycleManager::LifecycleState::LOADING);
     ctx.setState(loadingState);
 
     L0Test::ExpectTrue(tr, ctx.getState() != nullptr,
@@ -297,12 +311,6 @@ uint32_t Test_AppCtx_StateRoundTrip()
         static_cast<uint32_t>(WPEFramework::Exchange::ILifecycleManager::LifecycleState::LOADING),
         "getCurrentLifecycleState() returns LOADING after setState(LoadingState)");
 
-    // Clean up: delete old state
-    if (nullptr != oldState) {
-        delete static_cast<WPEFramework::Plugin::State*>(oldState);
-    }
-    // Note: ApplicationContext destructor will delete loadingState (current mState)
-
     return tr.failures;
 }
 
@@ -364,6 +372,323 @@ uint32_t Test_AppCtx_ApplicationKillParamsDefaultConstructor()
     return tr.failures;
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+// ApplicationRegistry indexes contexts by appId and appInstanceId
+// ─────────────────────────────────────────────────────────────────────────────
+
+uint32_t Test_ApplicationRegistry_IndexesByAppIdAndInstanceId()
+{
+    L0Test::TestResult tr;
+
+    WPEFramework::Plugin::ApplicationRegistry registry;
+    auto first = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.registry.first");
+    auto second = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.registry.second");
+    std::string firstInstance = "inst-registry-001";
+    first->setAppInstanceId(firstInstance);
+    registry.add(first);
+    registry.add(second);
+
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(registry.size()), 2u,
+        "registry holds both contexts");
+    L0Test::ExpectTrue(tr, registry.findByAppId("com.test.registry.second") == second,
+        "findByAppId returns the context added for that appId");
+    L0Test::ExpectTrue(tr, registry.findByAppInstanceId(firstInstance) == first,
+        "findByAppInstanceId returns the context with that appInstanceId");
+
+    // appInstanceId is assigned after the context was added (LOADING state)
+    std::string secondInstance = "inst-registry-002";
+    second->setAppInstanceId(secondInstance);
+    L0Test::ExpectTrue(tr, registry.findByAppInstanceId(secondInstance) == second,
+        "findByAppInstanceId finds an appInstanceId assigned after add()");
+
+    // A replaced appInstanceId is reindexed by the context, the old one no longer resolves
+    std::string replacedInstance = "inst-registry-002b";
+    second->setAppInstanceId(replacedInstance);
+    L0Test::ExpectTrue(tr, nullptr == registry.findByAppInstanceId(secondInstance),
+        "findByAppInstanceId does not return a context for its replaced appInstanceId");
+    L0Test::ExpectTrue(tr, registry.findByAppInstanceId(replacedInstance) == second,
+        "findByAppInstanceId finds the context by its new appInstanceId");
+
+    std::vector<std::shared_ptr<WPEFramework::Plugin::ApplicationContext>> applications = registry.getApplications();
+    L0Test::ExpectTrue(tr, (2 == applications.size()) && (applications[0] == first) && (applications[1] == second),
+        "getApplications keeps the order contexts were added in");
+
+    L0Test::ExpectTrue(tr, registry.remove(firstInstance),
+        "remove() succeeds for a known appInstanceId");
+    L0Test::ExpectTrue(tr, nullptr == registry.findByAppInstanceId(firstInstance),
+        "removed context is not found by appInstanceId");
+    L0Test::ExpectTrue(tr, nullptr == registry.findByAppId("com.test.registry.first"),
+        "removed context is not found by appId");
+    L0Test::ExpectTrue(tr, !registry.remove(firstInstance),
+        "remove() of an unknown appInstanceId returns false");
+
+    registry.clear();
+    L0Test::ExpectTrue(tr, registry.empty(),
+        "registry is empty after clear()");
+
+    return tr.failures;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// ApplicationRegistry lookups run while other threads add and remove contexts
+// ─────────────────────────────────────────────────────────────────────────────
+
+uint32_t Test_ApplicationRegistry_ConcurrentLookupsDuringUpdates()
+{
+    L0Test::TestResult tr;
+
+    WPEFramework::Plugin::ApplicationRegistry registry;
+    auto resident = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.registry.resident");
+    std::string residentInstance = "inst-registry-resident";
+    resident->setAppInstanceId(residentInstance);
+    registry.add(resident);
+
+    std::atomic<bool> running{true};
+    std::atomic<uint32_t> misses{0};
+    std::vector<std::thread> readers;
+    for (int index = 0; index < 4; index++) {
+        readers.push_back(std::thread([&]() {
+            while (running.load()) {
+                if ((registry.findByAppId("com.test.registry.resident") != resident) ||
+                    (registry.findByAppInstanceId(residentInstance) != resident)) {
+                    misses++;
+                }
+            }
+        }));
+    }
+
+    for (int index = 0; index < 2000; index++) {
+        auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.registry.churn");
+        std::string instance = "inst-churn-" + std::to_string(index);
+        ctx->setAppInstanceId(instance);
+        registry.add(ctx);
+        registry.remove(instance);
+    }
+    running.store(false);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    L0Test::ExpectEqU32(tr, misses.load(), 0u,
+        "resident context is always found while other contexts are added and removed");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(registry.size()), 1u,
+        "only the resident context remains");
+
+    return tr.failures;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// AtomTable hands out one atom per string and recycles released atoms
+// ─────────────────────────────────────────────────────────────────────────────
+
+uint32_t Test_AtomTable_InternsAndReleasesIds()
+{
+    L0Test::TestResult tr;
+    WPEFramework::Plugin::AtomTable& atomTable = WPEFramework::Plugin::AtomTable::getInstance();
+
+    const std::string id = "com.test.atom.0123456789abcdef";
+    const WPEFramework::Plugin::Atom first = atomTable.intern(id);
+    const WPEFramework::Plugin::Atom second = atomTable.intern(id);
+
+    L0Test::ExpectTrue(tr, first == second, "interning the same string twice returns the same atom");
+    L0Test::ExpectTrue(tr, EMPTY_ATOM == atomTable.intern(""), "the empty string is the empty atom");
+    L0Test::ExpectEqStr(tr, atomTable.name(first), id, "name() returns the interned string");
+    L0Test::ExpectTrue(tr, first == atomTable.find(id), "find() returns the atom of an interned string");
+    L0Test::ExpectTrue(tr, INVALID_ATOM == atomTable.find("com.test.atom.unknown"), "find() does not intern unknown strings");
+
+    atomTable.release(first);
+    L0Test::ExpectTrue(tr, first == atomTable.find(id), "atom stays valid while a reference is held");
+    atomTable.release(second);
+    L0Test::ExpectTrue(tr, INVALID_ATOM == atomTable.find(id), "atom is dropped with its last reference");
+
+    {
+        WPEFramework::Plugin::ApplicationContext ctx("com.test.atom.context");
+        std::string instance = "inst-atom-context";
+        ctx.setAppInstanceId(instance);
+        L0Test::ExpectTrue(tr, ctx.getAppInstanceIdAtom() == atomTable.find(instance), "context interns its appInstanceId");
+        L0Test::ExpectTrue(tr, ctx.getAppIdAtom() == atomTable.find("com.test.atom.context"), "context interns its appId");
+    }
+    L0Test::ExpectTrue(tr, INVALID_ATOM == atomTable.find("inst-atom-context"), "context releases its atoms when destroyed");
+
+    {
+        WPEFramework::Plugin::ApplicationContext ctx("com.test.atom.pinned");
+        std::string instance = "inst-atom-pinned-old";
+        ctx.setAppInstanceId(instance);
+        const std::string& oldName = ctx.getAppInstanceId();
+        std::string replacement = "inst-atom-pinned-new";
+        ctx.setAppInstanceId(replacement);
+        // A released slot would be reused by the next interned string
+        const WPEFramework::Plugin::Atom other = atomTable.intern("inst-atom-pinned-other");
+        L0Test::ExpectEqStr(tr, oldName, "inst-atom-pinned-old", "name read before a replacement stays valid");
+        L0Test::ExpectEqStr(tr, ctx.getAppInstanceId(), "inst-atom-pinned-new", "context returns the replacement id");
+        atomTable.release(other);
+    }
+    L0Test::ExpectTrue(tr, INVALID_ATOM == atomTable.find("inst-atom-pinned-old"), "replaced id is released with the context");
+
+    return tr.failures;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// RuntimeStatsCollector fetches in parallel and serves repeated polls from cache
+// ─────────────────────────────────────────────────────────────────────────────
+
+uint32_t Test_RuntimeStatsCollector_CachesStatsWithinTtl()
+{
+    L0Test::TestResult tr;
+
+    WPEFramework::Plugin::RuntimeStatsCollector collector;
+    std::atomic<uint32_t> fetches{0};
+    WPEFramework::Plugin::RuntimeStatsCollector::Fetcher fetcher =
+        [&fetches](const std::string& appInstanceId, std::string& stats) {
+            fetches++;
+            if (appInstanceId == "inst-stats-missing") {
+                return false;
+            }
+            stats = "{\"id\":\"" + appInstanceId + "\"}";
+            return true;
+        };
+
+    std::vector<std::string> ids;
+    for (int index = 0; index < 8; index++) {
+        ids.push_back("inst-stats-" + std::to_string(index));
+    }
+    ids.push_back("inst-stats-missing");
+
+    collector.setCacheTtl(60000);
+    std::vector<WPEFramework::Plugin::RuntimeStats> stats;
+    collector.collect(ids, fetcher, stats);
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(stats.size()), static_cast<uint32_t>(ids.size()),
+        "one result per appInstanceId");
+    L0Test::ExpectEqU32(tr, fetches.load(), static_cast<uint32_t>(ids.size()),
+        "first poll fetches every app");
+    L0Test::ExpectTrue(tr, stats[3].mAvailable, "stats of a running app are available");
+    L0Test::ExpectEqStr(tr, stats[3].mStats, "{\"id\":\"inst-stats-3\"}",
+        "results keep the order of the requested ids");
+    L0Test::ExpectTrue(tr, !stats[8].mAvailable, "failed fetch is reported as unavailable");
+
+    collector.collect(ids, fetcher, stats);
+    L0Test::ExpectEqU32(tr, fetches.load(), static_cast<uint32_t>(ids.size()) + 1u,
+        "second poll within the TTL only retries the failed app");
+
+    collector.invalidate("inst-stats-0");
+    collector.collect(ids, fetcher, stats);
+    L0Test::ExpectEqU32(tr, fetches.load(), static_cast<uint32_t>(ids.size()) + 3u,
+        "invalidated app is fetched again");
+
+    collector.setCacheTtl(0);
+    collector.collect(ids, fetcher, stats);
+    L0Test::ExpectEqU32(tr, fetches.load(), static_cast<uint32_t>(ids.size()) * 2u + 3u,
+        "TTL of 0 disables the cache");
+
+    return tr.failures;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// PendingEventTimer reports stalled events once their deadline passes
+// ─────────────────────────────────────────────────────────────────────────────
+
+uint32_t Test_PendingEventTimer_ExpiresStalledEvents()
+{
+    L0Test::TestResult tr;
+
+    std::mutex expiredLock;
+    std::vector<std::pair<std::string, std::string>> expired;
+    WPEFramework::Plugin::PendingEventTimer* timer = WPEFramework::Plugin::PendingEventTimer::getInstance();
+    L0Test::ExpectTrue(tr, timer->initialize([&](const std::string& appInstanceId, const std::string& eventName) {
+            std::lock_guard<std::mutex> lock(expiredLock);
+            expired.push_back(std::make_pair(appInstanceId, eventName));
+        }), "timer starts");
+    timer->setTimeout("onAppReady", 200);
+    timer->setTimeout("onFirstFrame", 200);
+    timer->setTimeout("onAppRunning", 0);
+
+    timer->schedule("inst-timer-stalled", "onAppReady");
+    timer->schedule("inst-timer-cancelled", "onFirstFrame");
+    timer->schedule("inst-timer-disabled", "onAppRunning");
+    timer->cancel("inst-timer-cancelled");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(timer->getScheduledCount()), 1u,
+        "cancelled and disabled deadlines are not armed");
+
+    // Asking again for the same event keeps the original deadline
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    timer->schedule("inst-timer-stalled", "onAppReady");
+
+    size_t expiredCount = 0;
+    for (int wait = 0; (wait < 40) && (0 == expiredCount); wait++) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        std::lock_guard<std::mutex> lock(expiredLock);
+        expiredCount = expired.size();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+    timer->terminate();
+
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(expired.size()), 1u, "only the stalled app expires");
+    if (1 == expired.size()) {
+        L0Test::ExpectEqStr(tr, expired[0].first, "inst-timer-stalled", "expiry names the app");
+        L0Test::ExpectEqStr(tr, expired[0].second, "onAppReady", "expiry names the stalled event");
+    }
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(timer->getScheduledCount()), 0u, "expired deadline is removed");
+
+    timer->setTimeout("onAppReady", DEFAULT_ON_APP_READY_TIMEOUT_MS);
+    timer->setTimeout("onFirstFrame", DEFAULT_ON_FIRST_FRAME_TIMEOUT_MS);
+    timer->setTimeout("onAppRunning", DEFAULT_ON_APP_RUNNING_TIMEOUT_MS);
+
+    return tr.failures;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// RespawnGovernor backs off per crash and refuses respawns of a crash loop
+// ─────────────────────────────────────────────────────────────────────────────
+
+uint32_t Test_RespawnGovernor_BacksOffAndOpensCircuit()
+{
+    L0Test::TestResult tr;
+
+    WPEFramework::Plugin::RespawnGovernor governor;
+    governor.configure(20, 50, 500, 3);
+    std::atomic<int> respawns(0);
+    uint32_t delayMs = 0;
+
+    L0Test::ExpectTrue(tr, governor.schedule("com.test.healthy", [&respawns]() { respawns++; }, delayMs) && (0u == delayMs),
+        "respawn without recent crashes is scheduled without delay");
+    L0Test::ExpectTrue(tr, false == governor.recordCrash("com.test.crashing"), "first crash does not open the circuit");
+    L0Test::ExpectTrue(tr, governor.schedule("com.test.crashing", [&respawns]() { respawns++; }, delayMs) && (20u == delayMs),
+        "first crash delays the respawn by the initial backoff");
+    governor.recordCrash("com.test.crashing");
+    L0Test::ExpectTrue(tr, governor.schedule("com.test.crashing", [&respawns]() { respawns++; }, delayMs) && (40u == delayMs),
+        "second crash doubles the backoff and replaces the scheduled respawn");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(governor.getScheduledCount()), 1u,
+        "one respawn at most is scheduled per appId");
+
+    L0Test::ExpectTrue(tr, governor.recordCrash("com.test.crashing"), "crash reaching the limit opens the circuit");
+    L0Test::ExpectTrue(tr, governor.isCircuitOpen("com.test.crashing"), "circuit reports open");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(governor.getScheduledCount()), 0u,
+        "opening the circuit drops the scheduled respawn");
+    L0Test::ExpectTrue(tr, false == governor.schedule("com.test.crashing", [&respawns]() { respawns++; }, delayMs),
+        "respawn is refused while the circuit is open");
+    L0Test::ExpectTrue(tr, governor.schedule("com.test.other", [&respawns]() { respawns++; }, delayMs) && (0u == delayMs),
+        "other apps still respawn right away");
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while ((respawns.load() < 2) && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(respawns.load()), 2u,
+        "only the respawns of healthy apps ran");
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));
+    L0Test::ExpectTrue(tr, false == governor.isCircuitOpen("com.test.crashing"),
+        "circuit closes once the crashes leave the window");
+    L0Test::ExpectEqU32(tr, governor.getCrashCount("com.test.crashing"), 0u,
+        "crash count only covers the window");
+
+    governor.terminate();
+    L0Test::ExpectTrue(tr, false == governor.schedule("com.test.healthy", [&respawns]() { respawns++; }, delayMs),
+        "no respawn is scheduled after terminate()");
+
+    return tr.failures;
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // Resets RequestHandler state so StateHandler::sendEvent() fires into a no-op stub
 // instead of the dangling mEventHandler left by shell-test teardowns
@@ -464,12 +789,8 @@ uint32_t Test_StateHandler_OnAppReadyPendingPathRetainsCurrentState()
 
     auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.appready.pending");
 
-    void* oldState = ctx->getState();
-    auto* initializingState = new WPEFramework::Plugin::InitializingState(ctx.get());
+    WPEFramework::Plugin::State* initializingState = WPEFramework::Plugin::State::getInstance(WPEFramework::Exchange::ILifecycleManager::LifecycleState::INITIALIZING);
     ctx->setState(initializingState);
-    if (nullptr != oldState) {
-        delete static_cast<WPEFramework::Plugin::State*>(oldState);
-    }
 
     WPEFramework::Plugin::StateTransitionRequest req(
         ctx,
@@ -544,12 +865,8 @@ uint32_t Test_StateHandler_TransitionActiveToUnloadedIsInvalid()
     // Build context at ACTIVE state by manually setting state object
     auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.invalid");
     // Replace state with ActiveState
-    void* oldState = ctx->getState();
-    WPEFramework::Plugin::ActiveState* activeState = new WPEFramework::Plugin::ActiveState(ctx.get());
+    WPEFramework::Plugin::State* activeState = WPEFramework::Plugin::State::getInstance(WPEFramework::Exchange::ILifecycleManager::LifecycleState::ACTIVE);
     ctx->setState(activeState);
-    if (nullptr != oldState) {
-        delete static_cast<WPEFramework::Plugin::State*>(oldState);
-    }
 
     // Attempt ACTIVE->UNLOADED (no valid path in map)
     WPEFramework::Plugin::StateTransitionRequest req(ctx,
@@ -665,12 +982,8 @@ uint32_t Test_StateHandler_CreateStateReturnsCorrectSubclass()
     {
         WPEFramework::Plugin::ApplicationContext ctx("com.test.create.paused");
         // Manually set to INITIALIZING state (no handle() calls needed for updateState path)
-        void* oldState = ctx.getState();
-        WPEFramework::Plugin::InitializingState* initState = new WPEFramework::Plugin::InitializingState(&ctx);
+        WPEFramework::Plugin::State* initState = WPEFramework::Plugin::State::getInstance(WPEFramework::Exchange::ILifecycleManager::LifecycleState::INITIALIZING);
         ctx.setState(initState);
-        if (nullptr != oldState) {
-            delete static_cast<WPEFramework::Plugin::State*>(oldState);
-        }
         // Now context reports INITIALIZING
         L0Test::ExpectEqU32(tr,
             static_cast<uint32_t>(ctx.getCurrentLifecycleState()),
@@ -690,10 +1003,10 @@ uint32_t Test_State_UnloadedHandleReturnsTrue()
     L0Test::TestResult tr;
 
     WPEFramework::Plugin::ApplicationContext ctx("com.test.unloaded.handle");
-    WPEFramework::Plugin::UnloadedState state(&ctx);
+    WPEFramework::Plugin::UnloadedState state;
     std::string error;
 
-    bool result = state.handle(error);
+    bool result = state.handle(&ctx, error);
     L0Test::ExpectTrue(tr, result,
         "UnloadedState::handle() returns true");
 
@@ -709,10 +1022,10 @@ uint32_t Test_State_LoadingHandleGeneratesAppInstanceId()
     L0Test::TestResult tr;
 
     WPEFramework::Plugin::ApplicationContext ctx("com.test.loading.handle");
-    WPEFramework::Plugin::LoadingState state(&ctx);
+    WPEFramework::Plugin::LoadingState state;
     std::string error;
 
-    bool result = state.handle(error);
+    bool result = state.handle(&ctx, error);
     L0Test::ExpectTrue(tr, result,
         "LoadingState::handle() returns true");
     L0Test::ExpectTrue(tr, !ctx.getAppInstanceId().empty(),
@@ -737,10 +1050,10 @@ uint32_t Test_State_InitializingHandleReturnsFalseWhenHandlerNull()
     // RequestHandler is a singleton; its getRuntimeManagerHandler() returns nullptr
     // until initialize() is called.  In L0 tests without Configure(), it is null.
     WPEFramework::Plugin::ApplicationContext ctx("com.test.init.handle");
-    WPEFramework::Plugin::InitializingState state(&ctx);
+    WPEFramework::Plugin::InitializingState state;
     std::string error;
 
-    bool result = state.handle(error);
+    bool result = state.handle(&ctx, error);
     // If RequestHandler was already initialized in another test, handle could be true.
     // We just verify there is no crash.
     L0Test::ExpectTrue(tr, result == true || result == false,
@@ -759,12 +1072,8 @@ uint32_t Test_State_PausedHandleFromInitializingReturnsTrue()
 
     WPEFramework::Plugin::ApplicationContext ctx("com.test.paused.init");
     // Set the context into INITIALIZING state by replacing the state object
-    void* oldState = ctx.getState();
-    WPEFramework::Plugin::InitializingState* initState = new WPEFramework::Plugin::InitializingState(&ctx);
+    WPEFramework::Plugin::State* initState = WPEFramework::Plugin::State::getInstance(WPEFramework::Exchange::ILifecycleManager::LifecycleState::INITIALIZING);
     ctx.setState(initState);
-    if (nullptr != oldState) {
-        delete static_cast<WPEFramework::Plugin::State*>(oldState);
-    }
 
     // Context now reports INITIALIZING
     L0Test::ExpectEqU32(tr,
@@ -773,9 +1082,9 @@ uint32_t Test_State_PausedHandleFromInitializingReturnsTrue()
         "context is INITIALIZING before calling PausedState::handle()");
 
     // Instantiate PausedState and call handle() directly
-    WPEFramework::Plugin::PausedState pausedState(&ctx);
+    WPEFramework::Plugin::PausedState pausedState;
     std::string error;
-    bool result = pausedState.handle(error);
+    bool result = pausedState.handle(&ctx, error);
 
     L0Test::ExpectTrue(tr, result,
         "PausedState::handle() returns true when context is in INITIALIZING state");
@@ -793,21 +1102,17 @@ uint32_t Test_State_PausedHandleFromActiveReturnsTrue()
 
     WPEFramework::Plugin::ApplicationContext ctx("com.test.paused.active");
     // Place context into ACTIVE state
-    void* oldState = ctx.getState();
-    WPEFramework::Plugin::ActiveState* activeState = new WPEFramework::Plugin::ActiveState(&ctx);
+    WPEFramework::Plugin::State* activeState = WPEFramework::Plugin::State::getInstance(WPEFramework::Exchange::ILifecycleManager::LifecycleState::ACTIVE);
     ctx.setState(activeState);
-    if (nullptr != oldState) {
-        delete static_cast<WPEFramework::Plugin::State*>(oldState);
-    }
 
     L0Test::ExpectEqU32(tr,
         static_cast<uint32_t>(ctx.getCurrentLifecycleState()),
         static_cast<uint32_t>(WPEFramework::Exchange::ILifecycleManager::LifecycleState::ACTIVE),
         "context is ACTIVE before calling PausedState::handle()");
 
-    WPEFramework::Plugin::PausedState pausedState(&ctx);
+    WPEFramework::Plugin::PausedState pausedState;
     std::string error;
-    bool result = pausedState.handle(error);
+    bool result = pausedState.handle(&ctx, error);
 
     L0Test::ExpectTrue(tr, result,
         "PausedState::handle() returns true when context is in ACTIVE state");
@@ -825,12 +1130,8 @@ uint32_t Test_State_PausedHandleFromSuspendedNoHandlerReturnsFalse()
 
     WPEFramework::Plugin::ApplicationContext ctx("com.test.paused.suspended");
     // Place context into SUSPENDED state
-    void* oldState = ctx.getState();
-    WPEFramework::Plugin::SuspendedState* suspendedState = new WPEFramework::Plugin::SuspendedState(&ctx);
+    WPEFramework::Plugin::State* suspendedState = WPEFramework::Plugin::State::getInstance(WPEFramework::Exchange::ILifecycleManager::LifecycleState::SUSPENDED);
     ctx.setState(suspendedState);
-    if (nullptr != oldState) {
-        delete static_cast<WPEFramework::Plugin::State*>(oldState);
-    }
 
     L0Test::ExpectEqU32(tr,
         static_cast<uint32_t>(ctx.getCurrentLifecycleState()),
@@ -838,9 +1139,9 @@ uint32_t Test_State_PausedHandleFromSuspendedNoHandlerReturnsFalse()
         "context is SUSPENDED before calling PausedState::handle()");
 
     // getRuntimeManagerHandler() returns nullptr in L0 tests (no initialize() called)
-    WPEFramework::Plugin::PausedState pausedState(&ctx);
+    WPEFramework::Plugin::PausedState pausedState;
     std::string error;
-    bool result = pausedState.handle(error);
+    bool result = pausedState.handle(&ctx, error);
 
     // Without a runtime handler the SUSPENDED branch returns false
     L0Test::ExpectTrue(tr, !result,
@@ -858,11 +1159,11 @@ uint32_t Test_State_ActiveHandleNoWindowHandlerReturnsTrue()
     L0Test::TestResult tr;
 
     WPEFramework::Plugin::ApplicationContext ctx("com.test.active.nohandler");
-    WPEFramework::Plugin::ActiveState state(&ctx);
+    WPEFramework::Plugin::ActiveState state;
     std::string error;
 
     // getWindowManagerHandler() returns nullptr in L0 tests -> falls through to return true
-    bool result = state.handle(error);
+    bool result = state.handle(&ctx, error);
 
     L0Test::ExpectTrue(tr, result,
         "ActiveState::handle() returns true when windowManagerHandler is null");
@@ -879,11 +1180,11 @@ uint32_t Test_State_SuspendedHandleNoRuntimeHandlerReturnsFalse()
     L0Test::TestResult tr;
 
     WPEFramework::Plugin::ApplicationContext ctx("com.test.suspended.nohandler");
-    WPEFramework::Plugin::SuspendedState state(&ctx);
+    WPEFramework::Plugin::SuspendedState state;
     std::string error;
 
     // getRuntimeManagerHandler() returns nullptr -> ret stays false
-    bool result = state.handle(error);
+    bool result = state.handle(&ctx, error);
 
     L0Test::ExpectTrue(tr, !result,
         "SuspendedState::handle() returns false when runtimeManagerHandler is null");
@@ -900,10 +1201,10 @@ uint32_t Test_State_HibernatedHandleNoRuntimeHandlerReturnsFalse()
     L0Test::TestResult tr;
 
     WPEFramework::Plugin::ApplicationContext ctx("com.test.hibernated.nohandler");
-    WPEFramework::Plugin::HibernatedState state(&ctx);
+    WPEFramework::Plugin::HibernatedState state;
     std::string error;
 
-    bool result = state.handle(error);
+    bool result = state.handle(&ctx, error);
 
     L0Test::ExpectTrue(tr, !result,
         "HibernatedState::handle() returns false when runtimeManagerHandler is null");
@@ -920,10 +1221,10 @@ uint32_t Test_State_TerminatingHandleNoRuntimeHandlerReturnsFalse()
     L0Test::TestResult tr;
 
     WPEFramework::Plugin::ApplicationContext ctx("com.test.terminating.nohandler");
-    WPEFramework::Plugin::TerminatingState state(&ctx);
+    WPEFramework::Plugin::TerminatingState state;
     std::string error;
 
-    bool result = state.handle(error);
+    bool result = state.handle(&ctx, error);
 
     L0Test::ExpectTrue(tr, !result,
         "TerminatingState::handle() returns false when runtimeManagerHandler is null");
@@ -944,10 +1245,10 @@ uint32_t Test_State_TerminatingHandleForceKillNoRuntimeHandlerReturnsFalse()
     WPEFramework::Plugin::ApplicationContext ctx("com.test.terminating.force");
     ctx.setApplicationKillParams(true);  // force=true
 
-    WPEFramework::Plugin::TerminatingState state(&ctx);
+    WPEFramework::Plugin::TerminatingState state;
     std::string error;
 
-    bool result = state.handle(error);
+    bool result = state.handle(&ctx, error);
 
     L0Test::ExpectTrue(tr, !result,
         "TerminatingState::handle() with mForce=true returns false when handler is null");
@@ -971,12 +1272,8 @@ uint32_t Test_StateHandler_CreateStatePausedViaInitializingToPaused()
 
     auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.create.paused2");
     // Manually advance context to INITIALIZING (skip LOADING handle side-effects)
-    void* oldState = ctx->getState();
-    WPEFramework::Plugin::InitializingState* initState = new WPEFramework::Plugin::InitializingState(ctx.get());
+    WPEFramework::Plugin::State* initState = WPEFramework::Plugin::State::getInstance(WPEFramework::Exchange::ILifecycleManager::LifecycleState::INITIALIZING);
     ctx->setState(initState);
-    if (nullptr != oldState) {
-        delete static_cast<WPEFramework::Plugin::State*>(oldState);
-    }
 
     // Transition INITIALIZING -> PAUSED
     WPEFramework::Plugin::StateTransitionRequest req(ctx,
@@ -1042,12 +1339,8 @@ uint32_t Test_StateHandler_CreateStateActiveViaPausedToActive()
 
     auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.create.active");
     // Manually place context in PAUSED state
-    void* oldState = ctx->getState();
-    WPEFramework::Plugin::PausedState* pausedState = new WPEFramework::Plugin::PausedState(ctx.get());
+    WPEFramework::Plugin::State* pausedState = WPEFramework::Plugin::State::getInstance(WPEFramework::Exchange::ILifecycleManager::LifecycleState::PAUSED);
     ctx->setState(pausedState);
-    if (nullptr != oldState) {
-        delete static_cast<WPEFramework::Plugin::State*>(oldState);
-    }
 
     // Transition PAUSED -> ACTIVE
     WPEFramework::Plugin::StateTransitionRequest req(ctx,
@@ -1078,12 +1371,8 @@ uint32_t Test_StateHandler_CreateStateSuspendedViaPausedToSuspended()
 
     auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.create.suspended");
     // Place context in PAUSED state
-    void* oldState = ctx->getState();
-    WPEFramework::Plugin::PausedState* pausedState = new WPEFramework::Plugin::PausedState(ctx.get());
+    WPEFramework::Plugin::State* pausedState = WPEFramework::Plugin::State::getInstance(WPEFramework::Exchange::ILifecycleManager::LifecycleState::PAUSED);
     ctx->setState(pausedState);
-    if (nullptr != oldState) {
-        delete static_cast<WPEFramework::Plugin::State*>(oldState);
-    }
 
     // Transition PAUSED -> SUSPENDED
     WPEFramework::Plugin::StateTransitionRequest req(ctx,
@@ -1111,12 +1400,8 @@ uint32_t Test_StateHandler_CreateStateHibernatedViaSuspendedToHibernated()
 
     auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.create.hibernated");
     // Place context in SUSPENDED state
-    void* oldState = ctx->getState();
-    WPEFramework::Plugin::SuspendedState* suspendedState = new WPEFramework::Plugin::SuspendedState(ctx.get());
+    WPEFramework::Plugin::State* suspendedState = WPEFramework::Plugin::State::getInstance(WPEFramework::Exchange::ILifecycleManager::LifecycleState::SUSPENDED);
     ctx->setState(suspendedState);
-    if (nullptr != oldState) {
-        delete static_cast<WPEFramework::Plugin::State*>(oldState);
-    }
 
     // Transition SUSPENDED -> HIBERNATED
     WPEFramework::Plugin::StateTransitionRequest req(ctx,
@@ -1151,12 +1436,8 @@ uint32_t Test_StateHandler_InvalidTransitionReturnsFalse()
 
     // From LOADING, try to go to ACTIVE (no direct path -> getStatePath returns false)
     auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.invalid.transition");
-    void* oldState = ctx->getState();
-    WPEFramework::Plugin::LoadingState* loadingState = new WPEFramework::Plugin::LoadingState(ctx.get());
+    WPEFramework::Plugin::State* loadingState = WPEFramework::Plugin::State::getInstance(WPEFramework::Exchange::ILifecycleManager::LifecycleState::LOADING);
     ctx->setState(loadingState);
-    if (nullptr != oldState) {
-        delete static_cast<WPEFramework::Plugin::State*>(oldState);
-    }
 
     WPEFramework::Plugin::StateTransitionRequest req(ctx,
         WPEFramework::Exchange::ILifecycleManager::LifecycleState::ACTIVE);
@@ -1269,12 +1550,8 @@ uint32_t Test_StateHandler_ChangeStateLoadingToTerminatingPath()
 
     // Manually place context into LOADING state
     auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.loading.term");
-    void* oldState = ctx->getState();
-    auto* loadingState = new WPEFramework::Plugin::LoadingState(ctx.get());
+    WPEFramework::Plugin::State* loadingState = WPEFramework::Plugin::State::getInstance(WPEFramework::Exchange::ILifecycleManager::LifecycleState::LOADING);
     ctx->setState(loadingState);
-    if (oldState != nullptr) {
-        delete static_cast<WPEFramework::Plugin::State*>(oldState);
-    }
 
     L0Test::ExpectEqU32(tr,
         static_cast<uint32_t>(ctx->getCurrentLifecycleState()),
@@ -1301,6 +1578,538 @@ uint32_t Test_StateHandler_ChangeStateLoadingToTerminatingPath()
     return tr.failures;
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+// StateHandler transition table matches the former recursive path search and
+// resolves transitions faster. The former implementation is reproduced here:
+// a DFS over predecessor lists plus a heap allocated State per hop.
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace {
+    typedef WPEFramework::Exchange::ILifecycleManager::LifecycleState Lifecycle;
+    typedef std::map<Lifecycle, std::list<Lifecycle>> LegacyTransitionMap;
+
+    LegacyTransitionMap buildLegacyTransitions()
+    {
+        LegacyTransitionMap transitions;
+        transitions[Lifecycle::UNLOADED] = std::list<Lifecycle>();
+        transitions[Lifecycle::LOADING] = std::list<Lifecycle>(1, Lifecycle::UNLOADED);
+        transitions[Lifecycle::INITIALIZING] = std::list<Lifecycle>(1, Lifecycle::LOADING);
+        transitions[Lifecycle::PAUSED] = std::list<Lifecycle>{ Lifecycle::INITIALIZING, Lifecycle::ACTIVE, Lifecycle::SUSPENDED };
+        transitions[Lifecycle::ACTIVE] = std::list<Lifecycle>(1, Lifecycle::PAUSED);
+        transitions[Lifecycle::SUSPENDED] = std::list<Lifecycle>{ Lifecycle::INITIALIZING, Lifecycle::PAUSED, Lifecycle::HIBERNATED };
+        transitions[Lifecycle::HIBERNATED] = std::list<Lifecycle>(1, Lifecycle::SUSPENDED);
+        transitions[Lifecycle::TERMINATING] = std::list<Lifecycle>{ Lifecycle::PAUSED, Lifecycle::SUSPENDED };
+        return transitions;
+    }
+
+    bool legacyIsValidTransition(LegacyTransitionMap& transitions, Lifecycle start, Lifecycle target,
+                                 std::map<Lifecycle, bool>& pathSequence, std::vector<Lifecycle>& foundPath)
+    {
+        if (start == target) {
+            return true;
+        }
+        pathSequence[target] = true;
+        LegacyTransitionMap::iterator transitionIter = transitions.find(target);
+        if (transitionIter == transitions.end()) {
+            return false;
+        }
+        for (auto iter = transitionIter->second.begin(); iter != transitionIter->second.end(); ++iter) {
+            if (pathSequence.find(*iter) != pathSequence.end()) {
+                continue;
+            }
+            if (legacyIsValidTransition(transitions, start, *iter, pathSequence, foundPath)) {
+                foundPath.push_back(*iter);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool legacyGetStatePath(LegacyTransitionMap& transitions, Lifecycle start, Lifecycle target, std::vector<Lifecycle>& statePath)
+    {
+        std::map<Lifecycle, bool> seenPaths;
+        if (false == legacyIsValidTransition(transitions, start, target, seenPaths, statePath)) {
+            return false;
+        }
+        statePath.push_back(target);
+        return true;
+    }
+
+    WPEFramework::Plugin::State* legacyCreateState(Lifecycle state)
+    {
+        switch (state) {
+            case Lifecycle::UNLOADED:     return new WPEFramework::Plugin::UnloadedState();
+            case Lifecycle::LOADING:      return new WPEFramework::Plugin::LoadingState();
+            case Lifecycle::INITIALIZING: return new WPEFramework::Plugin::InitializingState();
+            case Lifecycle::PAUSED:       return new WPEFramework::Plugin::PausedState();
+            case Lifecycle::ACTIVE:       return new WPEFramework::Plugin::ActiveState();
+            case Lifecycle::SUSPENDED:    return new WPEFramework::Plugin::SuspendedState();
+            case Lifecycle::HIBERNATED:   return new WPEFramework::Plugin::HibernatedState();
+            case Lifecycle::TERMINATING:  return new WPEFramework::Plugin::TerminatingState();
+            default:                      return nullptr;
+        }
+    }
+} // namespace
+
+uint32_t Test_StateHandler_TransitionTableMatchesLegacySearchBenchmark()
+{
+    L0Test::TestResult tr;
+
+    LegacyTransitionMap transitions = buildLegacyTransitions();
+
+    for (uint32_t start = 0; start < LIFECYCLE_STATE_COUNT; start++) {
+        for (uint32_t target = 0; target < LIFECYCLE_STATE_COUNT; target++) {
+            std::vector<Lifecycle> legacyPath;
+            bool legacyValid = legacyGetStatePath(transitions, static_cast<Lifecycle>(start), static_cast<Lifecycle>(target), legacyPath);
+            const WPEFramework::Plugin::StatePath* tablePath =
+                WPEFramework::Plugin::StateHandler::getTransitionPath(static_cast<Lifecycle>(start), static_cast<Lifecycle>(target));
+            bool samePath = (legacyValid == (nullptr != tablePath));
+            if (samePath && (nullptr != tablePath)) {
+                samePath = (legacyPath == std::vector<Lifecycle>(tablePath->mStates, tablePath->mStates + tablePath->mLength));
+            }
+            L0Test::ExpectTrue(tr, samePath,
+                std::string("transition table path matches legacy search for ") +
+                WPEFramework::Plugin::StateHandler::getStateString(static_cast<Lifecycle>(start)) + " -> " +
+                WPEFramework::Plugin::StateHandler::getStateString(static_cast<Lifecycle>(target)));
+        }
+    }
+
+    const uint32_t rounds = 20000;
+    uint64_t legacyHops = 0;
+    auto legacyBegin = std::chrono::steady_clock::now();
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (uint32_t start = 0; start < LIFECYCLE_STATE_COUNT; start++) {
+            for (uint32_t target = 0; target < LIFECYCLE_STATE_COUNT; target++) {
+                std::vector<Lifecycle> statePath;
+                if (legacyGetStatePath(transitions, static_cast<Lifecycle>(start), static_cast<Lifecycle>(target), statePath)) {
+                    for (size_t index = 1; index < statePath.size(); index++) {
+                        WPEFramework::Plugin::State* state = legacyCreateState(statePath[index]);
+                        legacyHops += (nullptr != state) ? 1 : 0;
+                        delete state;
+                    }
+                }
+            }
+        }
+    }
+    std::chrono::duration<double> legacyElapsed = std::chrono::steady_clock::now() - legacyBegin;
+
+    uint64_t tableHops = 0;
+    auto tableBegin = std::chrono::steady_clock::now();
+    for (uint32_t round = 0; round < rounds; round++) {
+        for (uint32_t start = 0; start < LIFECYCLE_STATE_COUNT; start++) {
+            for (uint32_t target = 0; target < LIFECYCLE_STATE_COUNT; target++) {
+                const WPEFramework::Plugin::StatePath* statePath =
+                    WPEFramework::Plugin::StateHandler::getTransitionPath(static_cast<Lifecycle>(start), static_cast<Lifecycle>(target));
+                if (nullptr != statePath) {
+                    for (size_t index = 1; index < statePath->mLength; index++) {
+                        WPEFramework::Plugin::State* state = WPEFramework::Plugin::State::getInstance(statePath->mStates[index]);
+                        tableHops += (nullptr != state) ? 1 : 0;
+                    }
+                }
+            }
+        }
+    }
+    std::chrono::duration<double> tableElapsed = std::chrono::steady_clock::now() - tableBegin;
+
+    L0Test::ExpectTrue(tr, legacyHops == tableHops,
+        "legacy search and transition table visit the same number of states");
+
+    const uint64_t transitionCount = static_cast<uint64_t>(rounds) * LIFECYCLE_STATE_COUNT * LIFECYCLE_STATE_COUNT;
+    std::cout << "StateHandler benchmark: " << transitionCount << " transitions, legacy "
+              << static_cast<uint64_t>(transitionCount / std::max(legacyElapsed.count(), 1e-9)) << "/s, table "
+              << static_cast<uint64_t>(transitionCount / std::max(tableElapsed.count(), 1e-9)) << "/s\n";
+
+    return tr.failures;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// StateTransitionHandler keeps serving other contexts while one context's
+// transition is parked in the runtime, and runs that context's next request
+// only after the parked one returns
+// ─────────────────────────────────────────────────────────────────────────────
+
+uint32_t Test_StateTransitionHandler_SlowContextDoesNotBlockOthers()
+{
+    L0Test::TestResult tr;
+
+    using Lifecycle = WPEFramework::Exchange::ILifecycleManager::LifecycleState;
+
+    std::mutex lock;
+    std::condition_variable changed;
+    bool parked = false;
+    bool released = false;
+    std::vector<std::string> calls;
+
+    L0Test::FakeRuntimeManager rtm;
+    L0Test::FakeWindowManager wm;
+    rtm.SetCallHook([&](const std::string& method, const std::string& appInstanceId) {
+        std::unique_lock<std::mutex> guard(lock);
+        calls.push_back(method + ":" + appInstanceId);
+        if ((0 == method.compare("Hibernate")) && (0 == appInstanceId.compare("parked-instance"))) {
+            parked = true;
+            changed.notify_all();
+            changed.wait_for(guard, std::chrono::seconds(5), [&]() { return released; });
+        }
+    });
+
+    L0Test::LcmServiceMock mockService(L0Test::LcmServiceMock::Config(&rtm, &wm));
+    L0Test::ExpectTrue(tr, WPEFramework::Plugin::RequestHandler::getInstance()->initialize(&mockService, &gStubEventHandler, 2),
+        "RequestHandler::initialize with two transition workers succeeds");
+
+    WPEFramework::Plugin::StateTransitionHandler* handler = WPEFramework::Plugin::StateTransitionHandler::getInstance();
+    L0Test::ExpectEqU32(tr, handler->getWorkerCount(), 2u,
+        "worker pool uses the configured number of workers");
+
+    std::string parkedInstanceId("parked-instance");
+    std::string otherInstanceId("other-instance");
+    auto parkedCtx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.sth.parked");
+    auto otherCtx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.sth.other");
+    parkedCtx->setAppInstanceId(parkedInstanceId);
+    otherCtx->setAppInstanceId(otherInstanceId);
+    parkedCtx->setState(WPEFramework::Plugin::State::getInstance(Lifecycle::SUSPENDED));
+    otherCtx->setState(WPEFramework::Plugin::State::getInstance(Lifecycle::SUSPENDED));
+
+    WPEFramework::Plugin::StateTransitionRequest hibernateParked(parkedCtx, Lifecycle::HIBERNATED);
+    handler->addRequest(hibernateParked);
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        changed.wait_for(guard, std::chrono::seconds(2), [&]() { return parked; });
+    }
+    L0Test::ExpectTrue(tr, parked, "the first context is parked in IRuntimeManager::Hibernate");
+
+    // The wake request queues behind the parked hibernate of the same context,
+    // while the other context is picked up by the second worker.
+    WPEFramework::Plugin::StateTransitionRequest wakeParked(parkedCtx, Lifecycle::SUSPENDED);
+    handler->addRequest(wakeParked);
+    WPEFramework::Plugin::StateTransitionRequest hibernateOther(otherCtx, Lifecycle::HIBERNATED);
+    handler->addRequest(hibernateOther);
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while ((Lifecycle::HIBERNATED != otherCtx->getCurrentLifecycleState()) && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    L0Test::ExpectTrue(tr, Lifecycle::HIBERNATED == otherCtx->getCurrentLifecycleState(),
+        "another context reaches its target while the first one is parked");
+
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        L0Test::ExpectTrue(tr, calls.end() == std::find(calls.begin(), calls.end(), "Wake:parked-instance"),
+            "the parked context's next request does not start before the parked one returns");
+        released = true;
+        changed.notify_all();
+    }
+
+    deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    bool wokeUp = false;
+    while ((false == wokeUp) && (std::chrono::steady_clock::now() < deadline)) {
+        {
+            std::unique_lock<std::mutex> guard(lock);
+            wokeUp = (calls.end() != std::find(calls.begin(), calls.end(), "Wake:parked-instance"));
+        }
+        wokeUp = wokeUp && (Lifecycle::SUSPENDED == parkedCtx->getCurrentLifecycleState());
+        if (false == wokeUp) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    WPEFramework::Plugin::RequestHandler::getInstance()->terminate();
+
+    const std::vector<std::string> expected = { "Hibernate:parked-instance", "Hibernate:other-instance", "Wake:parked-instance" };
+    L0Test::ExpectTrue(tr, expected == calls,
+        "the parked context is hibernated and woken in request order, around the other context");
+    L0Test::ExpectTrue(tr, Lifecycle::SUSPENDED == parkedCtx->getCurrentLifecycleState(),
+        "the parked context ends in the state of its last request");
+    L0Test::ExpectEqU32(tr, handler->getWorkerCount(), 0u,
+        "worker pool is empty after terminate()");
+
+    return tr.failures;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// StateTransitionHandler coalesces requests that have not started yet
+// ─────────────────────────────────────────────────────────────────────────────
+
+uint32_t Test_StateTransitionHandler_CoalescesPendingRequests()
+{
+    L0Test::TestResult tr;
+
+    WPEFramework::Plugin::StateTransitionHandler* handler = WPEFramework::Plugin::StateTransitionHandler::getInstance();
+    L0Test::ExpectTrue(tr, handler->initialize(1),
+        "StateTransitionHandler::initialize(1) succeeds");
+
+    const uint64_t coalescedBefore = handler->getCoalescedRequestCount();
+    const uint64_t executedBefore = handler->getExecutedRequestCount();
+    const uint64_t droppedBefore = handler->getDroppedRequestCount();
+
+    std::vector<std::shared_ptr<WPEFramework::Plugin::ApplicationContext>> contexts;
+    for (int index = 0; index < 4; index++) {
+        contexts.push_back(std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.coalesce." + std::to_string(index)));
+    }
+
+    // Every request is executed, replaced by a newer one for the same context, or dropped
+    // behind a pending TERMINATING.
+    const uint64_t terminateRequests = 5;
+    for (auto& ctx : contexts) {
+        WPEFramework::Plugin::StateTransitionRequest loadRequest(ctx,
+            WPEFramework::Exchange::ILifecycleManager::LifecycleState::LOADING);
+        handler->addRequest(loadRequest);
+        for (uint64_t count = 0; count < terminateRequests; count++) {
+            WPEFramework::Plugin::StateTransitionRequest terminateRequest(ctx,
+                WPEFramework::Exchange::ILifecycleManager::LifecycleState::TERMINATING);
+            handler->addRequest(terminateRequest);
+        }
+    }
+    const uint64_t submitted = contexts.size() * (1 + terminateRequests);
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    uint64_t handled = 0;
+    while ((handled < submitted) && (std::chrono::steady_clock::now() < deadline)) {
+        handled = (handler->getCoalescedRequestCount() - coalescedBefore) + (handler->getExecutedRequestCount() - executedBefore) +
+                  (handler->getDroppedRequestCount() - droppedBefore);
+        if (handled < submitted) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    handler->terminate();
+
+    L0Test::ExpectTrue(tr, handled == submitted,
+        "executed, coalesced and dropped requests add up to the submitted requests");
+    L0Test::ExpectTrue(tr, (handler->getExecutedRequestCount() - executedBefore) >= (2 * contexts.size()),
+        "the first and the latest request of every context are executed");
+    for (auto& ctx : contexts) {
+        L0Test::ExpectTrue(tr, WPEFramework::Exchange::ILifecycleManager::LifecycleState::UNLOADED == ctx->getCurrentLifecycleState(),
+            "context ends in the latest requested state");
+    }
+
+    return tr.failures;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// StateTransitionHandler never lets a later request supersede a pending TERMINATING
+// ─────────────────────────────────────────────────────────────────────────────
+
+namespace {
+    // Holds the first state change event of one app until released, keeping its transition executing
+    struct GatedEventHandler final : public WPEFramework::Plugin::IEventHandler {
+        void onRuntimeManagerEvent(WPEFramework::Core::JSON::VariantContainer&) override {}
+        void onWindowManagerEvent(WPEFramework::Core::JSON::VariantContainer&) override {}
+        void onRippleEvent(std::string, WPEFramework::Core::JSON::VariantContainer&) override {}
+        void onStateChangeEvent(WPEFramework::Core::JSON::VariantContainer& data) override
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            if ((data["appId"].String() == mAppId) && (false == mEntered)) {
+                mEntered = true;
+                mCondition.notify_all();
+                mCondition.wait(lock, [this]() { return mReleased; });
+            }
+        }
+        bool waitEntered()
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            return mCondition.wait_for(lock, std::chrono::seconds(2), [this]() { return mEntered; });
+        }
+        void release()
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mReleased = true;
+            mCondition.notify_all();
+        }
+        std::string mAppId;
+        std::mutex mMutex;
+        std::condition_variable mCondition;
+        bool mEntered = false;
+        bool mReleased = false;
+    };
+    static GatedEventHandler gGatedEventHandler;
+} // namespace
+
+uint32_t Test_StateTransitionHandler_KeepsPendingTermination()
+{
+    L0Test::TestResult tr;
+
+    gGatedEventHandler.mAppId = "com.test.terminate.kept";
+    L0Test::LcmServiceMock mockService(L0Test::LcmServiceMock::Config(&gCtxTestRtm, &gCtxTestWm));
+    WPEFramework::Plugin::RequestHandler::getInstance()->initialize(&mockService, &gGatedEventHandler);
+    WPEFramework::Plugin::RequestHandler::getInstance()->terminate();
+
+    WPEFramework::Plugin::StateTransitionHandler* handler = WPEFramework::Plugin::StateTransitionHandler::getInstance();
+    L0Test::ExpectTrue(tr, handler->initialize(1),
+        "StateTransitionHandler::initialize(1) succeeds");
+
+    const uint64_t coalescedBefore = handler->getCoalescedRequestCount();
+    const uint64_t executedBefore = handler->getExecutedRequestCount();
+    const uint64_t droppedBefore = handler->getDroppedRequestCount();
+
+    auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>(gGatedEventHandler.mAppId);
+    WPEFramework::Plugin::StateTransitionRequest loadRequest(ctx,
+        WPEFramework::Exchange::ILifecycleManager::LifecycleState::LOADING);
+    handler->addRequest(loadRequest);
+    L0Test::ExpectTrue(tr, gGatedEventHandler.waitEntered(),
+        "LOADING transition is held executing");
+
+    // TERMINATING becomes the pending request; the later requests must not replace it
+    WPEFramework::Plugin::StateTransitionRequest terminateRequest(ctx,
+        WPEFramework::Exchange::ILifecycleManager::LifecycleState::TERMINATING);
+    handler->addRequest(terminateRequest);
+    const uint64_t laterRequests = 3;
+    for (uint64_t count = 0; count < laterRequests; count++) {
+        WPEFramework::Plugin::StateTransitionRequest activeRequest(ctx,
+            WPEFramework::Exchange::ILifecycleManager::LifecycleState::ACTIVE);
+        handler->addRequest(activeRequest);
+    }
+
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (((handler->getDroppedRequestCount() - droppedBefore) < laterRequests) && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    gGatedEventHandler.release();
+
+    deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while (((handler->getExecutedRequestCount() - executedBefore) < 2) && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    handler->terminate();
+    WPEFramework::Plugin::RequestHandler::getInstance()->initialize(&mockService, &gStubEventHandler);
+    WPEFramework::Plugin::RequestHandler::getInstance()->terminate();
+
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(handler->getDroppedRequestCount() - droppedBefore), static_cast<uint32_t>(laterRequests),
+        "requests after a pending TERMINATING are dropped");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(handler->getCoalescedRequestCount() - coalescedBefore), 0u,
+        "the pending TERMINATING is not counted as coalesced");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(handler->getExecutedRequestCount() - executedBefore), 2u,
+        "LOADING and TERMINATING are executed");
+    L0Test::ExpectTrue(tr, WPEFramework::Exchange::ILifecycleManager::LifecycleState::UNLOADED == ctx->getCurrentLifecycleState(),
+        "app is torn down");
+
+    return tr.failures;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// StateTransitionHandler queues requests in the lane of their priority
+// ─────────────────────────────────────────────────────────────────────────────
+
+uint32_t Test_StateTransitionHandler_ReportsPriorityLaneStats()
+{
+    L0Test::TestResult tr;
+
+    WPEFramework::Plugin::StateTransitionHandler* handler = WPEFramework::Plugin::StateTransitionHandler::getInstance();
+    L0Test::ExpectTrue(tr, handler->initialize(1),
+        "StateTransitionHandler::initialize(1) succeeds");
+    handler->resetLaneStats();
+
+    const WPEFramework::Plugin::TransitionPriority priorities[] = {
+        WPEFramework::Plugin::TRANSITION_PRIORITY_BACKGROUND,
+        WPEFramework::Plugin::TRANSITION_PRIORITY_BACKGROUND,
+        WPEFramework::Plugin::TRANSITION_PRIORITY_NORMAL,
+        WPEFramework::Plugin::TRANSITION_PRIORITY_FOREGROUND };
+    std::vector<std::shared_ptr<WPEFramework::Plugin::ApplicationContext>> contexts;
+    for (size_t index = 0; index < (sizeof(priorities) / sizeof(priorities[0])); index++) {
+        contexts.push_back(std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.lane." + std::to_string(index)));
+        WPEFramework::Plugin::StateTransitionRequest request(contexts.back(),
+            WPEFramework::Exchange::ILifecycleManager::LifecycleState::LOADING, priorities[index]);
+        handler->addRequest(request);
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    uint64_t dequeued = 0;
+    while ((dequeued < contexts.size()) && (std::chrono::steady_clock::now() < deadline)) {
+        dequeued = 0;
+        for (uint32_t priority = 0; priority < WPEFramework::Plugin::TRANSITION_PRIORITY_COUNT; priority++) {
+            dequeued += handler->getLaneStats(static_cast<WPEFramework::Plugin::TransitionPriority>(priority)).mDequeued;
+        }
+        if (dequeued < contexts.size()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    }
+
+    const WPEFramework::Plugin::TransitionLaneStats foreground = handler->getLaneStats(WPEFramework::Plugin::TRANSITION_PRIORITY_FOREGROUND);
+    const WPEFramework::Plugin::TransitionLaneStats normal = handler->getLaneStats(WPEFramework::Plugin::TRANSITION_PRIORITY_NORMAL);
+    const WPEFramework::Plugin::TransitionLaneStats background = handler->getLaneStats(WPEFramework::Plugin::TRANSITION_PRIORITY_BACKGROUND);
+    handler->terminate();
+
+    L0Test::ExpectTrue(tr, foreground.mDequeued == 1u, "one request went through the foreground lane");
+    L0Test::ExpectTrue(tr, normal.mDequeued == 1u, "one request went through the normal lane");
+    L0Test::ExpectTrue(tr, background.mDequeued == 2u, "two requests went through the background lane");
+    L0Test::ExpectEqU32(tr, foreground.mDepth + normal.mDepth + background.mDepth, 0u,
+        "every lane is drained");
+    L0Test::ExpectTrue(tr, background.mMaxWaitMs < TRANSITION_STARVATION_LIMIT_MS,
+        "background requests are not left waiting past the starvation limit");
+    for (auto& ctx : contexts) {
+        L0Test::ExpectTrue(tr, WPEFramework::Exchange::ILifecycleManager::LifecycleState::LOADING == ctx->getCurrentLifecycleState(),
+            "context reached LOADING whatever its lane");
+    }
+
+    return tr.failures;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Every hop taken by StateHandler lands in the per-pair and per-app histograms
+// ─────────────────────────────────────────────────────────────────────────────
+
+uint32_t Test_TelemetryReporting_RecordsTransitionLatencyHistograms()
+{
+    L0Test::TestResult tr;
+    typedef WPEFramework::Exchange::ILifecycleManager::LifecycleState LifecycleState;
+
+    WPEFramework::Plugin::LifecycleManagerTelemetryReporting& reporting =
+        WPEFramework::Plugin::LifecycleManagerTelemetryReporting::getInstance();
+    reporting.resetTransitionLatencies();
+
+    auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.latency");
+    WPEFramework::Plugin::StateTransitionRequest req(ctx, LifecycleState::LOADING);
+    std::string error;
+    L0Test::ExpectTrue(tr, WPEFramework::Plugin::StateHandler::changeState(req, error),
+        "UNLOADED->LOADING transition returns true");
+
+    JsonObject latencies;
+    reporting.getTransitionLatencies("com.test.latency", latencies);
+    JsonArray apps = latencies["apps"].Array();
+    L0Test::ExpectEqU32(tr, apps.Length(), 1u, "appId filter returns only the requested app");
+    if (1 == apps.Length()) {
+        JsonArray transitions = apps[0].Object()["transitions"].Array();
+        L0Test::ExpectEqU32(tr, transitions.Length(), 1u, "one hop recorded for the app");
+        if (1 == transitions.Length()) {
+            JsonObject hop = transitions[0].Object();
+            L0Test::ExpectEqU32(tr, static_cast<uint32_t>(hop["oldLifecycleState"].Number()),
+                static_cast<uint32_t>(LifecycleState::UNLOADED), "hop starts at UNLOADED");
+            L0Test::ExpectEqU32(tr, static_cast<uint32_t>(hop["newLifecycleState"].Number()),
+                static_cast<uint32_t>(LifecycleState::LOADING), "hop ends at LOADING");
+            L0Test::ExpectEqU32(tr, static_cast<uint32_t>(hop["count"].Number()), 1u, "hop counted once");
+        }
+    }
+
+    reporting.recordTransitionLatency("com.test.latency.resume", LifecycleState::PAUSED, LifecycleState::ACTIVE, 5);
+    reporting.recordTransitionLatency("com.test.latency.resume", LifecycleState::PAUSED, LifecycleState::ACTIVE, 300);
+    reporting.recordTransitionLatency("com.test.latency.resume", LifecycleState::PAUSED, LifecycleState::ACTIVE, 60000);
+    latencies.Clear();
+    reporting.getTransitionLatencies("com.test.latency.resume", latencies);
+    JsonArray bounds = latencies["bucketBoundsMs"].Array();
+    apps = latencies["apps"].Array();
+    if (1 == apps.Length()) {
+        JsonObject hop = apps[0].Object()["transitions"].Array()[0].Object();
+        JsonArray buckets = hop["buckets"].Array();
+        L0Test::ExpectEqU32(tr, buckets.Length(), bounds.Length() + 1u, "one overflow bucket after the last bound");
+        L0Test::ExpectEqU32(tr, static_cast<uint32_t>(buckets[0].Number()), 1u, "5 ms lands in the first bucket");
+        L0Test::ExpectEqU32(tr, static_cast<uint32_t>(buckets[buckets.Length() - 1].Number()), 1u,
+            "60 s lands in the overflow bucket");
+        L0Test::ExpectEqU32(tr, static_cast<uint32_t>(hop["maxMs"].Number()), 60000u, "max latency kept");
+        L0Test::ExpectEqU32(tr, static_cast<uint32_t>(hop["totalMs"].Number()), 60305u, "total latency kept");
+    } else {
+        L0Test::ExpectTrue(tr, false, "resume histogram present for the app");
+    }
+
+    reporting.resetTransitionLatencies();
+    latencies.Clear();
+    reporting.getTransitionLatencies("", latencies);
+    L0Test::ExpectEqU32(tr, latencies["transitions"].Array().Length(), 0u, "reset clears the per-pair histograms");
+    L0Test::ExpectEqU32(tr, latencies["apps"].Array().Length(), 0u, "reset clears the per-app histograms");
+
+    return tr.failures;
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // TelemetryMetricsClient::isAvailable() returns true without the compile flag
 // ─────────────────────────────────────────────────────────────────────────────
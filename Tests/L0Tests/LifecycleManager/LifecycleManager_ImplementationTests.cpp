@@ -41,6 +41,7 @@
 #include <list>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include "LifecycleManagerImplementation.h"
 #include "ApplicationContext.h"
@@ -79,7 +80,7 @@ public:
         return impl.mLifecycleManagerStateNotification;
     }
 
-    static std::list<std::shared_ptr<ApplicationContext>>&
+    static ApplicationRegistry&
     getLoadedApps(LifecycleManagerImplementation& impl)
     {
         return impl.mLoadedApplications;
@@ -107,6 +108,14 @@ public:
     {
         impl.Dispatch(event, params);
     }
+
+    static void callHandlePendingEventTimeout(
+        LifecycleManagerImplementation& impl,
+        const std::string& appInstanceId,
+        const std::string& eventName)
+    {
+        impl.handlePendingEventTimeout(appInstanceId, eventName);
+    }
 };
 
 /**
@@ -126,7 +135,8 @@ public:
 class RespawnTrackingLifecycleManagerImpl : public LifecycleManagerImplementation {
 public:
     int killCallCount = 0;
-    int spawnCallCount = 0;
+    // Respawns run on the respawn governor thread
+    std::atomic<int> spawnCallCount{0};
     std::string killedAppInstanceId;
     std::string spawnedAppId;
     Exchange::ILifecycleManager::LifecycleState spawnedTargetState =
@@ -153,17 +163,29 @@ public:
                            std::string& errorReason,
                            bool& success) override
     {
-        ++spawnCallCount;
         spawnedAppId = appId;
         spawnedTargetState = targetLifecycleState;
         appInstanceId = "respawned-instance";
         errorReason.clear();
         success = true;
+        ++spawnCallCount;
         static_cast<void>(launchIntent);
         static_cast<void>(runtimeConfigObject);
         static_cast<void>(launchArgs);
         return Core::ERROR_NONE;
     }
+
+    Core::hresult SpawnAppAsync(const std::string& appId,
+                                const std::string& launchIntent,
+                                const Exchange::ILifecycleManager::LifecycleState targetLifecycleState,
+                                const WPEFramework::Exchange::RuntimeConfig& runtimeConfigObject,
+                                const std::string& launchArgs,
+                                std::string& appInstanceId,
+                                std::string& errorReason,
+                                bool& success) override
+    {
+        return SpawnApp(appId, launchIntent, targetLifecycleState, runtimeConfigObject, launchArgs, appInstanceId, errorReason, success);
+    }
 };
 } // namespace Plugin
 } // namespace WPEFramework
@@ -430,8 +452,8 @@ uint32_t Test_Impl_GetLoadedAppsWithApps()
     std::string id2 = "inst-002";
     ctx1->setAppInstanceId(id1);
     ctx2->setAppInstanceId(id2);
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx1);
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx2);
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx1);
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx2);
 
     std::string apps;
     WPEFramework::Core::hresult result = impl.GetLoadedApps(false, apps);
@@ -461,7 +483,7 @@ uint32_t Test_Impl_GetLoadedAppsNonVerboseOmitsRuntimeStats()
     auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.verbose");
     std::string instId = "inst-verbose-001";
     ctx->setAppInstanceId(instId);
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx);
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
 
     std::string apps;
     impl.GetLoadedApps(false, apps);
@@ -486,7 +508,7 @@ uint32_t Test_Impl_IsAppLoadedTrue()
     auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.loaded");
     std::string inst = "inst-loaded-001";
     ctx->setAppInstanceId(inst);
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx);
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
 
     bool loaded = false;
     WPEFramework::Core::hresult result = impl.IsAppLoaded("com.test.loaded", loaded);
@@ -555,7 +577,7 @@ uint32_t Test_Impl_SendIntentToActiveAppNonActive()
     auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.paused");
     std::string inst = "inst-paused-001";
     ctx->setAppInstanceId(inst);
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx);
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
 
     std::string errorReason;
     bool success = true;
@@ -604,7 +626,7 @@ uint32_t Test_Impl_AppReadyKnownAppId()
     auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.ready");
     std::string inst = "inst-ready-001";
     ctx->setAppInstanceId(inst);
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx);
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
 
     WPEFramework::Core::hresult result = impl.AppReady("com.test.ready");
     L0Test::ExpectEqU32(tr, result, WPEFramework::Core::ERROR_NONE,
@@ -868,7 +890,7 @@ uint32_t Test_Impl_GetContextByAppInstanceId()
     auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.ctx");
     std::string inst = "inst-ctx-001";
     ctx->setAppInstanceId(inst);
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx);
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
 
     // IsAppLoaded uses getContext("", appId); verify via appId lookup
     bool loaded = false;
@@ -1070,7 +1092,7 @@ uint32_t Test_Impl_GetLoadedAppsVerboseNoRuntimeHandler()
     auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.verbose");
     std::string inst = "inst-verbose-001";
     ctx->setAppInstanceId(inst);
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx);
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
 
     std::string apps;
     WPEFramework::Core::hresult result = impl.GetLoadedApps(true, apps);
@@ -1101,9 +1123,8 @@ uint32_t Test_Impl_SendIntentToActiveAppActiveApp()
     std::string inst = "inst-active-001";
     ctx->setAppInstanceId(inst);
     // Transition the context to ACTIVE by installing an ActiveState.
-    delete static_cast<WPEFramework::Plugin::State*>(ctx->getState());
-    ctx->setState(new WPEFramework::Plugin::ActiveState(ctx.get()));
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx);
+    ctx->setState(WPEFramework::Plugin::State::getInstance(WPEFramework::Exchange::ILifecycleManager::LifecycleState::ACTIVE));
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
 
     std::string errorReason;
     bool success = false;
@@ -1140,7 +1161,7 @@ uint32_t Test_Impl_DispatchAppStateChangedUnloadedRemovesApp()
     auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.unload");
     std::string inst = "inst-unload-001";
     ctx->setAppInstanceId(inst);
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx);
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
 
     L0Test::ExpectEqU32(tr,
         static_cast<uint32_t>(LifecycleManagerImplementationTest::getLoadedApps(impl).size()),
@@ -1190,7 +1211,7 @@ uint32_t Test_Impl_CloseAppKillAndRunDefersRespawnUntilUnloaded()
                                     launchArgs,
                                     WPEFramework::Exchange::ILifecycleManager::LifecycleState::ACTIVE,
                                     runtimeConfigObject);
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx);
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
 
     WPEFramework::Core::hresult result = impl.CloseApp(
         appId,
@@ -1228,10 +1249,16 @@ uint32_t Test_Impl_CloseAppKillAndRunDefersRespawnUntilUnloaded()
         LifecycleManagerImplementationTest::EventNames::LIFECYCLE_MANAGER_EVENT_APPSTATECHANGED,
         params);
 
+    // Without recent crashes the respawn is scheduled with no delay
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+    while ((0 == impl.spawnCallCount.load()) && (std::chrono::steady_clock::now() < deadline)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
     L0Test::ExpectTrue(tr,
         LifecycleManagerImplementationTest::getLoadedApps(impl).empty(),
         "old app context is removed after the UNLOADED event");
-    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(impl.spawnCallCount), 1u,
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(impl.spawnCallCount.load()), 1u,
         "SpawnApp is triggered after the UNLOADED event");
     L0Test::ExpectTrue(tr, impl.spawnedAppId == appId,
         "respawn uses the original appId");
@@ -1246,6 +1273,51 @@ uint32_t Test_Impl_CloseAppKillAndRunDefersRespawnUntilUnloaded()
 
     return tr.failures;
 }
+// ─────────────────────────────────────────────────────────────────────────────
+// SpawnAppAsync registers the app with an appInstanceId generated up front
+// The StateTransitionHandler is not running, so the launch stays queued and
+// the call must still return without waiting for LOADING.
+// ─────────────────────────────────────────────────────────────────────────────
+uint32_t Test_Impl_SpawnAppAsyncReturnsGeneratedInstanceId()
+{
+    L0Test::TestResult tr;
+
+    ConcreteLifecycleManagerImpl impl;
+    WPEFramework::Exchange::RuntimeConfig runtimeConfigObject;
+    std::string appInstanceId;
+    std::string errorReason;
+    bool success = false;
+
+    WPEFramework::Core::hresult result = impl.SpawnAppAsync("com.test.spawn.async",
+        "",
+        WPEFramework::Exchange::ILifecycleManager::LifecycleState::ACTIVE,
+        runtimeConfigObject,
+        "",
+        appInstanceId,
+        errorReason,
+        success);
+
+    L0Test::ExpectEqU32(tr, result, WPEFramework::Core::ERROR_NONE,
+        "SpawnAppAsync returns ERROR_NONE");
+    L0Test::ExpectTrue(tr, success,
+        "SpawnAppAsync reports success");
+    L0Test::ExpectTrue(tr, !appInstanceId.empty(),
+        "appInstanceId is generated before the app reaches LOADING");
+
+    bool loaded = false;
+    impl.IsAppLoaded("com.test.spawn.async", loaded);
+    L0Test::ExpectTrue(tr, loaded,
+        "IsAppLoaded reports the app right after SpawnAppAsync");
+
+    std::vector<std::shared_ptr<WPEFramework::Plugin::ApplicationContext>> applications =
+        LifecycleManagerImplementationTest::getLoadedApps(impl).getApplications();
+    L0Test::ExpectTrue(tr, (1 == applications.size()) && (applications[0]->getAppInstanceId() == appInstanceId),
+        "registered context carries the returned appInstanceId");
+
+    LifecycleManagerImplementationTest::getLoadedApps(impl).clear();
+    return tr.failures;
+}
+
 // ─────────────────────────────────────────────────────────────────────────────
 // handleRuntimeManagerEvent "onTerminated" — unknown appInstanceId
 // callDispatch(RUNTIME) reaches handleRuntimeManagerEvent synchronously.
@@ -1300,12 +1372,10 @@ uint32_t Test_Impl_RuntimeEventOnTerminatedAppInTerminatingState()
     std::string inst = "inst-terminating-001";
     ctx->setAppInstanceId(inst);
     // Put context into TERMINATING state via TerminatingState
-    delete static_cast<WPEFramework::Plugin::State*>(ctx->getState());
-    ctx->setState(
-        new WPEFramework::Plugin::TerminatingState(ctx.get()));
+    ctx->setState(WPEFramework::Plugin::State::getInstance(WPEFramework::Exchange::ILifecycleManager::LifecycleState::TERMINATING));
     ctx->mPendingStateTransition = false;
     ctx->mPendingEventName       = "";
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx);
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
 
     WPEFramework::Core::JSON::VariantContainer params;
     params["name"]             = std::string("onTerminated");
@@ -1355,10 +1425,8 @@ uint32_t Test_Impl_RuntimeEventOnTerminatedUnexpected()
     std::string inst = "inst-unexpected-001";
     ctx->setAppInstanceId(inst);
     // ACTIVE state → not TERMINATING → triggers unexpected-termination branch
-    delete static_cast<WPEFramework::Plugin::State*>(ctx->getState());
-    ctx->setState(
-        new WPEFramework::Plugin::ActiveState(ctx.get()));
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx);
+    ctx->setState(WPEFramework::Plugin::State::getInstance(WPEFramework::Exchange::ILifecycleManager::LifecycleState::ACTIVE));
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
 
     WPEFramework::Core::JSON::VariantContainer params;
     params["name"]             = std::string("onTerminated");
@@ -1447,7 +1515,7 @@ uint32_t Test_Impl_RuntimeEventOnStateChangedRunningKnownApp()
     ctx->setAppInstanceId(inst);
     ctx->mPendingStateTransition = false;
     ctx->mPendingEventName       = "";
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx);
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
 
     WPEFramework::Core::JSON::VariantContainer params;
     params["name"]             = std::string("onStateChanged");
@@ -1545,7 +1613,7 @@ uint32_t Test_Impl_NotifyOnFailureKnownApp()
     auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.failapp");
     std::string inst = "inst-failapp-001";
     ctx->setAppInstanceId(inst);
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx);
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
 
     L0Test::FakeLcmNotification* notif = new L0Test::FakeLcmNotification();
     impl.Register(
@@ -1741,7 +1809,7 @@ uint32_t Test_Impl_WindowEventOnReadyKnownAppWrongTransition()
     ctx->setAppInstanceId(inst);
     ctx->mPendingStateTransition = false;  // triggers else path in addStateTransitionRequest
     ctx->mPendingEventName       = "";
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx);
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
 
     WPEFramework::Core::JSON::VariantContainer params;
     params["name"]             = std::string("onReady");
@@ -1789,7 +1857,7 @@ uint32_t Test_Impl_RuntimeEventOnStateChangedMatchingPendingTransition()
     ctx->setAppInstanceId(inst);
     ctx->mPendingStateTransition = true;
     ctx->mPendingEventName       = "onAppRunning";  // matches the event passed
-    LifecycleManagerImplementationTest::getLoadedApps(impl).push_back(ctx);
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
 
     WPEFramework::Core::JSON::VariantContainer params;
     params["name"]             = std::string("onStateChanged");
@@ -1822,3 +1890,166 @@ uint32_t Test_Impl_RuntimeEventOnStateChangedMatchingPendingTransition()
     return tr.failures;
 }
 
+// ─────────────────────────────────────────────────────────────────────────────
+// SetTargetAppStates validates the whole batch up front and reports one
+// completion once every app reached its target
+// ─────────────────────────────────────────────────────────────────────────────
+uint32_t Test_Impl_SetTargetAppStatesReportsBatchCompletion()
+{
+    L0Test::TestResult tr;
+    typedef WPEFramework::Exchange::ILifecycleManager::LifecycleState LifecycleState;
+    typedef WPEFramework::Plugin::LifecycleManagerImplementation::TargetAppState TargetAppState;
+
+    ConcreteLifecycleManagerImpl impl;
+    const char* instances[] = { "inst-batch-a", "inst-batch-b" };
+    for (const char* instance : instances) {
+        auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>(std::string("com.test.") + instance);
+        std::string inst = instance;
+        ctx->setAppInstanceId(inst);
+        ctx->setState(WPEFramework::Plugin::State::getInstance(LifecycleState::PAUSED));
+        LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
+    }
+
+    uint32_t completions = 0;
+    uint32_t completedBatchId = 0;
+    JsonArray completedResults;
+    auto completion = [&](uint32_t batchId, const JsonArray& results) {
+        completions++;
+        completedBatchId = batchId;
+        completedResults = results;
+    };
+
+    std::vector<TargetAppState> targetAppStates(2);
+    targetAppStates[0].mAppInstanceId = "inst-batch-a";
+    targetAppStates[0].mTargetLifecycleState = LifecycleState::SUSPENDED;
+    targetAppStates[1].mAppInstanceId = "inst-batch-a";
+    targetAppStates[1].mTargetLifecycleState = LifecycleState::PAUSED;
+    uint32_t batchId = 0;
+    std::string errorReason;
+    L0Test::ExpectEqU32(tr, impl.SetTargetAppStates(targetAppStates, completion, batchId, errorReason),
+        WPEFramework::Core::ERROR_GENERAL, "duplicate appInstanceId rejects the batch");
+
+    targetAppStates[1].mAppInstanceId = "inst-batch-unknown";
+    errorReason.clear();
+    L0Test::ExpectEqU32(tr, impl.SetTargetAppStates(targetAppStates, completion, batchId, errorReason),
+        WPEFramework::Core::ERROR_GENERAL, "unknown appInstanceId rejects the batch");
+    auto first = LifecycleManagerImplementationTest::getLoadedApps(impl).findByAppInstanceId("inst-batch-a");
+    L0Test::ExpectTrue(tr, (nullptr != first) && (LifecycleState::SUSPENDED != first->getTargetLifecycleState()),
+        "rejected batch does not retarget any app");
+
+    targetAppStates[1].mAppInstanceId = "inst-batch-b";
+    errorReason.clear();
+    L0Test::ExpectEqU32(tr, impl.SetTargetAppStates(targetAppStates, completion, batchId, errorReason),
+        WPEFramework::Core::ERROR_NONE, "valid batch is accepted");
+    L0Test::ExpectTrue(tr, 0 != batchId, "accepted batch gets an id");
+    L0Test::ExpectEqU32(tr, completions, 0u, "batch stays open while an app is still moving");
+
+    WPEFramework::Core::JSON::VariantContainer params;
+    params["appId"]             = std::string("com.test.inst-batch-a");
+    params["appInstanceId"]     = std::string("inst-batch-a");
+    params["oldLifecycleState"] = static_cast<uint32_t>(LifecycleState::PAUSED);
+    params["newLifecycleState"] = static_cast<uint32_t>(LifecycleState::SUSPENDED);
+    params["navigationIntent"]  = std::string("");
+    params["errorReason"]       = std::string("");
+    LifecycleManagerImplementationTest::callDispatch(
+        impl,
+        LifecycleManagerImplementationTest::EventNames::LIFECYCLE_MANAGER_EVENT_APPSTATECHANGED,
+        params);
+
+    L0Test::ExpectEqU32(tr, completions, 1u, "one completion for the whole batch");
+    L0Test::ExpectEqU32(tr, completedBatchId, batchId, "completion carries the batch id");
+    L0Test::ExpectEqU32(tr, completedResults.Length(), 2u, "completion carries a result per app");
+    for (uint16_t index = 0; index < completedResults.Length(); index++) {
+        L0Test::ExpectTrue(tr, completedResults[index].Object()["success"].Boolean(),
+            "every app reached its target");
+    }
+
+    return tr.failures;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// SetTargetAppStates is reachable through QueryInterface and a batch whose app
+// never reports its new state completes once its deadline passes
+// ─────────────────────────────────────────────────────────────────────────────
+uint32_t Test_Impl_SetTargetAppStatesTimesOut()
+{
+    L0Test::TestResult tr;
+    typedef WPEFramework::Exchange::ILifecycleManager::LifecycleState LifecycleState;
+
+    ConcreteLifecycleManagerImpl impl;
+    WPEFramework::Plugin::ILifecycleManagerLocal* local =
+        static_cast<WPEFramework::Plugin::ILifecycleManagerLocal*>(impl.QueryInterface(WPEFramework::Plugin::ILifecycleManagerLocal::ID));
+    L0Test::ExpectTrue(tr, nullptr != local, "in process implementation exposes ILifecycleManagerLocal");
+    if (nullptr == local) {
+        return tr.failures;
+    }
+
+    auto ctx = std::make_shared<WPEFramework::Plugin::ApplicationContext>("com.test.inst-batch-stuck");
+    std::string inst = "inst-batch-stuck";
+    ctx->setAppInstanceId(inst);
+    ctx->setState(WPEFramework::Plugin::State::getInstance(LifecycleState::PAUSED));
+    LifecycleManagerImplementationTest::getLoadedApps(impl).add(ctx);
+
+    uint32_t completions = 0;
+    JsonArray completedResults;
+    auto completion = [&](uint32_t, const JsonArray& results) {
+        completions++;
+        completedResults = results;
+    };
+
+    std::vector<WPEFramework::Plugin::ILifecycleManagerLocal::TargetAppState> targetAppStates(1);
+    targetAppStates[0].mAppInstanceId = inst;
+    targetAppStates[0].mTargetLifecycleState = LifecycleState::SUSPENDED;
+    uint32_t batchId = 0;
+    std::string errorReason;
+    L0Test::ExpectEqU32(tr, local->SetTargetAppStates(targetAppStates, completion, batchId, errorReason),
+        WPEFramework::Core::ERROR_NONE, "batch is accepted through the interface");
+    L0Test::ExpectEqU32(tr, completions, 0u, "batch stays open while the app is moving");
+
+    LifecycleManagerImplementationTest::callHandlePendingEventTimeout(impl, "batch-0", TARGET_APP_STATES_DEADLINE);
+    L0Test::ExpectEqU32(tr, completions, 0u, "deadline of another batch is ignored");
+
+    LifecycleManagerImplementationTest::callHandlePendingEventTimeout(impl, "batch-" + std::to_string(batchId), TARGET_APP_STATES_DEADLINE);
+    L0Test::ExpectEqU32(tr, completions, 1u, "expired batch completes once");
+    L0Test::ExpectEqU32(tr, completedResults.Length(), 1u, "expired batch reports the stuck app");
+    if (1 == completedResults.Length()) {
+        L0Test::ExpectTrue(tr, !completedResults[0].Object()["success"].Boolean(), "stuck app is reported as failed");
+        L0Test::ExpectEqStr(tr, completedResults[0].Object()["errorReason"].String(), "Timed out",
+            "stuck app is reported as timed out");
+    }
+
+    LifecycleManagerImplementationTest::callHandlePendingEventTimeout(impl, "batch-" + std::to_string(batchId), TARGET_APP_STATES_DEADLINE);
+    L0Test::ExpectEqU32(tr, completions, 1u, "second expiry of the same batch is ignored");
+
+    local->Release();
+    LifecycleManagerImplementationTest::getLoadedApps(impl).clear();
+    return tr.failures;
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+// Transition latencies are served by the implementation through
+// ILifecycleManagerLocal, together with the scheduler lane stats
+// ─────────────────────────────────────────────────────────────────────────────
+uint32_t Test_Impl_GetTransitionLatenciesThroughLocalInterface()
+{
+    L0Test::TestResult tr;
+
+    ConcreteLifecycleManagerImpl impl;
+    WPEFramework::Plugin::ILifecycleManagerLocal* local =
+        static_cast<WPEFramework::Plugin::ILifecycleManagerLocal*>(impl.QueryInterface(WPEFramework::Plugin::ILifecycleManagerLocal::ID));
+    L0Test::ExpectTrue(tr, nullptr != local, "in process implementation exposes ILifecycleManagerLocal");
+    if (nullptr == local) {
+        return tr.failures;
+    }
+
+    L0Test::ExpectEqU32(tr, local->ResetTransitionLatencies(), WPEFramework::Core::ERROR_NONE, "latencies are reset");
+    JsonObject latencies;
+    L0Test::ExpectEqU32(tr, local->GetTransitionLatencies("", latencies), WPEFramework::Core::ERROR_NONE, "latencies are returned");
+    L0Test::ExpectTrue(tr, latencies.HasLabel("lanes"), "response carries the lane stats");
+    L0Test::ExpectEqU32(tr, latencies["lanes"].Array().Length(), static_cast<uint32_t>(WPEFramework::Plugin::TRANSITION_PRIORITY_COUNT),
+        "one entry per transition lane");
+
+    local->Release();
+    return tr.failures;
+}
+
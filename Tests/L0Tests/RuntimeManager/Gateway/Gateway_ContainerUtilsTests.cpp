@@ -23,12 +23,19 @@
  * L0 tests for RuntimeManager/Gateway/ContainerUtils:
  *   - ContainerUtils::getContainerIpAddress() with an unknown/non-existent container
  *   - ContainerUtils::Namespace enum values are accessible
+ *   - ContainerUtils::trackContainer() / untrackContainer() with an unknown container
+ *   - ContainerUtils::trackContainer() on a real child process that then exits
  */
 
 #include <cstdint>
+#include <fstream>
 #include <iostream>
 #include <string>
 #include <netinet/in.h>
+#include <signal.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
 #include "Gateway/ContainerUtils.h"
 #include "common/L0Expect.hpp"
@@ -142,3 +149,98 @@ uint32_t Test_ContainerUtils_GetContainerIpAddress_VeryLongContainerIdDoesNotCra
 
     return tr.failures;
 }
+
+/* Test_ContainerUtils_TrackContainer_UnknownContainerReturnsFalse
+ *
+ * Verifies that trackContainer() returns false when there is no cgroup for the
+ * container ID, and that lookups for it still fail afterwards.
+ */
+uint32_t Test_ContainerUtils_TrackContainer_UnknownContainerReturnsFalse()
+{
+    L0Test::TestResult tr;
+
+    const std::string fakeId = "l0test_fake_tracked_container";
+    L0Test::ExpectTrue(tr, !WPEFramework::Plugin::ContainerUtils::trackContainer(fakeId),
+                       "trackContainer() returns false for unknown container");
+    L0Test::ExpectTrue(tr, !WPEFramework::Plugin::ContainerUtils::trackContainer(""),
+                       "trackContainer() returns false for empty container ID");
+
+    const in_addr_t ip =
+        WPEFramework::Plugin::ContainerUtils::getContainerIpAddress(fakeId);
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(ip), 0u,
+                        "getContainerIpAddress() returns 0 after a failed trackContainer()");
+
+    return tr.failures;
+}
+
+/* Test_ContainerUtils_UntrackContainer_UnknownContainerIsNoOp
+ *
+ * Verifies that untrackContainer() can be called for containers that were
+ * never tracked, or more than once, without crashing.
+ */
+uint32_t Test_ContainerUtils_UntrackContainer_UnknownContainerIsNoOp()
+{
+    L0Test::TestResult tr;
+
+    WPEFramework::Plugin::ContainerUtils::untrackContainer("l0test_never_tracked");
+    WPEFramework::Plugin::ContainerUtils::untrackContainer("l0test_never_tracked");
+    WPEFramework::Plugin::ContainerUtils::untrackContainer("");
+
+    const in_addr_t ip =
+        WPEFramework::Plugin::ContainerUtils::getContainerIpAddress("l0test_never_tracked");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(ip), 0u,
+                        "getContainerIpAddress() returns 0 after untrackContainer()");
+
+    return tr.failures;
+}
+
+/* Test_ContainerUtils_TrackContainer_FollowsRealProcess
+ *
+ * Forks a child that stands in for a container process and lists its pid in
+ * a fake memory cgroup. Verifies trackContainer() finds it while it runs, and
+ * that once it has exited and been reaped neither the tracked entry nor a new
+ * trackContainer() can reach a process through its old pid.
+ */
+uint32_t Test_ContainerUtils_TrackContainer_FollowsRealProcess()
+{
+    L0Test::TestResult tr;
+
+    const std::string root = "/tmp/rm_l0test_containerutils/";
+    const std::string containerId = "l0test_child";
+    mkdir(root.c_str(), 0755);
+    mkdir((root + containerId).c_str(), 0755);
+    const std::string procsPath = root + containerId + "/cgroup.procs";
+
+    const pid_t child = fork();
+    if (child == 0) {
+        pause();
+        _exit(0);
+    }
+    L0Test::ExpectTrue(tr, child > 0, "child process forked");
+    if (child <= 0) {
+        return tr.failures;
+    }
+    std::ofstream(procsPath.c_str()) << child << "\n";
+
+    WPEFramework::Plugin::ContainerUtils::setCgroupMemoryRoot(root);
+    L0Test::ExpectTrue(tr, WPEFramework::Plugin::ContainerUtils::trackContainer(containerId),
+                       "trackContainer() finds the running child");
+
+    kill(child, SIGKILL);
+    waitpid(child, nullptr, 0);
+
+    const in_addr_t ip =
+        WPEFramework::Plugin::ContainerUtils::getContainerIpAddress(containerId);
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(ip), 0u,
+                        "getContainerIpAddress() fails once the tracked process has exited");
+    L0Test::ExpectTrue(tr, !WPEFramework::Plugin::ContainerUtils::trackContainer(containerId),
+                       "trackContainer() refuses the pid of the reaped child");
+
+    WPEFramework::Plugin::ContainerUtils::untrackContainer(containerId);
+    WPEFramework::Plugin::ContainerUtils::setCgroupMemoryRoot("/sys/fs/cgroup/memory/");
+    unlink(procsPath.c_str());
+    rmdir((root + containerId).c_str());
+    rmdir(root.c_str());
+
+    return tr.failures;
+}
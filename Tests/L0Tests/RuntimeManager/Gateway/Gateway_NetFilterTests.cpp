@@ -33,17 +33,27 @@
  *   - addContainerPortForwarding() returns false when iptables unavailable
  *   - getContainerPortForwardList() returns empty list when iptables unavailable
  *
+ * NetFilter::Transaction:
+ *   - committed rules are removed through the comment index
+ *   - uncommitted changes are discarded
+ *   - benchmark of per-rule commits against one transaction per container
+ *
  * NOTE: All NetFilter operations that touch iptables will return false / empty
  * in environments without kernel iptables support.  Tests are written to accept
- * both outcomes (success and graceful failure).
+ * both outcomes (success and graceful failure).  The Transaction tests run on a
+ * thread moved into a new network namespace, so the host ruleset is never
+ * touched; they are skipped when that isn't permitted.
  */
 
 #include <cstdint>
 #include <chrono>
+#include <functional>
 #include <iostream>
 #include <list>
 #include <string>
+#include <thread>
 #include <arpa/inet.h>
+#include <sched.h>
 
 #include "Gateway/NetFilterLock.h"
 #include "Gateway/NetFilter.h"
@@ -350,3 +360,179 @@ uint32_t Test_NetFilter_PortForward_StructMembersAccessible()
 
     return tr.failures;
 }
+
+// ──────────────────────────────────────────────────────────────────────────────
+// NetFilter::Transaction tests
+// ──────────────────────────────────────────────────────────────────────────────
+
+namespace {
+
+/* Runs fn on a thread that has been moved into a new, empty network namespace.
+ * Returns false without running fn if the namespace can't be created.
+ */
+bool RunInNewNetNamespace(const std::function<void()> &fn)
+{
+    bool entered = false;
+    std::thread worker([&]() {
+        if (unshare(CLONE_NEWNET) != 0) {
+            return;
+        }
+        entered = true;
+        fn();
+    });
+    worker.join();
+    return entered;
+}
+
+bool HasPortForward(const in_addr_t containerIp, uint16_t externalPort)
+{
+    for (const NetFilter::PortForward &pf : NetFilter::getContainerPortForwardList("dobby0", containerIp)) {
+        if (pf.externalPort == externalPort) {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+/* Test_NetFilter_Transaction_IndexedRemoval
+ *
+ * Rules committed by a transaction are removed by comment through the index,
+ * and rules added to a transaction that is never committed are not applied.
+ */
+uint32_t Test_NetFilter_Transaction_IndexedRemoval()
+{
+    L0Test::TestResult tr;
+
+    const in_addr_t containerIp = 0x0a000002; // 10.0.0.2
+    bool available = false;
+
+    const bool entered = RunInNewNetNamespace([&]() {
+        {
+            NetFilter::Transaction transaction;
+            available = transaction.openExternalPort(19998, NetFilter::Protocol::Tcp, "ralf_l0test_tx") &&
+                        transaction.addContainerPortForwarding("dobby0", NetFilter::Protocol::Tcp,
+                                                               19997, containerIp, 22222, "ralf_l0test_tx");
+            if (!available) {
+                return;
+            }
+            L0Test::ExpectTrue(tr, transaction.commit(), "transaction commits");
+        }
+        L0Test::ExpectTrue(tr, HasPortForward(containerIp, 19997), "committed port forward is present");
+
+        {
+            NetFilter::Transaction transaction;
+            transaction.removeRulesWithComment("ralf_l0test_tx");
+            L0Test::ExpectTrue(tr, transaction.commit(), "removal commits");
+        }
+        L0Test::ExpectTrue(tr, !HasPortForward(containerIp, 19997), "indexed rules are removed");
+
+        {
+            NetFilter::Transaction transaction;
+            transaction.addContainerPortForwarding("dobby0", NetFilter::Protocol::Tcp,
+                                                   19996, containerIp, 22222, "ralf_l0test_tx");
+        }
+        L0Test::ExpectTrue(tr, !HasPortForward(containerIp, 19996), "uncommitted rules are discarded");
+    });
+
+    if (!entered || !available) {
+        std::cout << "  skipped: iptables in a new network namespace is not available" << std::endl;
+    }
+
+    return tr.failures;
+}
+
+/* Test_NetFilter_Transaction_Benchmark
+ *
+ * Adds and removes the rules of a set of containers on top of a table of
+ * synthetic rules, first with a commit per change and a regex scan to remove
+ * them, then with one transaction per container and the comment index.
+ * Timings are reported; only correctness is asserted.
+ */
+uint32_t Test_NetFilter_Transaction_Benchmark()
+{
+    L0Test::TestResult tr;
+
+    const uint32_t fillers = 250u;
+    const uint32_t containers = 20u;
+    bool available = false;
+
+    const bool entered = RunInNewNetNamespace([&]() {
+        // 4 rules per filler: INPUT, OUTPUT, FORWARD and nat PREROUTING
+        {
+            NetFilter::Transaction transaction;
+            available = true;
+            for (uint32_t i = 0; available && (i < fillers); i++) {
+                const std::string comment = "ralf_l0test_filler:" + std::to_string(i);
+                available = transaction.openExternalPort(20000 + i, NetFilter::Protocol::Udp, comment) &&
+                            transaction.addContainerPortForwarding("dobby0", NetFilter::Protocol::Udp,
+                                                                   20000 + i, 0x0a010000 + i, 80, comment);
+            }
+            if (!available || !transaction.commit()) {
+                available = false;
+                return;
+            }
+        }
+
+        const auto containerIp = [](uint32_t i) { return static_cast<in_addr_t>(0x0a020000 + i); };
+        const auto containerComment = [](uint32_t i) { return "ralf_l0test_bench:" + std::to_string(i); };
+
+        // a commit per change and a scan per removal
+        const auto perChangeStart = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < containers; i++) {
+            NetFilter::openExternalPort(30000 + i, NetFilter::Protocol::Tcp, containerComment(i));
+            NetFilter::addContainerPortForwarding("dobby0", NetFilter::Protocol::Tcp,
+                                                  30000 + i, containerIp(i), 22222, containerComment(i));
+        }
+        bool allAdded = true;
+        for (uint32_t i = 0; i < containers; i++) {
+            allAdded = allAdded && HasPortForward(containerIp(i), 30000 + i);
+        }
+        for (uint32_t i = 0; i < containers; i++) {
+            NetFilter::removeAllRulesMatchingComment(containerComment(i));
+        }
+        const auto perChangeUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - perChangeStart).count();
+
+        L0Test::ExpectTrue(tr, allAdded, "per-change rules are applied");
+        L0Test::ExpectTrue(tr, !HasPortForward(containerIp(0), 30000), "per-change rules are removed");
+
+        // a transaction per container and indexed removal
+        const auto batchedStart = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < containers; i++) {
+            NetFilter::Transaction transaction;
+            transaction.openExternalPort(30000 + i, NetFilter::Protocol::Tcp, containerComment(i));
+            transaction.addContainerPortForwarding("dobby0", NetFilter::Protocol::Tcp,
+                                                   30000 + i, containerIp(i), 22222, containerComment(i));
+            transaction.commit();
+        }
+        allAdded = true;
+        for (uint32_t i = 0; i < containers; i++) {
+            allAdded = allAdded && HasPortForward(containerIp(i), 30000 + i);
+        }
+        for (uint32_t i = 0; i < containers; i++) {
+            NetFilter::Transaction transaction;
+            transaction.removeRulesWithComment(containerComment(i));
+            transaction.commit();
+        }
+        const auto batchedUs = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - batchedStart).count();
+
+        L0Test::ExpectTrue(tr, allAdded, "transaction rules are applied");
+        L0Test::ExpectTrue(tr, !HasPortForward(containerIp(0), 30000), "indexed rules are removed");
+        L0Test::ExpectTrue(tr, HasPortForward(0x0a010000, 20000), "synthetic rules are untouched");
+
+        std::cout << "  " << containers << " containers over " << (fillers * 4u) << " rules: per-change "
+                  << perChangeUs << " us, per-container transaction " << batchedUs << " us" << std::endl;
+
+        // drop the synthetic rules from the comment index
+        NetFilter::removeAllRulesMatchingComment("ralf_l0test_filler:.*");
+    });
+
+    if (!entered || !available) {
+        std::cout << "  skipped: iptables in a new network namespace is not available" << std::endl;
+    }
+
+    return tr.failures;
+}
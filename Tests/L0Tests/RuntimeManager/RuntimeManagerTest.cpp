@@ -35,8 +35,15 @@ extern uint32_t Test_Impl_AnnotateEmptyKey();
 extern uint32_t Test_Impl_AnnotateNoOCIPlugin();
 extern uint32_t Test_Impl_GetInfoEmptyAppInstanceId();
 extern uint32_t Test_Impl_GetInfoNoOCIPlugin();
+extern uint32_t Test_Impl_BlockedInstanceDoesNotStallOthers();
+extern uint32_t Test_Impl_KillEscalatesPendingTerminate();
+extern uint32_t Test_Impl_KillReturnsWhileTerminateBlocks();
+extern uint32_t Test_Impl_FailedTeardownFiresOnFailure();
+extern uint32_t Test_Impl_RunAcquiresPackageInstallerLate();
 extern uint32_t Test_Impl_RunEmptyAppInstanceId();
 extern uint32_t Test_Impl_RunNoWindowManagerConnector();
+extern uint32_t Test_Impl_RunOverlapsStorageLookup();
+extern uint32_t Test_Impl_RunJoinsStorageLookupOnFailure();
 extern uint32_t Test_Impl_MountReturnsSuccess();
 extern uint32_t Test_Impl_UnmountReturnsSuccess();
 extern uint32_t Test_Impl_GetInstanceReturnsSelf();
@@ -69,6 +76,18 @@ extern uint32_t Test_UserIdManager_ClearUserIdForUnknownAppDoesNotCrash();
 extern uint32_t Test_UserIdManager_GetAppsGidReturns30000();
 extern uint32_t Test_UserIdManager_ExhaustPoolReturnsZero();
 extern uint32_t Test_UserIdManager_MultipleGetAndClearCycles();
+extern uint32_t Test_InstanceLockTable_DifferentInstancesRunInParallel();
+extern uint32_t Test_ContainerReaper_RetriesStepsInOrder();
+extern uint32_t Test_ContainerReaper_GivesUpAfterMaxAttempts();
+extern uint32_t Test_ContainerReaper_BoundedConcurrency();
+extern uint32_t Test_ContainerReaper_ResubmitTakesOverPendingTeardown();
+extern uint32_t Test_ContainerReaper_UnfinishedTeardownIsJournaled();
+extern uint32_t Test_GStreamerRegistry_RejectsCorruptRegistry();
+extern uint32_t Test_GStreamerRegistry_ReusesRegistryWhenUnchanged();
+extern uint32_t Test_GStreamerRegistry_StartDoesNotBlock();
+extern uint32_t Test_CgroupStatsSampler_ReadsSyntheticCgroupTree();
+extern uint32_t Test_CgroupStatsSampler_RereadsCachedFiles();
+extern uint32_t Test_CgroupStatsSampler_SamplesPeriodically();
 extern uint32_t Test_AIConfig_DefaultConsoleLogCap();
 extern uint32_t Test_AIConfig_DefaultNonHomeAppMemoryLimit();
 extern uint32_t Test_AIConfig_DefaultNonHomeAppGpuLimit();
@@ -155,6 +174,8 @@ extern uint32_t Test_Ralf_CreateDirectories_UnderReadOnlyParentReturnsError();
 extern uint32_t Test_Ralf_CreateDirectories_WithNonZeroUidGidCallsChown();
 extern uint32_t Test_Ralf_UnmountOverlayfs_NonMountedPathReturnsFalse();
 extern uint32_t Test_Ralf_GenerateOCIRootfs_FailsDueToNoMountSupport();
+extern uint32_t Test_Ralf_JsonFromFileCached_ReloadsWhenFileChanges();
+extern uint32_t Test_Ralf_JsonFromFileCached_RemovedFileReturnsFalse();
 
 // ── ralf/RalfPackageBuilder tests ─────────────────────────────────────────────
 extern uint32_t Test_RalfPackageBuilder_ConstructionAndDestruction();
@@ -178,6 +199,15 @@ extern uint32_t Test_RalfOCIConfigGenerator_GenerateWithMockBaseSpec();
 extern uint32_t Test_RalfOCIConfigGenerator_MultipleGenerateCallsDoNotCrash();
 extern uint32_t Test_RalfOCIConfigGenerator_GenerateWithDifferentAppInstances();
 extern uint32_t Test_RalfOCIConfigGenerator_LogPathSetCorrectlyInOCIConfig();
+extern uint32_t Test_RalfOCIConfigGenerator_PackageConfigSharedAcrossInstances();
+
+// ── ralf/RalfLayerStackCache tests ───────────────────────────────────────────
+extern uint32_t Test_RalfLayerStackCache_SameLayersShareOneMount();
+extern uint32_t Test_RalfLayerStackCache_RelaunchInGraceReusesStack();
+extern uint32_t Test_RalfLayerStackCache_IdleStackDetachedAfterGrace();
+extern uint32_t Test_RalfLayerStackCache_UnstackedLayerSets();
+extern uint32_t Test_RalfLayerStackCache_MountDoesNotBlockOtherLayers();
+extern uint32_t Test_RalfLayerStackCache_SweepDetachesStaleStacks();
 
 // ── Gateway/ContainerUtils tests ─────────────────────────────────────────────
 extern uint32_t Test_ContainerUtils_GetContainerIpAddress_UnknownContainerReturnsZero();
@@ -185,6 +215,9 @@ extern uint32_t Test_ContainerUtils_GetContainerIpAddress_EmptyContainerIdReturn
 extern uint32_t Test_ContainerUtils_GetContainerIpAddress_MultipleCallsDoNotCrash();
 extern uint32_t Test_ContainerUtils_NamespaceEnumValues();
 extern uint32_t Test_ContainerUtils_GetContainerIpAddress_VeryLongContainerIdDoesNotCrash();
+extern uint32_t Test_ContainerUtils_TrackContainer_UnknownContainerReturnsFalse();
+extern uint32_t Test_ContainerUtils_UntrackContainer_UnknownContainerIsNoOp();
+extern uint32_t Test_ContainerUtils_TrackContainer_FollowsRealProcess();
 
 // ── Gateway/WebInspector tests ────────────────────────────────────────────────
 extern uint32_t Test_Debugger_TypeEnum_WebInspectorValue();
@@ -210,6 +243,8 @@ extern uint32_t Test_NetFilter_AddContainerPortForwarding_ReturnsFalseOrTrue();
 extern uint32_t Test_NetFilter_GetContainerPortForwardList_ReturnsListType();
 extern uint32_t Test_NetFilter_GetContainerPortForwardList_DefaultIpReturnsListType();
 extern uint32_t Test_NetFilter_PortForward_StructMembersAccessible();
+extern uint32_t Test_NetFilter_Transaction_IndexedRemoval();
+extern uint32_t Test_NetFilter_Transaction_Benchmark();
 
 // DobbyEventListener coverage
 extern uint32_t Test_DobbyEventListener_InitializeWithValidOCIContainerSucceeds();
@@ -253,6 +288,17 @@ extern uint32_t Test_DobbySpecGenerator_GstRegistryEnvAbsentWhenRialtoActive();
 extern uint32_t Test_DobbySpecGenerator_GstRegistryMountAbsentWhenRialtoActive();
 extern uint32_t Test_DobbySpecGenerator_RialtoPrefixedSocketPathUsedInSpec();
 #endif
+extern uint32_t Test_DobbySpecGenerator_TemplateCacheMatchesFullBuild();
+extern uint32_t Test_DobbySpecGenerator_TemplateCacheFixesResourceSocketPerLaunch();
+extern uint32_t Test_DobbySpecGenerator_TemplateCacheBenchmark();
+extern uint32_t Test_LaunchProfileCache_SkipsReparsing();
+extern uint32_t Test_LaunchProfileCache_SpecMatchesUncachedBuild();
+extern uint32_t Test_OCIJsonWriter_GoldenDobbySpec();
+extern uint32_t Test_OCIJsonWriter_StreamingMatchesDocument();
+extern uint32_t Test_OCIJsonWriter_Benchmark();
+extern uint32_t Test_DobbySpecModel_StreamingMatchesDocument();
+extern uint32_t Test_DobbySpecGenerator_OverlayCapabilitiesApplied();
+extern uint32_t Test_DobbySpecModel_Benchmark();
 
 int main()
 {
@@ -295,8 +341,15 @@ int main()
         { "Impl_AnnotateNoOCIPlugin",                                                Test_Impl_AnnotateNoOCIPlugin },
         { "Impl_GetInfoEmptyAppInstanceId",                                          Test_Impl_GetInfoEmptyAppInstanceId },
         { "Impl_GetInfoNoOCIPlugin",                                                 Test_Impl_GetInfoNoOCIPlugin },
+        { "Impl_BlockedInstanceDoesNotStallOthers",                                  Test_Impl_BlockedInstanceDoesNotStallOthers },
+        { "Impl_KillEscalatesPendingTerminate",                                      Test_Impl_KillEscalatesPendingTerminate },
+        { "Impl_KillReturnsWhileTerminateBlocks",                                    Test_Impl_KillReturnsWhileTerminateBlocks },
+        { "Impl_FailedTeardownFiresOnFailure",                                       Test_Impl_FailedTeardownFiresOnFailure },
+        { "Impl_RunAcquiresPackageInstallerLate",                                    Test_Impl_RunAcquiresPackageInstallerLate },
         { "Impl_RunEmptyAppInstanceId",                                              Test_Impl_RunEmptyAppInstanceId },
         { "Impl_RunNoWindowManagerConnector",                                        Test_Impl_RunNoWindowManagerConnector },
+        { "Impl_RunOverlapsStorageLookup",                                           Test_Impl_RunOverlapsStorageLookup },
+        { "Impl_RunJoinsStorageLookupOnFailure",                                     Test_Impl_RunJoinsStorageLookupOnFailure },
         { "Impl_MountReturnsSuccess",                                                Test_Impl_MountReturnsSuccess },
         { "Impl_UnmountReturnsSuccess",                                              Test_Impl_UnmountReturnsSuccess },
         { "Impl_GetInstanceReturnsSelf",                                             Test_Impl_GetInstanceReturnsSelf },
@@ -329,6 +382,18 @@ int main()
         { "UserIdManager_GetAppsGidReturns30000",                                    Test_UserIdManager_GetAppsGidReturns30000 },
         { "UserIdManager_ExhaustPoolReturnsZero",                                    Test_UserIdManager_ExhaustPoolReturnsZero },
         { "UserIdManager_MultipleGetAndClearCycles",                                 Test_UserIdManager_MultipleGetAndClearCycles },
+        { "InstanceLockTable_DifferentInstancesRunInParallel",                       Test_InstanceLockTable_DifferentInstancesRunInParallel },
+        { "ContainerReaper_RetriesStepsInOrder",                                     Test_ContainerReaper_RetriesStepsInOrder },
+        { "ContainerReaper_GivesUpAfterMaxAttempts",                                 Test_ContainerReaper_GivesUpAfterMaxAttempts },
+        { "ContainerReaper_BoundedConcurrency",                                      Test_ContainerReaper_BoundedConcurrency },
+        { "ContainerReaper_ResubmitTakesOverPendingTeardown",                        Test_ContainerReaper_ResubmitTakesOverPendingTeardown },
+        { "ContainerReaper_UnfinishedTeardownIsJournaled",                           Test_ContainerReaper_UnfinishedTeardownIsJournaled },
+        { "GStreamerRegistry_RejectsCorruptRegistry",                                Test_GStreamerRegistry_RejectsCorruptRegistry },
+        { "GStreamerRegistry_ReusesRegistryWhenUnchanged",                           Test_GStreamerRegistry_ReusesRegistryWhenUnchanged },
+        { "GStreamerRegistry_StartDoesNotBlock",                                     Test_GStreamerRegistry_StartDoesNotBlock },
+        { "CgroupStatsSampler_ReadsSyntheticCgroupTree",                             Test_CgroupStatsSampler_ReadsSyntheticCgroupTree },
+        { "CgroupStatsSampler_RereadsCachedFiles",                                   Test_CgroupStatsSampler_RereadsCachedFiles },
+        { "CgroupStatsSampler_SamplesPeriodically",                                  Test_CgroupStatsSampler_SamplesPeriodically },
         { "AIConfig_DefaultConsoleLogCap",                                           Test_AIConfig_DefaultConsoleLogCap },
         { "AIConfig_DefaultNonHomeAppMemoryLimit",                                   Test_AIConfig_DefaultNonHomeAppMemoryLimit },
         { "AIConfig_DefaultNonHomeAppGpuLimit",                                      Test_AIConfig_DefaultNonHomeAppGpuLimit },
@@ -415,6 +480,17 @@ int main()
         { "DobbySpecGenerator_GstRegistryMountAbsentWhenRialtoActive",               Test_DobbySpecGenerator_GstRegistryMountAbsentWhenRialtoActive },
         { "DobbySpecGenerator_RialtoPrefixedSocketPathUsedInSpec",                   Test_DobbySpecGenerator_RialtoPrefixedSocketPathUsedInSpec },
 #endif
+        { "DobbySpecGenerator_TemplateCacheMatchesFullBuild",                        Test_DobbySpecGenerator_TemplateCacheMatchesFullBuild },
+        { "DobbySpecGenerator_TemplateCacheFixesResourceSocketPerLaunch",            Test_DobbySpecGenerator_TemplateCacheFixesResourceSocketPerLaunch },
+        { "DobbySpecGenerator_TemplateCacheBenchmark",                               Test_DobbySpecGenerator_TemplateCacheBenchmark },
+        { "LaunchProfileCache_SkipsReparsing",                                       Test_LaunchProfileCache_SkipsReparsing },
+        { "LaunchProfileCache_SpecMatchesUncachedBuild",                             Test_LaunchProfileCache_SpecMatchesUncachedBuild },
+        { "OCIJsonWriter_GoldenDobbySpec",                                           Test_OCIJsonWriter_GoldenDobbySpec },
+        { "OCIJsonWriter_StreamingMatchesDocument",                                  Test_OCIJsonWriter_StreamingMatchesDocument },
+        { "OCIJsonWriter_Benchmark",                                                 Test_OCIJsonWriter_Benchmark },
+        { "DobbySpecModel_StreamingMatchesDocument",                                 Test_DobbySpecModel_StreamingMatchesDocument },
+        { "DobbySpecGenerator_OverlayCapabilitiesApplied",                           Test_DobbySpecGenerator_OverlayCapabilitiesApplied },
+        { "DobbySpecModel_Benchmark",                                                Test_DobbySpecModel_Benchmark },
 
         // ── ralf/RalfSupport tests ───────────────────────────────────────────
         { "Ralf_ParseMemorySize_EmptyStringReturnsZero",                             Test_Ralf_ParseMemorySize_EmptyStringReturnsZero },
@@ -457,6 +533,8 @@ int main()
         { "Ralf_CreateDirectories_WithNonZeroUidGidCallsChown",                      Test_Ralf_CreateDirectories_WithNonZeroUidGidCallsChown },
         { "Ralf_UnmountOverlayfs_NonMountedPathReturnsFalse",                        Test_Ralf_UnmountOverlayfs_NonMountedPathReturnsFalse },
         { "Ralf_GenerateOCIRootfs_FailsDueToNoMountSupport",                         Test_Ralf_GenerateOCIRootfs_FailsDueToNoMountSupport },
+        { "Ralf_JsonFromFileCached_ReloadsWhenFileChanges",                          Test_Ralf_JsonFromFileCached_ReloadsWhenFileChanges },
+        { "Ralf_JsonFromFileCached_RemovedFileReturnsFalse",                         Test_Ralf_JsonFromFileCached_RemovedFileReturnsFalse },
 
         // ── ralf/RalfPackageBuilder tests ────────────────────────────────────
         { "RalfPackageBuilder_ConstructionAndDestruction",                           Test_RalfPackageBuilder_ConstructionAndDestruction },
@@ -480,6 +558,15 @@ int main()
         { "RalfOCIConfigGenerator_MultipleGenerateCallsDoNotCrash",                  Test_RalfOCIConfigGenerator_MultipleGenerateCallsDoNotCrash },
         { "RalfOCIConfigGenerator_GenerateWithDifferentAppInstances",                Test_RalfOCIConfigGenerator_GenerateWithDifferentAppInstances },
         { "RalfOCIConfigGenerator_LogPathSetCorrectlyInOCIConfig",                   Test_RalfOCIConfigGenerator_LogPathSetCorrectlyInOCIConfig },
+        { "RalfOCIConfigGenerator_PackageConfigSharedAcrossInstances",              Test_RalfOCIConfigGenerator_PackageConfigSharedAcrossInstances },
+
+        // ── ralf/RalfLayerStackCache tests ───────────────────────────────────
+        { "RalfLayerStackCache_SameLayersShareOneMount",                             Test_RalfLayerStackCache_SameLayersShareOneMount },
+        { "RalfLayerStackCache_RelaunchInGraceReusesStack",                          Test_RalfLayerStackCache_RelaunchInGraceReusesStack },
+        { "RalfLayerStackCache_IdleStackDetachedAfterGrace",                         Test_RalfLayerStackCache_IdleStackDetachedAfterGrace },
+        { "RalfLayerStackCache_UnstackedLayerSets",                                  Test_RalfLayerStackCache_UnstackedLayerSets },
+        { "RalfLayerStackCache_MountDoesNotBlockOtherLayers",                        Test_RalfLayerStackCache_MountDoesNotBlockOtherLayers },
+        { "RalfLayerStackCache_SweepDetachesStaleStacks",                            Test_RalfLayerStackCache_SweepDetachesStaleStacks },
 
         // ── Gateway/ContainerUtils tests ─────────────────────────────────────
         { "ContainerUtils_GetContainerIpAddress_UnknownContainerReturnsZero",        Test_ContainerUtils_GetContainerIpAddress_UnknownContainerReturnsZero },
@@ -487,6 +574,9 @@ int main()
         { "ContainerUtils_GetContainerIpAddress_MultipleCallsDoNotCrash",            Test_ContainerUtils_GetContainerIpAddress_MultipleCallsDoNotCrash },
         { "ContainerUtils_NamespaceEnumValues",                                      Test_ContainerUtils_NamespaceEnumValues },
         { "ContainerUtils_GetContainerIpAddress_VeryLongContainerIdDoesNotCrash",    Test_ContainerUtils_GetContainerIpAddress_VeryLongContainerIdDoesNotCrash },
+        { "ContainerUtils_TrackContainer_UnknownContainerReturnsFalse",              Test_ContainerUtils_TrackContainer_UnknownContainerReturnsFalse },
+        { "ContainerUtils_UntrackContainer_UnknownContainerIsNoOp",                  Test_ContainerUtils_UntrackContainer_UnknownContainerIsNoOp },
+        { "ContainerUtils_TrackContainer_FollowsRealProcess",                        Test_ContainerUtils_TrackContainer_FollowsRealProcess },
 
         // ── Gateway/WebInspector tests ────────────────────────────────────────
         { "Debugger_TypeEnum_WebInspectorValue",                                     Test_Debugger_TypeEnum_WebInspectorValue },
@@ -512,6 +602,8 @@ int main()
         { "NetFilter_GetContainerPortForwardList_ReturnsListType",                   Test_NetFilter_GetContainerPortForwardList_ReturnsListType },
         { "NetFilter_GetContainerPortForwardList_DefaultIpReturnsListType",          Test_NetFilter_GetContainerPortForwardList_DefaultIpReturnsListType },
         { "NetFilter_PortForward_StructMembersAccessible",                           Test_NetFilter_PortForward_StructMembersAccessible },
+        { "NetFilter_Transaction_IndexedRemoval",                                    Test_NetFilter_Transaction_IndexedRemoval },
+        { "NetFilter_Transaction_Benchmark",                                         Test_NetFilter_Transaction_Benchmark },
     };
 
     uint32_t failures = 0;
@@ -22,25 +22,47 @@
  *
  * L0 tests for RuntimeManager helper components:
  *   - UserIdManager  (UserIdManager.cpp/.h)
+ *   - InstanceLockTable (InstanceLockTable.cpp/.h)
+ *   - ContainerReaper (ContainerReaper.cpp/.h)
+ *   - GStreamerRegistry (GStreamerRegistry.cpp/.h)
+ *   - CgroupStatsSampler (CgroupStatsSampler.cpp/.h)
  *   - AIConfiguration (AIConfiguration.cpp/.h)
  *   - DobbyEventListener (DobbyEventListener.cpp/.h)
  *   - WindowManagerConnector (WindowManagerConnector.cpp/.h)
  *   - DobbySpecGenerator (DobbySpecGenerator.cpp/.h)
+ *   - OCIJsonWriter (OCIJsonWriter.cpp/.h)
+ *   - DobbySpecModel (DobbySpecModel.cpp/.h)
  */
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdio>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <map>
+#include <mutex>
 #include <unistd.h>
+#include <sys/stat.h>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "AIConfiguration.h"
 #include "ApplicationConfiguration.h"
+#include "CgroupStatsSampler.h"
+#include "ContainerReaper.h"
 #include "DobbyEventListener.h"
 #include "DobbySpecGenerator.h"
+#include "DobbySpecModel.h"
+#include "GStreamerRegistry.h"
+#include "InstanceLockTable.h"
+#include "LaunchProfileCache.h"
+#include "OCIJsonWriter.h"
 #include "UserIdManager.h"
 #include "WindowManagerConnector.h"
+#include "ralf/RalfSupport.h"
 #include "ServiceMock.h"
 #include "common/L0Expect.hpp"
 #include "common/L0TestTypes.hpp"
@@ -220,6 +242,629 @@ uint32_t Test_UserIdManager_MultipleGetAndClearCycles()
     return tr.failures;
 }
 
+// ──────────────────────────────────────────────────────────────────────────────
+//  InstanceLockTable tests
+// ──────────────────────────────────────────────────────────────────────────────
+
+namespace {
+bool WaitForFlag(const std::atomic<bool>& flag, const uint32_t timeoutMs)
+{
+    for (uint32_t waited = 0; !flag.load() && waited < timeoutMs; waited += 5) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return flag.load();
+}
+}
+
+/* Test_InstanceLockTable_DifferentInstancesRunInParallel
+ *
+ * Holds the lock of one appInstanceId (as a long Hibernate would) and verifies
+ * that another appInstanceId can still be locked, while a second caller on the
+ * held appInstanceId waits until it is released. The table is empty afterwards.
+ */
+uint32_t Test_InstanceLockTable_DifferentInstancesRunInParallel()
+{
+    L0Test::TestResult tr;
+
+    WPEFramework::Plugin::InstanceLockTable table;
+    std::atomic<bool> firstHeld{false};
+    std::atomic<bool> releaseFirst{false};
+    std::atomic<bool> otherAcquired{false};
+    std::atomic<bool> sameAcquired{false};
+
+    std::thread first([&]() {
+        WPEFramework::Plugin::InstanceLockTable::ScopedLock lock(table, "youTube");
+        firstHeld = true;
+        WaitForFlag(releaseFirst, 5000);
+    });
+    L0Test::ExpectTrue(tr, WaitForFlag(firstHeld, 2000), "first caller holds its instance lock");
+
+    std::thread other([&]() {
+        WPEFramework::Plugin::InstanceLockTable::ScopedLock lock(table, "netflix");
+        otherAcquired = true;
+    });
+    std::thread same([&]() {
+        WPEFramework::Plugin::InstanceLockTable::ScopedLock lock(table, "youTube");
+        sameAcquired = true;
+    });
+
+    L0Test::ExpectTrue(tr, WaitForFlag(otherAcquired, 2000),
+                       "a different appInstanceId is not blocked by the held one");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    L0Test::ExpectTrue(tr, !sameAcquired.load(),
+                       "the same appInstanceId waits for the holder");
+
+    releaseFirst = true;
+    first.join();
+    other.join();
+    same.join();
+
+    L0Test::ExpectTrue(tr, sameAcquired.load(), "the waiting caller runs after release");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(table.size()), 0u,
+                        "unused instance locks are dropped");
+
+    return tr.failures;
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+//  ContainerReaper tests
+// ──────────────────────────────────────────────────────────────────────────────
+
+namespace {
+struct ReaperCompletion {
+    std::mutex lock;
+    std::condition_variable changed;
+    std::map<std::string, std::string> results;   // appInstanceId -> failed step
+
+    WPEFramework::Plugin::ContainerReaper::CompletionFunction function()
+    {
+        return [this](const std::string& appInstanceId, const std::string& failedStep) {
+            std::lock_guard<std::mutex> guard(lock);
+            results[appInstanceId] = failedStep;
+            changed.notify_all();
+        };
+    }
+
+    bool waitFor(const std::string& appInstanceId, std::string& failedStep)
+    {
+        std::unique_lock<std::mutex> guard(lock);
+        const bool done = changed.wait_for(guard, std::chrono::seconds(5), [&]() {
+            return results.find(appInstanceId) != results.end();
+        });
+        if (done) {
+            failedStep = results[appInstanceId];
+        }
+        return done;
+    }
+};
+
+WPEFramework::Plugin::ContainerReaper::Config ReaperConfig(uint32_t workers)
+{
+    WPEFramework::Plugin::ContainerReaper::Config config;
+    config.workers = workers;
+    config.maxAttempts = 3;
+    config.retryDelayMs = 5;
+    return config;
+}
+
+std::string ReaperJournalDir(const std::string& name)
+{
+    const std::string dir = "/tmp/rm_l0test_reaper_" + name + "/";
+    if (ralf::checkIfPathExists(dir)) {
+        ralf::removeDirectoryRecursively(dir);
+    }
+    return dir;
+}
+}
+
+/* Test_ContainerReaper_RetriesStepsInOrder
+ *
+ * Runs a teardown whose first step fails twice before it succeeds and
+ * verifies both steps run once successfully and in order, and that the
+ * journal entry is gone once the teardown completed.
+ */
+uint32_t Test_ContainerReaper_RetriesStepsInOrder()
+{
+    L0Test::TestResult tr;
+
+    const std::string journalDir = ReaperJournalDir("retry");
+    WPEFramework::Plugin::ContainerReaper reaper(ReaperConfig(1), journalDir);
+    ReaperCompletion completion;
+    std::atomic<uint32_t> stopAttempts{0};
+    std::string order;
+
+    std::vector<WPEFramework::Plugin::ContainerReaper::Step> steps;
+    steps.push_back({ "stopContainer", [&]() { order += "s"; return ++stopAttempts >= 3; } });
+    steps.push_back({ "clearUserId", [&]() { order += "u"; return true; } });
+
+    L0Test::ExpectTrue(tr, reaper.submit("youTube", "{}", steps, completion.function()), "teardown accepted");
+    std::string failedStep = "unset";
+    L0Test::ExpectTrue(tr, completion.waitFor("youTube", failedStep), "teardown completes");
+    L0Test::ExpectEqStr(tr, failedStep, "", "teardown succeeded");
+    L0Test::ExpectEqStr(tr, order, "sssu", "failed step retried before the next one runs");
+    L0Test::ExpectTrue(tr, reaper.waitFor("youTube", 1000), "teardown no longer pending");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(reaper.unfinished().size()), 0u, "journal entry removed");
+
+    return tr.failures;
+}
+
+/* Test_ContainerReaper_GivesUpAfterMaxAttempts
+ *
+ * Verifies a step that keeps failing is attempted maxAttempts times, the
+ * completion names it, and the steps after it are not run.
+ */
+uint32_t Test_ContainerReaper_GivesUpAfterMaxAttempts()
+{
+    L0Test::TestResult tr;
+
+    WPEFramework::Plugin::ContainerReaper reaper(ReaperConfig(1), ReaperJournalDir("giveup"));
+    ReaperCompletion completion;
+    std::atomic<uint32_t> attempts{0};
+    std::atomic<bool> laterStepRan{false};
+
+    std::vector<WPEFramework::Plugin::ContainerReaper::Step> steps;
+    steps.push_back({ "stopContainer", [&]() { attempts++; return false; } });
+    steps.push_back({ "clearUserId", [&]() { laterStepRan = true; return true; } });
+
+    reaper.submit("netflix", "{}", steps, completion.function());
+    std::string failedStep;
+    L0Test::ExpectTrue(tr, completion.waitFor("netflix", failedStep), "teardown completes");
+    L0Test::ExpectEqStr(tr, failedStep, "stopContainer", "completion names the failed step");
+    L0Test::ExpectEqU32(tr, attempts.load(), 3u, "step attempted maxAttempts times");
+    L0Test::ExpectTrue(tr, !laterStepRan.load(), "steps after the failed one are skipped");
+
+    return tr.failures;
+}
+
+/* Test_ContainerReaper_BoundedConcurrency
+ *
+ * Submits four teardowns to a reaper with two workers and verifies no more
+ * than two run at once.
+ */
+uint32_t Test_ContainerReaper_BoundedConcurrency()
+{
+    L0Test::TestResult tr;
+
+    WPEFramework::Plugin::ContainerReaper reaper(ReaperConfig(2), ReaperJournalDir("bounded"));
+    ReaperCompletion completion;
+    std::atomic<uint32_t> running{0};
+    std::atomic<uint32_t> maxRunning{0};
+
+    std::vector<WPEFramework::Plugin::ContainerReaper::Step> steps;
+    steps.push_back({ "stopContainer", [&]() {
+        const uint32_t now = ++running;
+        uint32_t seen = maxRunning.load();
+        while (now > seen && !maxRunning.compare_exchange_weak(seen, now)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        running--;
+        return true;
+    } });
+
+    const char* instances[] = { "app1", "app2", "app3", "app4" };
+    for (const char* instance : instances) {
+        reaper.submit(instance, "{}", steps, completion.function());
+    }
+
+    std::string failedStep;
+    for (const char* instance : instances) {
+        L0Test::ExpectTrue(tr, completion.waitFor(instance, failedStep), "teardown completes");
+    }
+    L0Test::ExpectTrue(tr, maxRunning.load() <= 2u, "no more teardowns than workers run at once");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(reaper.pending()), 0u, "nothing pending");
+
+    return tr.failures;
+}
+
+/* Test_ContainerReaper_ResubmitTakesOverPendingTeardown
+ *
+ * Submits a graceful stop that keeps failing with a long retry delay, then
+ * submits a forced one for the same appInstanceId, as a Kill after a
+ * Terminate does. Verifies the forced stop runs right away, steps that
+ * already succeeded are not run again and the new completion is called.
+ */
+uint32_t Test_ContainerReaper_ResubmitTakesOverPendingTeardown()
+{
+    L0Test::TestResult tr;
+
+    WPEFramework::Plugin::ContainerReaper::Config config = ReaperConfig(1);
+    config.retryDelayMs = 60000;
+    WPEFramework::Plugin::ContainerReaper reaper(config, ReaperJournalDir("takeover"));
+    ReaperCompletion gracefulCompletion;
+    ReaperCompletion forcedCompletion;
+    std::atomic<uint32_t> gracefulAttempts{0};
+    std::atomic<uint32_t> forcedAttempts{0};
+    std::atomic<uint32_t> prepareRuns{0};
+
+    std::vector<WPEFramework::Plugin::ContainerReaper::Step> graceful;
+    graceful.push_back({ "prepare", [&]() { prepareRuns++; return true; } });
+    graceful.push_back({ "stopContainer", [&]() { gracefulAttempts++; return false; } });
+    reaper.submit("youTube", "{\"force\":false}", graceful, gracefulCompletion.function());
+    for (uint32_t waited = 0; gracefulAttempts.load() == 0 && waited < 2000; waited += 5) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+
+    std::vector<WPEFramework::Plugin::ContainerReaper::Step> forced;
+    forced.push_back({ "prepare", [&]() { prepareRuns++; return true; } });
+    forced.push_back({ "stopContainer", [&]() { forcedAttempts++; return true; } });
+    L0Test::ExpectTrue(tr, reaper.submit("youTube", "{\"force\":true}", forced, forcedCompletion.function()),
+                       "pending teardown accepts the forced stop");
+
+    std::string failedStep = "unset";
+    L0Test::ExpectTrue(tr, forcedCompletion.waitFor("youTube", failedStep), "forced teardown completes without the retry delay");
+    L0Test::ExpectEqStr(tr, failedStep, "", "forced teardown succeeded");
+    L0Test::ExpectEqU32(tr, gracefulAttempts.load(), 1u, "graceful stop not retried after the takeover");
+    L0Test::ExpectEqU32(tr, forcedAttempts.load(), 1u, "forced stop ran once");
+    L0Test::ExpectEqU32(tr, prepareRuns.load(), 1u, "finished step not run again");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(reaper.pending()), 0u, "nothing pending");
+
+    return tr.failures;
+}
+
+/* Test_ContainerReaper_UnfinishedTeardownIsJournaled
+ *
+ * Stops a reaper while a teardown is still retrying, as a restart would, and
+ * verifies a new reaper on the same journal reports it with its record.
+ */
+uint32_t Test_ContainerReaper_UnfinishedTeardownIsJournaled()
+{
+    L0Test::TestResult tr;
+
+    const std::string journalDir = ReaperJournalDir("journal");
+    {
+        WPEFramework::Plugin::ContainerReaper::Config config = ReaperConfig(1);
+        config.retryDelayMs = 60000;
+        WPEFramework::Plugin::ContainerReaper reaper(config, journalDir);
+        std::atomic<bool> attempted{false};
+        std::vector<WPEFramework::Plugin::ContainerReaper::Step> steps;
+        steps.push_back({ "stopContainer", [&]() { attempted = true; return false; } });
+        reaper.submit("app/1", "{\"containerId\":\"app/1\"}", steps, nullptr);
+        for (uint32_t waited = 0; !attempted.load() && waited < 2000; waited += 5) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    }
+
+    WPEFramework::Plugin::ContainerReaper restarted(ReaperConfig(1), journalDir);
+    const std::vector<std::pair<std::string, std::string>> unfinished = restarted.unfinished();
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(unfinished.size()), 1u, "one teardown left by the previous run");
+    if (!unfinished.empty()) {
+        L0Test::ExpectEqStr(tr, unfinished[0].first, "app/1", "appInstanceId recovered");
+        L0Test::ExpectEqStr(tr, unfinished[0].second, "{\"containerId\":\"app/1\"}", "record recovered");
+    }
+
+    return tr.failures;
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+//  GStreamerRegistry tests
+// ──────────────────────────────────────────────────────────────────────────────
+
+namespace {
+std::string GstTestDir(const std::string& name)
+{
+    const std::string dir = "/tmp/rm_l0test_gst_" + name + "/";
+    if (ralf::checkIfPathExists(dir)) {
+        ralf::removeDirectoryRecursively(dir);
+    }
+    ralf::create_directories(dir + "plugins");
+    return dir;
+}
+
+// Stand-in for gst-launch-1.0: writes a registry header and counts its runs.
+// The child gets no PATH, so it only uses shell builtins and absolute paths.
+std::string WriteFakeGstLaunch(const std::string& dir, const std::string& extra)
+{
+    const std::string script = dir + "gst-launch-1.0";
+    std::ofstream out(script.c_str());
+    out << "#!/bin/sh\n"
+        << extra
+        << "echo run >> " << dir << "runs\n"
+        << "printf '\\300\\336\\360\\015' > \"$GST_REGISTRY\"\n"
+        << "printf '1.0.0' >> \"$GST_REGISTRY\"\n"
+        << "i=0; while [ $i -lt 59 ]; do printf '\\000' >> \"$GST_REGISTRY\"; i=$((i+1)); done\n"
+        << "printf 'plugins' >> \"$GST_REGISTRY\"\n"
+        << "echo 'gst-launch-1.0 version 1.99.0'\n"
+        << "echo 'GStreamer 1.99.0'\n";
+    out.close();
+    chmod(script.c_str(), 0755);
+    return script;
+}
+
+uint32_t GstLaunchRuns(const std::string& dir)
+{
+    std::ifstream in((dir + "runs").c_str());
+    uint32_t runs = 0;
+    std::string line;
+    while (std::getline(in, line)) {
+        ++runs;
+    }
+    return runs;
+}
+}
+
+/* Test_GStreamerRegistry_RejectsCorruptRegistry
+ *
+ * Verifies only a file with the binary registry magic, version and a body is
+ * accepted for bind-mounting.
+ */
+uint32_t Test_GStreamerRegistry_RejectsCorruptRegistry()
+{
+    L0Test::TestResult tr;
+
+    const std::string dir = GstTestDir("corrupt");
+    const std::string garbage = dir + "garbage.bin";
+    std::ofstream(garbage.c_str()) << "fake gst registry with enough bytes to cover the header of a real one....";
+    L0Test::ExpectTrue(tr, !WPEFramework::Plugin::GStreamerRegistry::isValidRegistry(garbage), "garbage rejected");
+    L0Test::ExpectTrue(tr, !WPEFramework::Plugin::GStreamerRegistry::isValidRegistry(dir + "missing.bin"), "missing file rejected");
+
+    const std::string launcher = WriteFakeGstLaunch(dir, "");
+    WPEFramework::Plugin::GStreamerRegistry registry(launcher, dir + "registry.bin", dir + "plugins");
+    L0Test::ExpectTrue(tr, registry.generate(), "registry generated");
+    L0Test::ExpectTrue(tr, WPEFramework::Plugin::GStreamerRegistry::isValidRegistry(dir + "registry.bin"), "generated registry valid");
+    L0Test::ExpectEqStr(tr, registry.path(), dir + "registry.bin", "validated registry offered for mounting");
+
+    // Truncated to the bare header after validation
+    L0Test::ExpectTrue(tr, truncate((dir + "registry.bin").c_str(), 68) == 0, "registry truncated");
+    L0Test::ExpectTrue(tr, !WPEFramework::Plugin::GStreamerRegistry::isValidRegistry(dir + "registry.bin"), "header-only registry rejected");
+    L0Test::ExpectTrue(tr, registry.path().empty(), "modified registry not offered for mounting");
+
+    return tr.failures;
+}
+
+/* Test_GStreamerRegistry_ReusesRegistryWhenUnchanged
+ *
+ * Verifies a second start reuses the registry without spawning gst-launch,
+ * and that a change in the plugin directory triggers a rebuild.
+ */
+uint32_t Test_GStreamerRegistry_ReusesRegistryWhenUnchanged()
+{
+    L0Test::TestResult tr;
+
+    const std::string dir = GstTestDir("reuse");
+    const std::string launcher = WriteFakeGstLaunch(dir, "");
+    {
+        WPEFramework::Plugin::GStreamerRegistry registry(launcher, dir + "registry.bin", dir + "plugins");
+        L0Test::ExpectTrue(tr, registry.generate(), "first start generates");
+    }
+    {
+        WPEFramework::Plugin::GStreamerRegistry registry(launcher, dir + "registry.bin", dir + "plugins");
+        L0Test::ExpectTrue(tr, registry.generate(), "second start succeeds");
+        L0Test::ExpectEqStr(tr, registry.path(), dir + "registry.bin", "reused registry offered for mounting");
+    }
+    L0Test::ExpectEqU32(tr, GstLaunchRuns(dir), 1u, "gst-launch spawned once");
+
+    std::ofstream((dir + "plugins/libgstnew.so").c_str()) << "plugin";
+    {
+        WPEFramework::Plugin::GStreamerRegistry registry(launcher, dir + "registry.bin", dir + "plugins");
+        L0Test::ExpectTrue(tr, registry.generate(), "start after plugin change succeeds");
+    }
+    L0Test::ExpectEqU32(tr, GstLaunchRuns(dir), 2u, "plugin change regenerates the registry");
+
+    return tr.failures;
+}
+
+/* Test_GStreamerRegistry_StartDoesNotBlock
+ *
+ * Verifies start() returns while gst-launch is still running, that nothing is
+ * offered for mounting meanwhile, and that stop() kills the child.
+ */
+uint32_t Test_GStreamerRegistry_StartDoesNotBlock()
+{
+    L0Test::TestResult tr;
+
+    const std::string dir = GstTestDir("async");
+    const std::string launcher = WriteFakeGstLaunch(dir, "echo started > " + dir + "started\n/bin/sleep 30\n");
+    WPEFramework::Plugin::GStreamerRegistry registry(launcher, dir + "registry.bin", dir + "plugins");
+
+    const auto begin = std::chrono::steady_clock::now();
+    registry.start();
+    for (uint32_t waited = 0; access((dir + "started").c_str(), F_OK) != 0 && waited < 2000; waited += 5) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    L0Test::ExpectTrue(tr, access((dir + "started").c_str(), F_OK) == 0, "gst-launch running");
+    L0Test::ExpectTrue(tr, registry.path().empty(), "no registry while the check runs");
+    registry.stop();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin).count();
+
+    L0Test::ExpectTrue(tr, elapsed < 5000, "start and stop do not wait for gst-launch");
+    L0Test::ExpectTrue(tr, registry.path().empty(), "killed check leaves no registry");
+    L0Test::ExpectEqU32(tr, GstLaunchRuns(dir), 0u, "killed child never wrote a registry");
+
+    return tr.failures;
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+//  CgroupStatsSampler tests
+// ──────────────────────────────────────────────────────────────────────────────
+
+namespace {
+std::string CgroupTestRoot(const std::string& name)
+{
+    const std::string root = "/tmp/rm_l0test_cgroup_" + name;
+    if (ralf::checkIfPathExists(root)) {
+        ralf::removeDirectoryRecursively(root);
+    }
+    return root;
+}
+
+void WriteCgroupFile(const std::string& root, const std::string& controller, const std::string& containerId,
+                     const std::string& file, const std::string& content)
+{
+    const std::string dir = root + "/" + controller + "/" + containerId;
+    ralf::create_directories(dir);
+    // Rewritten in place so the sampler's cached fd sees the new content
+    std::ofstream out((dir + "/" + file).c_str(), std::ios::trunc);
+    out << content;
+}
+
+void WriteSyntheticContainer(const std::string& root, const std::string& containerId, uint64_t memoryUsage, bool withGpu)
+{
+    WriteCgroupFile(root, "memory", containerId, "memory.usage_in_bytes", std::to_string(memoryUsage) + "\n");
+    WriteCgroupFile(root, "memory", containerId, "memory.limit_in_bytes", "209715200\n");
+    WriteCgroupFile(root, "memory", containerId, "memory.max_usage_in_bytes", "104857600\n");
+    WriteCgroupFile(root, "memory", containerId, "memory.failcnt", "2\n");
+    WriteCgroupFile(root, "memory", containerId, "memory.stat", "cache 4096\nrss 8192\nmapped_file 0\n");
+    WriteCgroupFile(root, "memory", containerId, "cgroup.procs", "101\n102\n");
+    WriteCgroupFile(root, "cpuacct", containerId, "cpuacct.usage", "5000\n");
+    WriteCgroupFile(root, "cpuacct", containerId, "cpuacct.usage_percpu", "2000 3000 \n");
+    WriteCgroupFile(root, "freezer", containerId, "freezer.state", "THAWED\n");
+    if (withGpu) {
+        WriteCgroupFile(root, "gpu", containerId, "gpu.usage_in_bytes", "1024\n");
+        WriteCgroupFile(root, "gpu", containerId, "gpu.limit_in_bytes", "65536\n");
+        WriteCgroupFile(root, "gpu", containerId, "gpu.max_usage_in_bytes", "2048\n");
+        WriteCgroupFile(root, "gpu", containerId, "gpu.failcnt", "0\n");
+    }
+}
+
+WPEFramework::Plugin::CgroupStatsSampler::Config SamplerConfig(const std::string& root, uint32_t intervalMs)
+{
+    WPEFramework::Plugin::CgroupStatsSampler::Config config;
+    config.cgroupRoot = root;
+    config.intervalMs = intervalMs;
+    return config;
+}
+
+bool ParseInfo(const std::string& info, Json::Value& root)
+{
+    Json::Reader reader;
+    return reader.parse(info, root) && root.isObject();
+}
+}
+
+/* Test_CgroupStatsSampler_ReadsSyntheticCgroupTree
+ *
+ * Points the sampler at a synthetic cgroup tree and verifies the sample has
+ * the GetContainerInfo layout and the values from the files.
+ */
+uint32_t Test_CgroupStatsSampler_ReadsSyntheticCgroupTree()
+{
+    L0Test::TestResult tr;
+
+    const std::string root = CgroupTestRoot("tree");
+    WriteSyntheticContainer(root, "youTube", 52428800, true);
+    WriteSyntheticContainer(root, "netflix", 1000, false);
+
+    WPEFramework::Plugin::CgroupStatsSampler sampler(SamplerConfig(root, 1000));
+    std::string info;
+    sampler.addContainer("youTube");
+    sampler.addContainer("netflix");
+    L0Test::ExpectTrue(tr, !sampler.getInfo("youTube", info), "no sample before the first pass");
+    sampler.sampleNow();
+
+    Json::Value stats;
+    L0Test::ExpectTrue(tr, sampler.getInfo("youTube", info) && ParseInfo(info, stats), "sample is JSON");
+    L0Test::ExpectEqStr(tr, stats["id"].asString(), "youTube", "id");
+    L0Test::ExpectEqStr(tr, stats["state"].asString(), "running", "state from freezer");
+    L0Test::ExpectTrue(tr, stats["memory"]["user"]["usage"].asUInt64() == 52428800u, "memory usage");
+    L0Test::ExpectTrue(tr, stats["memory"]["user"]["limit"].asUInt64() == 209715200u, "memory limit");
+    L0Test::ExpectTrue(tr, stats["memory"]["user"]["maxUsage"].asUInt64() == 104857600u, "memory max usage");
+    L0Test::ExpectTrue(tr, stats["memory"]["user"]["failcnt"].asUInt64() == 2u, "memory failcnt");
+    L0Test::ExpectTrue(tr, stats["memory"]["stat"]["rss"].asUInt64() == 8192u, "memory.stat counter");
+    L0Test::ExpectTrue(tr, stats["cpu"]["usage"]["total"].asUInt64() == 5000u, "cpu total");
+    L0Test::ExpectEqU32(tr, stats["cpu"]["usage"]["percpu"].size(), 2u, "per cpu usage");
+    L0Test::ExpectTrue(tr, stats["gpu"]["memory"]["usage"].asUInt64() == 1024u, "gpu usage");
+    L0Test::ExpectEqU32(tr, stats["pids"].size(), 2u, "pids");
+
+    L0Test::ExpectTrue(tr, sampler.getInfo("netflix", info) && ParseInfo(info, stats), "second container sampled");
+    L0Test::ExpectTrue(tr, !stats.isMember("gpu"), "no gpu object without a gpu cgroup");
+    L0Test::ExpectTrue(tr, !sampler.getInfo("amazon", info), "unknown container has no sample");
+
+    return tr.failures;
+}
+
+/* Test_CgroupStatsSampler_RereadsCachedFiles
+ *
+ * Verifies a later pass picks up changed values through the fds opened on the
+ * first one, that a frozen cgroup reports paused, and that removed or missing
+ * containers have no sample.
+ */
+uint32_t Test_CgroupStatsSampler_RereadsCachedFiles()
+{
+    L0Test::TestResult tr;
+
+    const std::string root = CgroupTestRoot("reread");
+    WriteSyntheticContainer(root, "youTube", 1000, false);
+
+    WPEFramework::Plugin::CgroupStatsSampler sampler(SamplerConfig(root, 1000));
+    sampler.addContainer("youTube");
+    sampler.addContainer("notStartedYet");
+    sampler.sampleNow();
+
+    WriteCgroupFile(root, "memory", "youTube", "memory.usage_in_bytes", "2000\n");
+    WriteCgroupFile(root, "freezer", "youTube", "freezer.state", "FROZEN\n");
+    std::string info;
+    Json::Value stats;
+    L0Test::ExpectTrue(tr, sampler.getInfo("youTube", info) && ParseInfo(info, stats), "previous sample served");
+    L0Test::ExpectTrue(tr, stats["memory"]["user"]["usage"].asUInt64() == 1000u, "readers see the previous sample until the next pass");
+
+    sampler.sampleNow();
+    L0Test::ExpectTrue(tr, sampler.getInfo("youTube", info) && ParseInfo(info, stats), "new sample served");
+    L0Test::ExpectTrue(tr, stats["memory"]["user"]["usage"].asUInt64() == 2000u, "new value read through the cached fd");
+    L0Test::ExpectEqStr(tr, stats["state"].asString(), "paused", "frozen cgroup reports paused");
+
+    L0Test::ExpectTrue(tr, !sampler.getInfo("notStartedYet", info), "container without a cgroup has no sample");
+    WriteSyntheticContainer(root, "notStartedYet", 3000, false);
+    sampler.sampleNow();
+    L0Test::ExpectTrue(tr, sampler.getInfo("notStartedYet", info), "cgroup created later is picked up");
+
+    sampler.removeContainer("youTube");
+    L0Test::ExpectTrue(tr, !sampler.getInfo("youTube", info), "removed container has no sample");
+    sampler.sampleNow();
+    L0Test::ExpectTrue(tr, !sampler.getInfo("youTube", info), "removed container stays without sample");
+
+    return tr.failures;
+}
+
+/* Test_CgroupStatsSampler_SamplesPeriodically
+ *
+ * Verifies the background thread keeps the sample current while readers
+ * query it concurrently.
+ */
+uint32_t Test_CgroupStatsSampler_SamplesPeriodically()
+{
+    L0Test::TestResult tr;
+
+    const std::string root = CgroupTestRoot("periodic");
+    WriteSyntheticContainer(root, "youTube", 1000, false);
+
+    WPEFramework::Plugin::CgroupStatsSampler sampler(SamplerConfig(root, 10));
+    sampler.start();
+    sampler.addContainer("youTube");
+
+    std::atomic<bool> done{false};
+    std::atomic<uint32_t> reads{0};
+    std::thread reader([&]() {
+        std::string info;
+        while (!done.load()) {
+            if (sampler.getInfo("youTube", info)) {
+                ++reads;
+            }
+        }
+    });
+
+    std::string info;
+    for (uint32_t waited = 0; !sampler.getInfo("youTube", info) && waited < 2000; waited += 5) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    WriteCgroupFile(root, "memory", "youTube", "memory.usage_in_bytes", "4000\n");
+
+    Json::Value stats;
+    bool updated = false;
+    for (uint32_t waited = 0; !updated && waited < 2000; waited += 5) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        updated = sampler.getInfo("youTube", info) && ParseInfo(info, stats) &&
+                  (stats["memory"]["user"]["usage"].asUInt64() == 4000u);
+    }
+    done = true;
+    reader.join();
+    sampler.stop();
+
+    L0Test::ExpectTrue(tr, updated, "background pass picked up the new value");
+    L0Test::ExpectTrue(tr, reads.load() > 0, "readers were served while sampling");
+
+    return tr.failures;
+}
+
 // ──────────────────────────────────────────────────────────────────────────────
 //  AIConfiguration tests
 // ──────────────────────────────────────────────────────────────────────────────
@@ -2179,3 +2824,675 @@ uint32_t Test_DobbySpecGenerator_RialtoPrefixedSocketPathUsedInSpec()
     return tr.failures;
 }
 #endif // ENABLE_RIALTO
+
+// ──────────────────────────────────────────────────────────────────────────────
+//  DobbySpecGenerator – spec template cache
+// ──────────────────────────────────────────────────────────────────────────────
+
+namespace {
+/* Helper: launch inputs of one instance of the same app. */
+void MakeInstanceConfig(const uint32_t index,
+                        WPEFramework::Plugin::ApplicationConfiguration& appCfg,
+                        WPEFramework::Exchange::RuntimeConfig& rtCfg)
+{
+    appCfg = MakeValidAppConfig();
+    appCfg.mAppInstanceId = "youTube-" + std::to_string(index);
+    appCfg.mUserId        = 30001u + (index % 100u);
+    appCfg.mRialtoSocketPath = ((index % 2u) == 0u) ? ("/tmp/rialto-" + std::to_string(index)) : "";
+    rtCfg = MakeValidRuntimeConfig();
+    rtCfg.capabilities = "wan-lan,thunder,local-services-2";
+    switch (index % 3u) {
+    case 0u: rtCfg.envVariables = "[]"; break;
+    case 1u: rtCfg.envVariables = "[\"LAUNCH_ID=" + std::to_string(index) + "\"]"; break;
+    default: rtCfg.envVariables = "[\"A=\\\"quoted\\\"\",\"B=/path/" + std::to_string(index) + "\"]"; break;
+    }
+}
+}
+
+/* Test_DobbySpecGenerator_TemplateCacheMatchesFullBuild
+ *
+ * Verifies that specs patched from a cached template are byte-identical to
+ * specs built from scratch for instances that differ in appInstanceId, uid,
+ * env and Rialto socket, and that one template serves all of them while a
+ * different capability set gets its own template.
+ */
+uint32_t Test_DobbySpecGenerator_TemplateCacheMatchesFullBuild()
+{
+    L0Test::TestResult tr;
+
+    WPEFramework::Plugin::DobbySpecTemplateCache cache;
+    uint32_t mismatches = 0;
+    for (uint32_t i = 0; i < 6u; i++) {
+        WPEFramework::Plugin::ApplicationConfiguration appCfg;
+        WPEFramework::Exchange::RuntimeConfig rtCfg;
+        MakeInstanceConfig(i, appCfg, rtCfg);
+
+        std::string fullSpec;
+        std::string cachedSpec;
+        WPEFramework::Plugin::DobbySpecGenerator fullGen(GetAIConfigurationFixture());
+        WPEFramework::Plugin::DobbySpecGenerator cachedGen(GetAIConfigurationFixture());
+        cachedGen.setTemplateCache(&cache);
+        L0Test::ExpectTrue(tr, fullGen.generate(appCfg, rtCfg, fullSpec), "full build succeeds");
+        L0Test::ExpectTrue(tr, cachedGen.generate(appCfg, rtCfg, cachedSpec), "cached build succeeds");
+        if (fullSpec != cachedSpec) {
+            std::cerr << "full:   " << fullSpec << "cached: " << cachedSpec;
+            mismatches++;
+        }
+        L0Test::ExpectTrue(tr, cachedSpec.find("@RM_TEMPLATE_") == std::string::npos,
+                           "no template placeholder is left in the spec");
+    }
+    L0Test::ExpectEqU32(tr, mismatches, 0u, "cached specs match full builds");
+    // Instances with and without a Rialto session shape the spec differently
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(cache.size()), 2u,
+                        "one template per Rialto/non-Rialto variant of the app");
+
+    WPEFramework::Plugin::ApplicationConfiguration appCfg;
+    WPEFramework::Exchange::RuntimeConfig rtCfg;
+    MakeInstanceConfig(1u, appCfg, rtCfg);
+    rtCfg.capabilities = "thunder";
+    std::string spec;
+    WPEFramework::Plugin::DobbySpecGenerator gen(GetAIConfigurationFixture());
+    gen.setTemplateCache(&cache);
+    L0Test::ExpectTrue(tr, gen.generate(appCfg, rtCfg, spec), "cached build with other capabilities succeeds");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(cache.size()), 3u,
+                        "a different capability set gets its own template");
+
+    cache.clear();
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(cache.size()), 0u, "clear() drops all templates");
+
+    return tr.failures;
+}
+
+/* Test_DobbySpecGenerator_TemplateCacheFixesResourceSocketPerLaunch
+ *
+ * Verifies that a launch from a cached template still checks the resource
+ * manager socket and hands it to the app's group, after another app with a
+ * different gid took it over, and leaves the mount out once the socket is gone.
+ */
+uint32_t Test_DobbySpecGenerator_TemplateCacheFixesResourceSocketPerLaunch()
+{
+    L0Test::TestResult tr;
+
+    const std::string socketPath = "/tmp/rm_l0test_resource_socket";
+    {
+        std::ofstream socketFile(socketPath);
+    }
+    chmod(socketPath.c_str(), 0600);
+
+    // Any gid works as root; otherwise use groups the test process belongs to
+    gid_t firstGid = getegid();
+    gid_t otherGid = firstGid;
+    if (0 == geteuid()) {
+        firstGid = 30000u;
+        otherGid = 30001u;
+    } else {
+        gid_t groups[64];
+        const int count = getgroups(64, groups);
+        for (int i = 0; i < count; i++) {
+            if (groups[i] != firstGid) {
+                otherGid = groups[i];
+                break;
+            }
+        }
+    }
+
+    WPEFramework::Plugin::DobbySpecTemplateCache cache;
+    auto launch = [&](const std::string& appId, gid_t gid, std::string& spec) {
+        WPEFramework::Plugin::ApplicationConfiguration appCfg = MakeValidAppConfig();
+        appCfg.mAppId = appId;
+        appCfg.mGroupId = gid;
+        WPEFramework::Exchange::RuntimeConfig rtCfg = MakeValidRuntimeConfig();
+        WPEFramework::Plugin::DobbySpecGenerator gen(GetAIConfigurationFixture());
+        gen.setResourceManagerSocketPath(socketPath);
+        gen.setTemplateCache(&cache);
+        return gen.generate(appCfg, rtCfg, spec);
+    };
+    auto socketGid = [&]() {
+        struct stat details;
+        return (0 == stat(socketPath.c_str(), &details)) ? details.st_gid : static_cast<gid_t>(-1);
+    };
+    auto socketMode = [&]() {
+        struct stat details;
+        return (0 == stat(socketPath.c_str(), &details)) ? (details.st_mode & 0777) : 0u;
+    };
+
+    std::string spec;
+    L0Test::ExpectTrue(tr, launch("com.test.resmgr.first", firstGid, spec), "first launch builds the template");
+    L0Test::ExpectTrue(tr, spec.find("\"source\":\"" + socketPath + "\"") != std::string::npos,
+                       "the resource socket is bind mounted");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(socketGid()), static_cast<uint32_t>(firstGid),
+                        "the socket belongs to the first app's group");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(socketMode()), 0770u, "the socket is group accessible");
+
+    WPEFramework::Plugin::ApplicationConfiguration fullCfg = MakeValidAppConfig();
+    fullCfg.mAppId = "com.test.resmgr.first";
+    fullCfg.mGroupId = firstGid;
+    std::string fullSpec;
+    WPEFramework::Plugin::DobbySpecGenerator fullGen(GetAIConfigurationFixture());
+    fullGen.setResourceManagerSocketPath(socketPath);
+    L0Test::ExpectTrue(tr, fullGen.generate(fullCfg, MakeValidRuntimeConfig(), fullSpec), "full build succeeds");
+    L0Test::ExpectTrue(tr, fullSpec == spec, "the patched spec matches a full build");
+
+    L0Test::ExpectTrue(tr, launch("com.test.resmgr.other", otherGid, spec), "another app launches with its own gid");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(socketGid()), static_cast<uint32_t>(otherGid),
+                        "the socket now belongs to the other app's group");
+    chmod(socketPath.c_str(), 0600);
+
+    L0Test::ExpectTrue(tr, launch("com.test.resmgr.first", firstGid, spec), "relaunch from the cached template");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(cache.size()), 2u, "the relaunch reused the first template");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(socketGid()), static_cast<uint32_t>(firstGid),
+                        "the relaunch hands the socket back to the first app's group");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(socketMode()), 0770u, "the relaunch restores the socket mode");
+
+    unlink(socketPath.c_str());
+    L0Test::ExpectTrue(tr, launch("com.test.resmgr.first", firstGid, spec), "relaunch without the socket");
+    L0Test::ExpectTrue(tr, spec.find(socketPath) == std::string::npos,
+                       "a missing socket is not mounted from the cached template");
+    L0Test::ExpectTrue(tr, spec.find("@RM_TEMPLATE_") == std::string::npos,
+                       "no template placeholder is left in the spec");
+    Json::Value parsed;
+    Json::Reader reader;
+    L0Test::ExpectTrue(tr, reader.parse(spec, parsed) && parsed["mounts"].isArray(),
+                       "the spec stays valid JSON without the mount");
+
+    return tr.failures;
+}
+
+/* Test_DobbySpecGenerator_TemplateCacheBenchmark
+ *
+ * Per-launch generate() cost with a fresh generator per launch, as
+ * RuntimeManagerImplementation does, with and without the template cache.
+ * Timings are reported; only correctness is asserted.
+ */
+uint32_t Test_DobbySpecGenerator_TemplateCacheBenchmark()
+{
+    L0Test::TestResult tr;
+
+    const uint32_t launches = 500u;
+    WPEFramework::Plugin::DobbySpecTemplateCache cache;
+    uint32_t failures = 0;
+    size_t fullBytes = 0;
+    size_t cachedBytes = 0;
+
+    const auto fullStart = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < launches; i++) {
+        WPEFramework::Plugin::ApplicationConfiguration appCfg;
+        WPEFramework::Exchange::RuntimeConfig rtCfg;
+        MakeInstanceConfig(i, appCfg, rtCfg);
+        std::string spec;
+        WPEFramework::Plugin::DobbySpecGenerator gen(GetAIConfigurationFixture());
+        failures += gen.generate(appCfg, rtCfg, spec) ? 0u : 1u;
+        fullBytes += spec.size();
+    }
+    const auto fullUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - fullStart).count();
+
+    const auto cachedStart = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < launches; i++) {
+        WPEFramework::Plugin::ApplicationConfiguration appCfg;
+        WPEFramework::Exchange::RuntimeConfig rtCfg;
+        MakeInstanceConfig(i, appCfg, rtCfg);
+        std::string spec;
+        WPEFramework::Plugin::DobbySpecGenerator gen(GetAIConfigurationFixture());
+        gen.setTemplateCache(&cache);
+        failures += gen.generate(appCfg, rtCfg, spec) ? 0u : 1u;
+        cachedBytes += spec.size();
+    }
+    const auto cachedUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - cachedStart).count();
+
+    std::cout << "  DobbySpecGenerator::generate() per launch: full build "
+              << (fullUs / launches) << " us, template cache "
+              << (cachedUs / launches) << " us (" << launches << " launches)" << std::endl;
+
+    L0Test::ExpectEqU32(tr, failures, 0u, "all launches generate a spec");
+    L0Test::ExpectTrue(tr, fullBytes == cachedBytes, "cached specs have the same total size as full builds");
+
+    return tr.failures;
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+//  LaunchProfileCache
+// ──────────────────────────────────────────────────────────────────────────────
+
+/* Test_LaunchProfileCache_SkipsReparsing
+ *
+ * Verifies that repeated launches of the same app version reuse one profile
+ * instead of parsing it again, and that a changed RuntimeConfig, a new
+ * package path or invalidate() gets a freshly built profile.
+ */
+uint32_t Test_LaunchProfileCache_SkipsReparsing()
+{
+    L0Test::TestResult tr;
+
+    WPEFramework::Plugin::LaunchProfileCache cache;
+    WPEFramework::Plugin::AIConfiguration* aiConfig = &GetAIConfigurationFixture();
+    WPEFramework::Exchange::RuntimeConfig rtCfg = MakeValidRuntimeConfig();
+    rtCfg.capabilities = "wan-lan,thunder,rialto,home-app";
+    rtCfg.envVariables = "[\"A=1\",\"B=2\"]";
+    rtCfg.unpackedPath = "/media/apps/youTube/1.0";
+
+    auto first = cache.get("youTube", rtCfg, aiConfig);
+    for (uint32_t i = 0; i < 10u; i++) {
+        auto again = cache.get("youTube", rtCfg, aiConfig);
+        L0Test::ExpectTrue(tr, again == first, "same inputs return the cached profile");
+    }
+    L0Test::ExpectEqU32(tr, cache.buildCount(), 1u, "profile parsed once for repeated launches");
+
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(first->capabilities.size()), 4u, "capabilities are parsed");
+    L0Test::ExpectTrue(tr, first->requiresRialto, "rialto capability is detected");
+    L0Test::ExpectTrue(tr, !first->windowManagerCapabilities.empty(), "window manager capabilities are derived");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(first->envVariables.size()), 2u, "env list is parsed");
+    L0Test::ExpectTrue(tr, first->sysMemoryLimit > 0, "memory limit is resolved");
+    L0Test::ExpectTrue(tr, !first->cpuCores.empty(), "cpuset is resolved");
+
+    WPEFramework::Exchange::RuntimeConfig otherCaps(rtCfg);
+    otherCaps.capabilities = "thunder";
+    auto changed = cache.get("youTube", otherCaps, aiConfig);
+    L0Test::ExpectTrue(tr, changed != first, "changed capabilities build a new profile");
+    L0Test::ExpectTrue(tr, !changed->requiresRialto, "new profile reflects the new capabilities");
+
+    WPEFramework::Exchange::RuntimeConfig newVersion(rtCfg);
+    newVersion.unpackedPath = "/media/apps/youTube/2.0";
+    cache.get("youTube", newVersion, aiConfig);
+    L0Test::ExpectEqU32(tr, cache.buildCount(), 3u, "a new package path builds a new profile");
+
+    cache.get("netflix", rtCfg, aiConfig);
+    cache.invalidate("youTube");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(cache.size()), 1u, "invalidate() drops every profile of the app only");
+    auto rebuilt = cache.get("youTube", rtCfg, aiConfig);
+    L0Test::ExpectTrue(tr, rebuilt != first, "profile is rebuilt after invalidate()");
+    L0Test::ExpectEqU32(tr, cache.buildCount(), 5u, "invalidate() forces one rebuild");
+
+    cache.clear();
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(cache.size()), 0u, "clear() drops all profiles");
+
+    return tr.failures;
+}
+
+/* Test_LaunchProfileCache_SpecMatchesUncachedBuild
+ *
+ * Verifies that specs generated from a cached launch profile, with and
+ * without the template cache, are byte-identical to specs derived from the
+ * RuntimeConfig alone.
+ */
+uint32_t Test_LaunchProfileCache_SpecMatchesUncachedBuild()
+{
+    L0Test::TestResult tr;
+
+    WPEFramework::Plugin::LaunchProfileCache profiles;
+    WPEFramework::Plugin::DobbySpecTemplateCache templates;
+    uint32_t mismatches = 0;
+    for (uint32_t i = 0; i < 6u; i++) {
+        WPEFramework::Plugin::ApplicationConfiguration appCfg;
+        WPEFramework::Exchange::RuntimeConfig rtCfg;
+        MakeInstanceConfig(i, appCfg, rtCfg);
+        auto profile = profiles.get(appCfg.mAppId, rtCfg, &GetAIConfigurationFixture());
+
+        std::string plainSpec;
+        std::string profileSpec;
+        std::string templateSpec;
+        WPEFramework::Plugin::DobbySpecGenerator plainGen(GetAIConfigurationFixture());
+        WPEFramework::Plugin::DobbySpecGenerator profileGen(GetAIConfigurationFixture());
+        profileGen.setLaunchProfile(profile.get());
+        WPEFramework::Plugin::DobbySpecGenerator templateGen(GetAIConfigurationFixture());
+        templateGen.setLaunchProfile(profile.get());
+        templateGen.setTemplateCache(&templates);
+        L0Test::ExpectTrue(tr, plainGen.generate(appCfg, rtCfg, plainSpec), "build without profile succeeds");
+        L0Test::ExpectTrue(tr, profileGen.generate(appCfg, rtCfg, profileSpec), "build with profile succeeds");
+        L0Test::ExpectTrue(tr, templateGen.generate(appCfg, rtCfg, templateSpec), "templated build with profile succeeds");
+        if ((plainSpec != profileSpec) || (plainSpec != templateSpec)) {
+            std::cerr << "plain:    " << plainSpec << "profile:  " << profileSpec << "template: " << templateSpec;
+            mismatches++;
+        }
+    }
+    L0Test::ExpectEqU32(tr, mismatches, 0u, "specs from a launch profile match uncached builds");
+
+    return tr.failures;
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+//  OCIJsonWriter
+// ──────────────────────────────────────────────────────────────────────────────
+
+#ifndef L0_GOLDEN_DIR
+#define L0_GOLDEN_DIR "RuntimeManager/golden"
+#endif
+
+namespace {
+/* Helper: reads a file under the golden directory byte for byte. */
+bool ReadGoldenFile(const std::string& name, std::string& content)
+{
+    std::ifstream in(std::string(L0_GOLDEN_DIR) + "/" + name, std::ios::in | std::ios::binary);
+    if (!in.is_open()) {
+        return false;
+    }
+    content.assign((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    return true;
+}
+
+/* Helper: checks that <name>.input.json serializes to exactly <name>.expected.json. */
+void ExpectGoldenOutput(L0Test::TestResult& tr, const std::string& name, Json::Value& document)
+{
+    std::string input;
+    std::string expected;
+    const bool haveFiles = ReadGoldenFile(name + ".input.json", input) &&
+                           ReadGoldenFile(name + ".expected.json", expected);
+    L0Test::ExpectTrue(tr, haveFiles, (name + " golden files are readable").c_str());
+    if (!haveFiles) {
+        return;
+    }
+    Json::Reader reader;
+    L0Test::ExpectTrue(tr, reader.parse(input, document), (name + " input parses").c_str());
+
+    const std::string output = WPEFramework::Plugin::OCIJsonWriter::write(document);
+    L0Test::ExpectTrue(tr, output == expected, (name + " output matches the golden file").c_str());
+    Json::FastWriter fastWriter;
+    L0Test::ExpectTrue(tr, output == fastWriter.write(document),
+                       (name + " output matches Json::FastWriter").c_str());
+}
+}
+
+/* Test_OCIJsonWriter_GoldenDobbySpec
+ *
+ * Verifies that a representative Dobby spec serializes byte for byte to the
+ * golden output, which is what Json::FastWriter produced for it.
+ */
+uint32_t Test_OCIJsonWriter_GoldenDobbySpec()
+{
+    L0Test::TestResult tr;
+
+    Json::Value document;
+    ExpectGoldenOutput(tr, "dobby_spec", document);
+
+    return tr.failures;
+}
+
+/* Test_OCIJsonWriter_StreamingMatchesDocument
+ *
+ * Verifies that a document streamed member by member equals the serialized
+ * Json::Value, and that strings needing escapes, UTF-8, embedded NULs and
+ * empty containers are written exactly as Json::FastWriter writes them.
+ */
+uint32_t Test_OCIJsonWriter_StreamingMatchesDocument()
+{
+    L0Test::TestResult tr;
+
+    const std::string withNul("nul\0inside", 10);
+    Json::Value document(Json::objectValue);
+    document["args"].append("/usr/bin/app");
+    document["args"].append("--title=\"quoted\" \\ tab\t");
+    document["env"] = Json::Value(Json::arrayValue);
+    document["memLimit"] = static_cast<Json::UInt64>(41943040u);
+    document["offset"] = -1;
+    document["ratio"] = 0.25;
+    document["rdkPlugins"] = Json::Value(Json::objectValue);
+    document["seccomp"] = Json::Value::null;
+    document["strings"].append("caf\xc3\xa9");
+    document["strings"].append("bell\x07");
+    document["strings"].append(Json::Value(withNul.data(), withNul.data() + withNul.size()));
+    document["strings"].append("");
+    document["userNs"] = true;
+
+    WPEFramework::Plugin::OCIJsonWriter writer(256);
+    writer.beginObject();
+    writer.key("args");
+    writer.beginArray();
+    writer.value("/usr/bin/app");
+    writer.value(std::string("--title=\"quoted\" \\ tab\t"));
+    writer.endArray();
+    writer.key("env");
+    writer.beginArray();
+    writer.endArray();
+    writer.key("memLimit");
+    writer.value(static_cast<uint64_t>(41943040u));
+    writer.key("offset");
+    writer.value(-1);
+    writer.key("ratio");
+    writer.value(0.25);
+    writer.key("rdkPlugins");
+    writer.beginObject();
+    writer.endObject();
+    writer.key("seccomp");
+    writer.null();
+    writer.key("strings");
+    writer.value(document["strings"]);
+    writer.key("userNs");
+    writer.value(true);
+    writer.endObject();
+
+    Json::FastWriter fastWriter;
+    const std::string expected = fastWriter.write(document);
+    L0Test::ExpectTrue(tr, writer.finish() == expected, "streamed document matches Json::FastWriter");
+    L0Test::ExpectTrue(tr, WPEFramework::Plugin::OCIJsonWriter::write(document) == expected,
+                       "serialized document matches Json::FastWriter");
+
+    writer.clear();
+    writer.value(document);
+    L0Test::ExpectTrue(tr, writer.finish() == expected, "writer is reusable after clear()");
+
+    return tr.failures;
+}
+
+/* Test_OCIJsonWriter_Benchmark
+ *
+ * Serialization throughput of the golden Dobby spec with Json::FastWriter and
+ * with OCIJsonWriter. Timings are reported; only correctness is asserted.
+ */
+uint32_t Test_OCIJsonWriter_Benchmark()
+{
+    L0Test::TestResult tr;
+
+    std::string input;
+    Json::Value document;
+    Json::Reader reader;
+    if (!ReadGoldenFile("dobby_spec.input.json", input) || !reader.parse(input, document)) {
+        L0Test::ExpectTrue(tr, false, "golden Dobby spec is readable");
+        return tr.failures;
+    }
+
+    const uint32_t iterations = 5000u;
+    size_t fastBytes = 0;
+    size_t streamBytes = 0;
+
+    const auto fastStart = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        Json::FastWriter fastWriter;
+        fastBytes += fastWriter.write(document).size();
+    }
+    const auto fastUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - fastStart).count();
+
+    const auto streamStart = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        streamBytes += WPEFramework::Plugin::OCIJsonWriter::write(document).size();
+    }
+    const auto streamUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - streamStart).count();
+
+    const auto throughput = [](size_t bytes, long long us) {
+        return (us > 0) ? (static_cast<double>(bytes) / static_cast<double>(us)) : 0.0;
+    };
+    std::cout << "  OCI spec serialization (" << iterations << " specs): Json::FastWriter "
+              << throughput(fastBytes, fastUs) << " MB/s, OCIJsonWriter "
+              << throughput(streamBytes, streamUs) << " MB/s" << std::endl;
+
+    L0Test::ExpectTrue(tr, fastBytes == streamBytes, "both writers produce the same amount of output");
+
+    return tr.failures;
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+//  DobbySpecModel
+// ──────────────────────────────────────────────────────────────────────────────
+
+namespace {
+/* Helper: a spec model with every optional section and mount kind filled in. */
+WPEFramework::Plugin::DobbySpecModel MakeFullSpecModel()
+{
+    WPEFramework::Plugin::DobbySpecModel spec;
+    spec.args.push_back("/package/app --title=\"quoted\"");
+    spec.console = true;
+    spec.consoleLimit = 65536u;
+    spec.consolePath = "/tmp/app.log";
+    spec.cpuCores = "0,1";
+    spec.cwd = "/package";
+    spec.systemDbus = true;
+    spec.env.push_back("APPLICATION_NAME=caf\xc3\xa9");
+    spec.env.push_back("TAB=\t");
+    spec.etcHosts.push_back("127.0.0.1\tlocalhost");
+    spec.etcServices.push_back("http\t\t80/tcp\t\twww");
+    spec.gpu = true;
+    spec.gpuMemLimit = -1;
+    spec.memLimit = 134217728;
+
+    WPEFramework::Plugin::DobbySpecMount bind;
+    bind.source = "/etc/ssl/certs";
+    bind.destination = "/etc/ssl/certs";
+    bind.type = "bind";
+    bind.options = { "bind", "ro" };
+    spec.mounts.push_back(bind);
+    spec.mounts.push_back(WPEFramework::Plugin::DobbySpecMount());
+    WPEFramework::Plugin::DobbySpecMount loop;
+    loop.source = "/data/private.img";
+    loop.destination = "/home/private";
+    loop.type = "loop";
+    loop.fstype = "ext4";
+    spec.mounts.push_back(loop);
+    WPEFramework::Plugin::DobbySpecMount placeholder;
+    placeholder.placeholder = "@MOUNT@";
+    spec.mounts.push_back(placeholder);
+
+    spec.network = "nat";
+    spec.ethanLogLevels = { "fatal", "milestone" };
+    spec.openCdm = true;
+    spec.ionDefaultLimit = 268435456u;
+    spec.ionHeaps.push_back(std::make_pair(std::string("system"), static_cast<uint64_t>(1048576u)));
+    spec.ionHeaps.push_back(std::make_pair(std::string("cma"), static_cast<uint64_t>(0u)));
+    spec.minidumpDestinationPath = "/opt/secure/minidumps";
+    spec.gid = 30000u;
+    spec.uid = 30001u;
+    spec.version = "1.1";
+    spec.vpu = true;
+    return spec;
+}
+
+/* Helper: streams a spec model into a finished document. */
+std::string StreamSpecModel(const WPEFramework::Plugin::DobbySpecModel& spec)
+{
+    WPEFramework::Plugin::OCIJsonWriter writer;
+    spec.write(writer);
+    return writer.finish();
+}
+}
+
+/* Test_DobbySpecModel_StreamingMatchesDocument
+ *
+ * Verifies that a spec model streamed with write() is byte-identical to its
+ * toJson() document serialized with Json::FastWriter, with and without the
+ * optional sections, and with a uid placeholder in place of the uid.
+ */
+uint32_t Test_DobbySpecModel_StreamingMatchesDocument()
+{
+    L0Test::TestResult tr;
+
+    WPEFramework::Plugin::DobbySpecModel spec = MakeFullSpecModel();
+    Json::FastWriter fastWriter;
+    L0Test::ExpectTrue(tr, StreamSpecModel(spec) == fastWriter.write(spec.toJson()),
+                       "full spec model streams like its document");
+
+    spec.console = false;
+    spec.systemDbus = false;
+    spec.gpu = false;
+    spec.openCdm = false;
+    spec.mounts.clear();
+    spec.ionHeaps.clear();
+    spec.ethanLogLevels.clear();
+    spec.uidPlaceholder = "@UID@";
+    L0Test::ExpectTrue(tr, StreamSpecModel(spec) == fastWriter.write(spec.toJson()),
+                       "minimal spec model streams like its document");
+    L0Test::ExpectTrue(tr, StreamSpecModel(spec).find("\"uid\":\"@UID@\"") != std::string::npos,
+                       "uid placeholder is written as a string");
+
+    return tr.failures;
+}
+
+/* Test_DobbySpecGenerator_OverlayCapabilitiesApplied
+ *
+ * Verifies that a spec without capability overlays is streamed in the
+ * canonical compact form, and that the additionalconfig and spec capabilities
+ * still take effect on the document they are merged into.
+ */
+uint32_t Test_DobbySpecGenerator_OverlayCapabilitiesApplied()
+{
+    L0Test::TestResult tr;
+
+    WPEFramework::Plugin::DobbySpecGenerator gen(GetAIConfigurationFixture());
+    auto appCfg = MakeValidAppConfig();
+    auto rtCfg  = MakeValidRuntimeConfig();
+    rtCfg.envVariables = "[\"A=1\"]";
+
+    std::string plainSpec;
+    L0Test::ExpectTrue(tr, gen.generate(appCfg, rtCfg, plainSpec), "generate() succeeds without overlays");
+    Json::Value plain;
+    Json::Reader reader;
+    L0Test::ExpectTrue(tr, reader.parse(plainSpec, plain), "streamed spec parses");
+    Json::FastWriter fastWriter;
+    L0Test::ExpectTrue(tr, plainSpec == fastWriter.write(plain), "streamed spec is in canonical compact form");
+
+    rtCfg.capabilities = "additionalconfig={\"restartOnCrash\":true\\,\"cpu\":{\"shares\":5}},"
+                         "spec={\"env\":[\"B=2\"]\\,\"network\":\"none\"\\,\"extra\":1}";
+    std::string overlaidSpec;
+    L0Test::ExpectTrue(tr, gen.generate(appCfg, rtCfg, overlaidSpec), "generate() succeeds with overlays");
+    Json::Value overlaid;
+    L0Test::ExpectTrue(tr, reader.parse(overlaidSpec, overlaid), "overlaid spec parses");
+    L0Test::ExpectTrue(tr, overlaid["restartOnCrash"].asBool(), "additionalconfig overrides a scalar");
+    L0Test::ExpectTrue(tr, overlaid["cpu"]["shares"].asInt() == 5, "additionalconfig merges into an object");
+    L0Test::ExpectTrue(tr, overlaid["cpu"]["cores"] == plain["cpu"]["cores"], "additionalconfig keeps sibling keys");
+    L0Test::ExpectTrue(tr, overlaid["network"] == plain["network"], "spec capability does not override");
+    L0Test::ExpectTrue(tr, overlaid["extra"].asInt() == 1, "spec capability adds missing keys");
+    L0Test::ExpectTrue(tr, overlaid["env"].size() == plain["env"].size() + 1u &&
+                           overlaid["env"][plain["env"].size()].asString() == "B=2",
+                       "spec capability appends to env");
+    L0Test::ExpectTrue(tr, overlaidSpec == fastWriter.write(overlaid), "overlaid spec is in canonical compact form");
+
+    return tr.failures;
+}
+
+/* Test_DobbySpecModel_Benchmark
+ *
+ * Serialization throughput of a Dobby spec built as a Json::Value document
+ * and written with Json::FastWriter, against the same spec streamed from the
+ * typed model. Timings are reported; only correctness is asserted.
+ */
+uint32_t Test_DobbySpecModel_Benchmark()
+{
+    L0Test::TestResult tr;
+
+    const WPEFramework::Plugin::DobbySpecModel spec = MakeFullSpecModel();
+    const uint32_t iterations = 5000u;
+    size_t documentBytes = 0;
+    size_t streamBytes = 0;
+
+    const auto documentStart = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        Json::FastWriter fastWriter;
+        documentBytes += fastWriter.write(spec.toJson()).size();
+    }
+    const auto documentUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - documentStart).count();
+
+    const auto streamStart = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        streamBytes += StreamSpecModel(spec).size();
+    }
+    const auto streamUs = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - streamStart).count();
+
+    std::cout << "  Dobby spec build and serialization (" << iterations << " specs): Json::Value + Json::FastWriter "
+              << documentUs << " us, DobbySpecModel streamed " << streamUs << " us" << std::endl;
+
+    L0Test::ExpectTrue(tr, documentBytes == streamBytes, "both paths produce the same amount of output");
+
+    return tr.failures;
+}
@@ -29,11 +29,15 @@
  *   - OCI container event dispatching
  *   - getContainerId / getInstanceState helpers (via public API behaviour)
  *   - getInstance() singleton accessor
+ *   - Run() storage lookup overlapping the display setup
+ *   - Per-instance serialization of container calls
  */
 
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
 #include <string>
 #include <thread>
 
@@ -42,6 +46,20 @@
 #include "common/L0Expect.hpp"
 #include "common/L0TestTypes.hpp"
 
+namespace WPEFramework {
+namespace Plugin {
+
+/* Reads implementation state the public interface does not expose. */
+struct RuntimeManagerImplementationInspector {
+    static uint32_t LaunchProfileBuilds(const RuntimeManagerImplementation& impl)
+    {
+        return impl.mLaunchProfileCache.buildCount();
+    }
+};
+
+} // namespace Plugin
+} // namespace WPEFramework
+
 // ──────────────────────────────────────────────────────────────────────────────
 // Minimal fakes
 // ──────────────────────────────────────────────────────────────────────────────
@@ -121,6 +139,173 @@ WPEFramework::Plugin::RuntimeManagerImplementation* CreateImpl()
         WPEFramework::Plugin::RuntimeManagerImplementation>();
 }
 
+/* Drops the test's reference and waits until the implementation is destroyed,
+ * which happens on a worker thread once the dispatched events hold no reference.
+ * The shell is the last thing the destructor releases, so fakes owned by the
+ * test can go out of scope afterwards. */
+bool ReleaseAndJoin(WPEFramework::Plugin::RuntimeManagerImplementation* impl, const L0Test::ServiceMock& service)
+{
+    impl->Release();
+    for (uint32_t waited = 0; service.HeldReferences() != 0 && waited < 5000; waited += 5) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    return service.HeldReferences() == 0;
+}
+
+/* IOCIContainer fake whose containers start successfully and whose
+ * HibernateContainer() blocks until released, so a test can hold one
+ * instance inside an OCI call while it drives another. Graceful and forced
+ * StopContainer() calls are counted and can be made to fail separately. */
+class BlockingOCIContainer final : public WPEFramework::Exchange::IOCIContainer {
+public:
+    BlockingOCIContainer()
+        : _refCount(1)
+        , hibernateEntered(false)
+        , getInfoCalls(0)
+        , annotateCalls(0)
+        , terminateCalls(0)
+        , killCalls(0)
+        , terminateSucceeds(true)
+        , killSucceeds(true)
+        , parkTerminate(false)
+        , terminateEntered(false)
+        , _released(false)
+        , _terminateReleased(false)
+    {
+    }
+
+    uint32_t AddRef() const override
+    {
+        return _refCount.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    uint32_t Release() const override
+    {
+        const uint32_t r = _refCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+        return (r == 0u) ? WPEFramework::Core::ERROR_DESTRUCTION_SUCCEEDED
+                         : WPEFramework::Core::ERROR_NONE;
+    }
+
+    void* QueryInterface(const uint32_t /*id*/) override { return nullptr; }
+
+    WPEFramework::Core::hresult Register(WPEFramework::Exchange::IOCIContainer::INotification* /*notification*/) override { return WPEFramework::Core::ERROR_NONE; }
+    WPEFramework::Core::hresult Unregister(WPEFramework::Exchange::IOCIContainer::INotification* /*notification*/) override { return WPEFramework::Core::ERROR_NONE; }
+    WPEFramework::Core::hresult ListContainers(std::string& /*containers*/, bool& /*success*/, std::string& /*errorReason*/) override { return WPEFramework::Core::ERROR_NONE; }
+
+    WPEFramework::Core::hresult GetContainerInfo(const std::string& /*id*/, std::string& info, bool& success, std::string& /*err*/) override
+    {
+        getInfoCalls++;
+        info = "{}";
+        success = true;
+        return WPEFramework::Core::ERROR_NONE;
+    }
+
+    WPEFramework::Core::hresult GetContainerState(const std::string& /*id*/, ContainerState& /*state*/, bool& /*success*/, std::string& /*err*/) override { return WPEFramework::Core::ERROR_NONE; }
+
+    WPEFramework::Core::hresult StartContainer(const std::string& /*id*/, const std::string& /*bundle*/, const std::string& /*cmd*/, const std::string& /*ws*/, int32_t& desc, bool& success, std::string& /*err*/) override
+    {
+        desc = 1;
+        success = true;
+        return WPEFramework::Core::ERROR_NONE;
+    }
+
+    WPEFramework::Core::hresult StartContainerFromDobbySpec(const std::string& /*id*/, const std::string& /*spec*/, const std::string& /*cmd*/, const std::string& /*ws*/, int32_t& desc, bool& success, std::string& /*err*/) override
+    {
+        desc = 1;
+        success = true;
+        return WPEFramework::Core::ERROR_NONE;
+    }
+
+    WPEFramework::Core::hresult StopContainer(const std::string& /*id*/, bool force, bool& success, std::string& /*err*/) override
+    {
+        if (force) {
+            killCalls++;
+            success = killSucceeds;
+        } else {
+            terminateCalls++;
+            if (parkTerminate) {
+                std::unique_lock<std::mutex> lock(_lock);
+                terminateEntered = true;
+                _condition.notify_all();
+                _condition.wait(lock, [this]() { return _terminateReleased; });
+            }
+            success = terminateSucceeds;
+        }
+        return WPEFramework::Core::ERROR_NONE;
+    }
+    WPEFramework::Core::hresult PauseContainer(const std::string& /*id*/, bool& /*success*/, std::string& /*err*/) override { return WPEFramework::Core::ERROR_NONE; }
+    WPEFramework::Core::hresult ResumeContainer(const std::string& /*id*/, bool& /*success*/, std::string& /*err*/) override { return WPEFramework::Core::ERROR_NONE; }
+
+    WPEFramework::Core::hresult HibernateContainer(const std::string& /*id*/, const std::string& /*opts*/, bool& success, std::string& /*err*/) override
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        hibernateEntered = true;
+        _condition.notify_all();
+        _condition.wait(lock, [this]() { return _released; });
+        success = true;
+        return WPEFramework::Core::ERROR_NONE;
+    }
+
+    WPEFramework::Core::hresult WakeupContainer(const std::string& /*id*/, bool& /*success*/, std::string& /*err*/) override { return WPEFramework::Core::ERROR_NONE; }
+    WPEFramework::Core::hresult ExecuteCommand(const std::string& /*id*/, const std::string& /*opts*/, const std::string& /*cmd*/, bool& /*success*/, std::string& /*err*/) override { return WPEFramework::Core::ERROR_NONE; }
+
+    WPEFramework::Core::hresult Annotate(const std::string& /*id*/, const std::string& /*key*/, const std::string& /*val*/, bool& success, std::string& /*err*/) override
+    {
+        annotateCalls++;
+        success = true;
+        return WPEFramework::Core::ERROR_NONE;
+    }
+
+    WPEFramework::Core::hresult RemoveAnnotation(const std::string& /*id*/, const std::string& /*key*/, bool& /*success*/, std::string& /*err*/) override { return WPEFramework::Core::ERROR_NONE; }
+    WPEFramework::Core::hresult Mount(const std::string& /*id*/, const std::string& /*src*/, const std::string& /*tgt*/, const std::string& /*type*/, const std::string& /*opts*/, bool& /*success*/, std::string& /*err*/) override { return WPEFramework::Core::ERROR_NONE; }
+    WPEFramework::Core::hresult Unmount(const std::string& /*id*/, const std::string& /*tgt*/, bool& /*success*/, std::string& /*err*/) override { return WPEFramework::Core::ERROR_NONE; }
+
+    /* Waits until a HibernateContainer() call is parked inside the fake */
+    bool WaitForHibernate(const std::chrono::milliseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        return _condition.wait_for(lock, timeout, [this]() { return hibernateEntered; });
+    }
+
+    void ReleaseHibernate()
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _released = true;
+        _condition.notify_all();
+    }
+
+    /* Waits until a graceful StopContainer() call is parked inside the fake */
+    bool WaitForTerminate(const std::chrono::milliseconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(_lock);
+        return _condition.wait_for(lock, timeout, [this]() { return terminateEntered; });
+    }
+
+    void ReleaseTerminate()
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _terminateReleased = true;
+        _condition.notify_all();
+    }
+
+    mutable std::atomic<uint32_t> _refCount;
+    bool hibernateEntered;
+    std::atomic<uint32_t> getInfoCalls;
+    std::atomic<uint32_t> annotateCalls;
+    std::atomic<uint32_t> terminateCalls;
+    std::atomic<uint32_t> killCalls;
+    std::atomic<bool> terminateSucceeds;
+    std::atomic<bool> killSucceeds;
+    std::atomic<bool> parkTerminate;
+    bool terminateEntered;
+
+private:
+    std::mutex _lock;
+    std::condition_variable _condition;
+    bool _released;
+    bool _terminateReleased;
+};
+
 } // namespace
 
 // ──────────────────────────────────────────────────────────────────────────────
@@ -596,6 +781,242 @@ uint32_t Test_Impl_GetInfoNoOCIPlugin()
     return tr.failures;
 }
 
+/* Test_Impl_BlockedInstanceDoesNotStallOthers
+ *
+ * Verifies container calls only serialize per instance: while Hibernate() of
+ * one instance is parked inside the OCI plugin, GetInfo() and Annotate() on a
+ * second instance still complete.
+ */
+uint32_t Test_Impl_BlockedInstanceDoesNotStallOthers()
+{
+    L0Test::TestResult tr;
+
+    static BlockingOCIContainer oci;
+    static L0Test::FakeWindowManager wm;
+    static L0Test::ServiceMock serviceMock(L0Test::ServiceMock::Config(&oci, &wm));
+
+    auto* impl = CreateImpl();
+    impl->Configure(&serviceMock);
+
+    WPEFramework::Exchange::RuntimeConfig cfg;
+    cfg.envVariables = "XDG_RUNTIME_DIR=/tmp;WAYLAND_DISPLAY=test";
+    cfg.command      = "SkyBrowserLauncher";
+
+    L0Test::ExpectEqU32(tr, impl->Run("appA", "blockedInstance", 10, 10, nullptr, nullptr, nullptr, cfg),
+                        WPEFramework::Core::ERROR_NONE, "First instance launches");
+    L0Test::ExpectEqU32(tr, impl->Run("appB", "freeInstance", 10, 10, nullptr, nullptr, nullptr, cfg),
+                        WPEFramework::Core::ERROR_NONE, "Second instance launches");
+
+    std::thread hibernate([impl]() {
+        impl->Hibernate("blockedInstance");
+    });
+
+    const bool parked = oci.WaitForHibernate(std::chrono::milliseconds(2000));
+    L0Test::ExpectTrue(tr, parked, "Hibernate() of the first instance is inside the OCI plugin");
+
+    if (parked) {
+        std::atomic<bool> done { false };
+        WPEFramework::Core::hresult infoResult = WPEFramework::Core::ERROR_GENERAL;
+        WPEFramework::Core::hresult annotateResult = WPEFramework::Core::ERROR_GENERAL;
+        std::thread other([impl, &done, &infoResult, &annotateResult]() {
+            std::string info;
+            infoResult = impl->GetInfo("freeInstance", info);
+            annotateResult = impl->Annotate("freeInstance", "key", "value");
+            done = true;
+        });
+
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while (!done && (std::chrono::steady_clock::now() < deadline)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        L0Test::ExpectTrue(tr, done.load(), "GetInfo()/Annotate() on another instance complete while Hibernate() blocks");
+
+        oci.ReleaseHibernate();
+        other.join();
+        L0Test::ExpectEqU32(tr, infoResult, WPEFramework::Core::ERROR_NONE, "GetInfo() on the other instance succeeds");
+        L0Test::ExpectEqU32(tr, annotateResult, WPEFramework::Core::ERROR_NONE, "Annotate() on the other instance succeeds");
+    } else {
+        oci.ReleaseHibernate();
+    }
+    hibernate.join();
+
+    impl->Release();
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    return tr.failures;
+}
+
+/* Test_Impl_KillEscalatesPendingTerminate
+ *
+ * Verifies that a Kill() while the graceful stop of a Terminate() is still
+ * being retried is accepted and stops the container with force.
+ */
+uint32_t Test_Impl_KillEscalatesPendingTerminate()
+{
+    L0Test::TestResult tr;
+
+    static BlockingOCIContainer oci;
+    static L0Test::FakeWindowManager wm;
+    static L0Test::ServiceMock serviceMock(L0Test::ServiceMock::Config(&oci, &wm));
+    oci.terminateSucceeds = false;
+
+    auto* impl = CreateImpl();
+    impl->Configure(&serviceMock);
+
+    WPEFramework::Exchange::RuntimeConfig cfg;
+    cfg.envVariables = "XDG_RUNTIME_DIR=/tmp;WAYLAND_DISPLAY=test";
+    cfg.command      = "SkyBrowserLauncher";
+
+    L0Test::ExpectEqU32(tr, impl->Run("appA", "stuckInstance", 10, 10, nullptr, nullptr, nullptr, cfg),
+                        WPEFramework::Core::ERROR_NONE, "Instance launches");
+    L0Test::ExpectEqU32(tr, impl->Terminate("stuckInstance"), WPEFramework::Core::ERROR_NONE,
+                        "Terminate() queues a graceful stop");
+    for (uint32_t waited = 0; oci.terminateCalls.load() == 0 && waited < 2000; waited += 5) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    L0Test::ExpectEqU32(tr, impl->Kill("stuckInstance"), WPEFramework::Core::ERROR_NONE,
+                        "Kill() accepted while the terminate is pending");
+    for (uint32_t waited = 0; oci.killCalls.load() == 0 && waited < 2000; waited += 5) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    L0Test::ExpectEqU32(tr, oci.killCalls.load(), 1u, "pending teardown stops the container with force");
+
+    impl->Release();
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    return tr.failures;
+}
+
+/* Test_Impl_KillReturnsWhileTerminateBlocks
+ *
+ * Verifies that Kill() returns promptly while the StopContainer() of an
+ * earlier Terminate() is blocked in the OCI container, and that the forced
+ * stop follows once the graceful one returns without success.
+ */
+uint32_t Test_Impl_KillReturnsWhileTerminateBlocks()
+{
+    L0Test::TestResult tr;
+
+    static BlockingOCIContainer oci;
+    static L0Test::FakeWindowManager wm;
+    static L0Test::ServiceMock serviceMock(L0Test::ServiceMock::Config(&oci, &wm));
+    oci.parkTerminate = true;
+    oci.terminateSucceeds = false;
+
+    auto* impl = CreateImpl();
+    impl->Configure(&serviceMock);
+
+    WPEFramework::Exchange::RuntimeConfig cfg;
+    cfg.envVariables = "XDG_RUNTIME_DIR=/tmp;WAYLAND_DISPLAY=test";
+    cfg.command      = "SkyBrowserLauncher";
+
+    L0Test::ExpectEqU32(tr, impl->Run("appA", "hungInstance", 10, 10, nullptr, nullptr, nullptr, cfg),
+                        WPEFramework::Core::ERROR_NONE, "Instance launches");
+    L0Test::ExpectEqU32(tr, impl->Terminate("hungInstance"), WPEFramework::Core::ERROR_NONE,
+                        "Terminate() queues a graceful stop");
+    L0Test::ExpectTrue(tr, oci.WaitForTerminate(std::chrono::milliseconds(2000)),
+                       "graceful StopContainer() is parked in the OCI container");
+
+    const auto killStart = std::chrono::steady_clock::now();
+    L0Test::ExpectEqU32(tr, impl->Kill("hungInstance"), WPEFramework::Core::ERROR_NONE,
+                        "Kill() accepted while the graceful stop blocks");
+    const auto killMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - killStart).count();
+    L0Test::ExpectTrue(tr, killMs < 500, "Kill() does not wait for the blocked StopContainer()");
+    L0Test::ExpectEqU32(tr, oci.killCalls.load(), 0u, "forced stop waits for the step in flight");
+
+    oci.ReleaseTerminate();
+    for (uint32_t waited = 0; oci.killCalls.load() == 0 && waited < 2000; waited += 5) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    L0Test::ExpectEqU32(tr, oci.killCalls.load(), 1u, "forced stop runs once the graceful stop returns");
+
+    impl->Release();
+    return tr.failures;
+}
+
+/* Test_Impl_FailedTeardownFiresOnFailure
+ *
+ * Verifies that a teardown that gives up on its stop step is reported with
+ * OnFailure() for the instance.
+ */
+uint32_t Test_Impl_FailedTeardownFiresOnFailure()
+{
+    L0Test::TestResult tr;
+
+    static BlockingOCIContainer oci;
+    static L0Test::FakeWindowManager wm;
+    static L0Test::ServiceMock serviceMock(L0Test::ServiceMock::Config(&oci, &wm));
+    oci.killSucceeds = false;
+
+    auto* impl = CreateImpl();
+    impl->Configure(&serviceMock);
+    FakeNotification notif;
+    impl->Register(&notif);
+
+    WPEFramework::Exchange::RuntimeConfig cfg;
+    cfg.envVariables = "XDG_RUNTIME_DIR=/tmp;WAYLAND_DISPLAY=test";
+    cfg.command      = "SkyBrowserLauncher";
+
+    L0Test::ExpectEqU32(tr, impl->Run("appA", "unkillableInstance", 10, 10, nullptr, nullptr, nullptr, cfg),
+                        WPEFramework::Core::ERROR_NONE, "Instance launches");
+    L0Test::ExpectEqU32(tr, impl->Kill("unkillableInstance"), WPEFramework::Core::ERROR_NONE,
+                        "Kill() queues a forced stop");
+    for (uint32_t waited = 0; notif.onFailureCount.load() == 0 && waited < 5000; waited += 10) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    L0Test::ExpectTrue(tr, notif.onFailureCount.load() > 0u, "OnFailure fires once the teardown gives up");
+    L0Test::ExpectEqU32(tr, oci.killCalls.load(), 3u, "forced stop attempted maxAttempts times");
+
+    impl->Unregister(&notif);
+    impl->Release();
+    return tr.failures;
+}
+
+/* Test_Impl_RunAcquiresPackageInstallerLate
+ *
+ * Verifies that when AppPackageManager is not up at Configure() time, its later
+ * activation registers for install notifications exactly once and drops the
+ * launch profiles built without it.
+ */
+uint32_t Test_Impl_RunAcquiresPackageInstallerLate()
+{
+    L0Test::TestResult tr;
+
+    BlockingOCIContainer oci;
+    L0Test::FakeWindowManager wm;
+    L0Test::FakePackageInstaller installer;
+    L0Test::ServiceMock serviceMock(L0Test::ServiceMock::Config(&oci, &wm));
+
+    auto* impl = CreateImpl();
+    impl->Configure(&serviceMock);
+
+    WPEFramework::Exchange::RuntimeConfig cfg;
+    cfg.envVariables = "XDG_RUNTIME_DIR=/tmp;WAYLAND_DISPLAY=test";
+    cfg.command      = "SkyBrowserLauncher";
+
+    impl->Run("appA", "earlyInstance", 10, 10, nullptr, nullptr, nullptr, cfg);
+    impl->Run("appA", "earlierInstance", 10, 10, nullptr, nullptr, nullptr, cfg);
+    L0Test::ExpectEqU32(tr, installer.registerCalls.load(), 0u, "no installer to register with yet");
+    L0Test::ExpectEqU32(tr, WPEFramework::Plugin::RuntimeManagerImplementationInspector::LaunchProfileBuilds(*impl), 1u,
+                        "profile built once without the installer");
+
+    serviceMock.NotifyActivated("org.rdk.OtherPlugin");
+    serviceMock.SetPackageInstaller(&installer);
+    L0Test::ExpectEqU32(tr, installer.registerCalls.load(), 1u, "activation registers with the installer");
+    serviceMock.NotifyActivated("org.rdk.AppPackageManager");
+    L0Test::ExpectEqU32(tr, installer.registerCalls.load(), 1u, "installer is acquired only once");
+
+    impl->Run("appA", "lateInstance", 10, 10, nullptr, nullptr, nullptr, cfg);
+    L0Test::ExpectEqU32(tr, WPEFramework::Plugin::RuntimeManagerImplementationInspector::LaunchProfileBuilds(*impl), 2u,
+                        "profile built before the installer appeared is rebuilt");
+    impl->Run("appA", "laterInstance", 10, 10, nullptr, nullptr, nullptr, cfg);
+    L0Test::ExpectEqU32(tr, WPEFramework::Plugin::RuntimeManagerImplementationInspector::LaunchProfileBuilds(*impl), 2u,
+                        "rebuilt profile is reused");
+
+    L0Test::ExpectTrue(tr, ReleaseAndJoin(impl, serviceMock), "implementation destroyed");
+    L0Test::ExpectEqU32(tr, installer.unregisterCalls.load(), 1u, "installer released on shutdown");
+    return tr.failures;
+}
+
 // ──────────────────────────────────────────────────────────────────────────────
 // Run – parameter validation (no OCI plugin)
 // ──────────────────────────────────────────────────────────────────────────────
@@ -674,6 +1095,93 @@ uint32_t Test_Impl_RunNoWindowManagerConnector()
     return tr.failures;
 }
 
+/* Test_Impl_RunOverlapsStorageLookup
+ *
+ * Verifies the storage lookup runs alongside the display setup: the fake
+ * storage manager holds GetStorage() open until the display has been created,
+ * which only happens if Run() did not wait for the lookup first.
+ */
+uint32_t Test_Impl_RunOverlapsStorageLookup()
+{
+    L0Test::TestResult tr;
+
+    static L0Test::FakeOCIContainer oci;
+    static L0Test::FakeWindowManager wm;
+    static L0Test::FakeAppStorageManager storage;
+    static L0Test::ServiceMock serviceMock(L0Test::ServiceMock::Config(&oci, &wm, &storage));
+
+    std::atomic<bool> displayCreatedDuringLookup { false };
+    storage.SetGetStorageHook([&displayCreatedDuringLookup]() {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+        while ((0U == wm.createDisplayCalls) && (std::chrono::steady_clock::now() < deadline)) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        displayCreatedDuringLookup = (0U != wm.createDisplayCalls);
+    });
+
+    auto* impl = CreateImpl();
+    impl->Configure(&serviceMock);
+
+    WPEFramework::Exchange::RuntimeConfig cfg;
+    cfg.envVariables = "XDG_RUNTIME_DIR=/tmp;WAYLAND_DISPLAY=test";
+    cfg.command      = "SkyBrowserLauncher";
+
+    // The fake OCI container never reports success, so the launch itself fails;
+    // only the ordering of the stages is under test here.
+    impl->Run("appId", "storageOverlap", 10, 10, nullptr, nullptr, nullptr, cfg);
+
+    L0Test::ExpectEqU32(tr, storage.getStorageCalls.load(), 1U,
+                        "Run() looks the storage up exactly once");
+    L0Test::ExpectTrue(tr, displayCreatedDuringLookup.load(),
+                       "Display is created while the storage lookup is still running");
+
+    storage.SetGetStorageHook(nullptr);
+    impl->Release();
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    return tr.failures;
+}
+
+/* Test_Impl_RunJoinsStorageLookupOnFailure
+ *
+ * Verifies a launch that fails after the storage lookup was started still
+ * waits for the lookup: display creation fails while GetStorage() is held
+ * open, and Run() must not return before the lookup has finished.
+ */
+uint32_t Test_Impl_RunJoinsStorageLookupOnFailure()
+{
+    L0Test::TestResult tr;
+
+    static L0Test::FakeOCIContainer oci;
+    static L0Test::FakeWindowManager wm;
+    static L0Test::FakeAppStorageManager storage;
+    static L0Test::ServiceMock serviceMock(L0Test::ServiceMock::Config(&oci, &wm, &storage));
+
+    wm.SetCreateDisplayReturnCode(WPEFramework::Core::ERROR_GENERAL);
+    std::atomic<bool> lookupFinished { false };
+    storage.SetGetStorageHook([&lookupFinished]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+        lookupFinished = true;
+    });
+
+    auto* impl = CreateImpl();
+    impl->Configure(&serviceMock);
+
+    WPEFramework::Exchange::RuntimeConfig cfg;
+    cfg.envVariables = "XDG_RUNTIME_DIR=/tmp;WAYLAND_DISPLAY=test";
+    cfg.command      = "SkyBrowserLauncher";
+
+    const auto result = impl->Run("appId", "storageJoin", 10, 10, nullptr, nullptr, nullptr, cfg);
+    L0Test::ExpectEqU32(tr, result, WPEFramework::Core::ERROR_GENERAL,
+                        "Run() fails when the display cannot be created");
+    L0Test::ExpectTrue(tr, lookupFinished.load(),
+                       "Run() returns only after the storage lookup has finished");
+
+    storage.SetGetStorageHook(nullptr);
+    impl->Release();
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    return tr.failures;
+}
+
 // ──────────────────────────────────────────────────────────────────────────────
 // Mount / Unmount (stubs – expected to return ERROR_NONE)
 // ──────────────────────────────────────────────────────────────────────────────
@@ -8,6 +8,8 @@
 #include <core/core.h>
 #include <plugins/plugins.h>
 #include <plugins/IShell.h>
+#include <interfaces/IAppPackageManager.h>
+#include <interfaces/IAppStorageManager.h>
 #include <interfaces/IOCIContainer.h>
 #include <interfaces/IRDKWindowManager.h>
 #include "IEventHandler.h"
@@ -21,15 +23,18 @@ public:
     using InstantiateHandler = std::function<void*(const WPEFramework::RPC::Object&, const uint32_t, uint32_t&)>;
 
     struct Config {
-        explicit Config(WPEFramework::Exchange::IOCIContainer*     oci = nullptr,
-                        WPEFramework::Exchange::IRDKWindowManager* wm  = nullptr)
+        explicit Config(WPEFramework::Exchange::IOCIContainer*       oci     = nullptr,
+                        WPEFramework::Exchange::IRDKWindowManager*   wm      = nullptr,
+                        WPEFramework::Exchange::IAppStorageManager*  storage = nullptr)
             : oci(oci)
             , wm(wm)
+            , storage(storage)
             , configLine("{}")
         {
         }
         WPEFramework::Exchange::IOCIContainer*     oci;
         WPEFramework::Exchange::IRDKWindowManager* wm;
+        WPEFramework::Exchange::IAppStorageManager* storage;
         std::string                                configLine;
     };
 
@@ -94,6 +99,29 @@ public:
         _instantiateHandler = handler;
     }
 
+    // Makes org.rdk.AppPackageManager available from now on and reports its activation,
+    // as if it was activated late.
+    void SetPackageInstaller(WPEFramework::Exchange::IPackageInstaller* installer)
+    {
+        _installer = installer;
+        NotifyActivated("org.rdk.AppPackageManager");
+    }
+
+    // Reports the activation of callsign to the registered plugin state observer, if any.
+    void NotifyActivated(const std::string& callsign)
+    {
+        WPEFramework::PluginHost::IPlugin::INotification* notification = _pluginNotification;
+        if (nullptr != notification) {
+            notification->Activated(callsign, this);
+        }
+    }
+
+    // References taken on this shell and not yet released.
+    uint32_t HeldReferences() const
+    {
+        return _refCount.load() - 1;
+    }
+
     // Observability hooks for L0 assertions.
     mutable std::atomic<uint32_t> addRefCalls { 0 };
     mutable std::atomic<uint32_t> releaseCalls { 0 };
@@ -161,10 +189,32 @@ public:
             _cfg.wm->AddRef();
             return static_cast<WPEFramework::Exchange::IRDKWindowManager*>(_cfg.wm);
         }
+        if (WPEFramework::Exchange::IAppStorageManager::ID == id
+            && "org.rdk.AppStorageManager" == callsign
+            && nullptr != _cfg.storage)
+        {
+            _cfg.storage->AddRef();
+            return static_cast<WPEFramework::Exchange::IAppStorageManager*>(_cfg.storage);
+        }
+        WPEFramework::Exchange::IPackageInstaller* installer = _installer;
+        if (WPEFramework::Exchange::IPackageInstaller::ID == id
+            && "org.rdk.AppPackageManager" == callsign
+            && nullptr != installer)
+        {
+            installer->AddRef();
+            return static_cast<WPEFramework::Exchange::IPackageInstaller*>(installer);
+        }
         return nullptr;
     }
-    void Register(WPEFramework::PluginHost::IPlugin::INotification*) override {}
-    void Unregister(WPEFramework::PluginHost::IPlugin::INotification*) override {}
+    void Register(WPEFramework::PluginHost::IPlugin::INotification* notification) override
+    {
+        _pluginNotification = notification;
+    }
+    void Unregister(WPEFramework::PluginHost::IPlugin::INotification* notification) override
+    {
+        WPEFramework::PluginHost::IPlugin::INotification* expected = notification;
+        _pluginNotification.compare_exchange_strong(expected, nullptr);
+    }
     std::string Model() const override { return ""; }
     bool Background() const override { return false; }
     std::string Accessor() const override { return ""; }
@@ -190,6 +240,8 @@ private:
     mutable std::atomic<uint32_t> _refCount;
     InstantiateHandler _instantiateHandler;
     Config _cfg;
+    std::atomic<WPEFramework::Exchange::IPackageInstaller*> _installer { nullptr };
+    std::atomic<WPEFramework::PluginHost::IPlugin::INotification*> _pluginNotification { nullptr };
     COMLinkMock _comLink;
 };
 
@@ -268,6 +320,107 @@ private:
     WPEFramework::Exchange::IOCIContainer::INotification* _storedNotification;
 };
 
+/* Minimal IAppStorageManager stub. GetStorage() runs the optional hook first so
+ * tests can hold the lookup open while Run() carries on with its other stages. */
+class FakeAppStorageManager final : public WPEFramework::Exchange::IAppStorageManager {
+public:
+    using GetStorageHook = std::function<void()>;
+
+    FakeAppStorageManager()
+        : _refCount(1)
+        , getStorageCalls(0)
+    {
+    }
+
+    uint32_t AddRef() const override
+    {
+        return _refCount.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    uint32_t Release() const override
+    {
+        const uint32_t r = _refCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+        return (r == 0u) ? WPEFramework::Core::ERROR_DESTRUCTION_SUCCEEDED
+                         : WPEFramework::Core::ERROR_NONE;
+    }
+
+    void* QueryInterface(const uint32_t /*id*/) override { return nullptr; }
+
+    WPEFramework::Core::hresult CreateStorage(const string& /*appId*/, const uint32_t& /*size*/, string& /*path*/, string& /*errorReason*/) override { return WPEFramework::Core::ERROR_NONE; }
+
+    WPEFramework::Core::hresult GetStorage(const string& /*appId*/, const int32_t& /*userId*/, const int32_t& /*groupId*/, string& path, uint32_t& size, uint32_t& used) override
+    {
+        getStorageCalls++;
+        if (_getStorageHook) {
+            _getStorageHook();
+        }
+        path = "/tmp";
+        size = 1024;
+        used = 0;
+        return WPEFramework::Core::ERROR_NONE;
+    }
+
+    WPEFramework::Core::hresult DeleteStorage(const string& /*appId*/, string& /*errorReason*/) override { return WPEFramework::Core::ERROR_NONE; }
+    WPEFramework::Core::hresult Clear(const string& /*appId*/, string& /*errorReason*/) override { return WPEFramework::Core::ERROR_NONE; }
+    WPEFramework::Core::hresult ClearAll(const string& /*exemptionAppIds*/, string& /*errorReason*/) override { return WPEFramework::Core::ERROR_NONE; }
+
+    void SetGetStorageHook(GetStorageHook hook) { _getStorageHook = hook; }
+
+    mutable std::atomic<uint32_t> _refCount;
+    std::atomic<uint32_t> getStorageCalls;
+
+private:
+    GetStorageHook _getStorageHook;
+};
+
+/* IPackageInstaller fake that only counts notification registrations. */
+class FakePackageInstaller final : public WPEFramework::Exchange::IPackageInstaller {
+public:
+    FakePackageInstaller()
+        : _refCount(1)
+        , registerCalls(0)
+        , unregisterCalls(0)
+    {
+    }
+
+    uint32_t AddRef() const override
+    {
+        return _refCount.fetch_add(1, std::memory_order_relaxed) + 1;
+    }
+
+    uint32_t Release() const override
+    {
+        const uint32_t r = _refCount.fetch_sub(1, std::memory_order_acq_rel) - 1;
+        return (r == 0u) ? WPEFramework::Core::ERROR_DESTRUCTION_SUCCEEDED
+                         : WPEFramework::Core::ERROR_NONE;
+    }
+
+    void* QueryInterface(const uint32_t /*id*/) override { return nullptr; }
+
+    WPEFramework::Core::hresult Install(const string& /*packageId*/, const string& /*version*/, IKeyValueIterator* const& /*additionalMetadata*/, const string& /*fileLocator*/, FailReason& /*failReason*/) override { return WPEFramework::Core::ERROR_NONE; }
+    WPEFramework::Core::hresult Uninstall(const string& /*packageId*/, string& /*errorReason*/) override { return WPEFramework::Core::ERROR_NONE; }
+    WPEFramework::Core::hresult ListPackages(IPackageIterator*& packages) override { packages = nullptr; return WPEFramework::Core::ERROR_GENERAL; }
+    WPEFramework::Core::hresult Config(const string& /*packageId*/, const string& /*version*/, WPEFramework::Exchange::RuntimeConfig& /*configMetadata*/) override { return WPEFramework::Core::ERROR_NONE; }
+    WPEFramework::Core::hresult PackageState(const string& /*packageId*/, const string& /*version*/, InstallState& /*state*/) override { return WPEFramework::Core::ERROR_NONE; }
+    WPEFramework::Core::hresult GetConfigForPackage(const string& /*fileLocator*/, string& /*id*/, string& /*version*/, WPEFramework::Exchange::RuntimeConfig& /*config*/) override { return WPEFramework::Core::ERROR_GENERAL; }
+
+    WPEFramework::Core::hresult Register(INotification* /*notification*/) override
+    {
+        registerCalls++;
+        return WPEFramework::Core::ERROR_NONE;
+    }
+
+    WPEFramework::Core::hresult Unregister(INotification* /*notification*/) override
+    {
+        unregisterCalls++;
+        return WPEFramework::Core::ERROR_NONE;
+    }
+
+    mutable std::atomic<uint32_t> _refCount;
+    std::atomic<uint32_t> registerCalls;
+    std::atomic<uint32_t> unregisterCalls;
+};
+
 } // end namespace L0Test (FakeEventHandler defined in WPEFramework::Plugin below)
 
 /* Minimal IEventHandler stub counting calls per event type.
@@ -0,0 +1,307 @@
+/**
+ * If not stated otherwise in this file or this component's LICENSE
+ * file the following copyright and licenses apply:
+ *
+ * Copyright 2026 RDK Management
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ **/
+
+/**
+ * @file Ralf_LayerStackCacheTests.cpp
+ *
+ * L0 tests for ralf/RalfLayerStackCache:
+ *   - sharing one stack mount between instances on the same layers
+ *   - reuse of an unused stack inside the grace period
+ *   - lazy detach once the grace period is over
+ *   - layer sets that are not stacked
+ *   - concurrent launches while a stack mount is in progress
+ *   - detaching stacks left by an earlier run
+ *
+ * Mounts are replaced by fakes, so the tests need no privileges.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ralf/RalfLayerStackCache.h"
+#include "common/L0Expect.hpp"
+#include "common/L0TestTypes.hpp"
+
+// ──────────────────────────────────────────────────────────────────────────────
+// Helpers
+// ──────────────────────────────────────────────────────────────────────────────
+
+namespace {
+struct FakeMounts {
+    std::atomic<uint32_t> mounts{0};
+    std::atomic<uint32_t> unmounts{0};
+    bool mountSucceeds = true;
+
+    ralf::RalfLayerStackCache::MountFunction mountFunction()
+    {
+        return [this](const std::string &, const std::string &) {
+            if (mountSucceeds) {
+                mounts++;
+            }
+            return mountSucceeds;
+        };
+    }
+
+    ralf::RalfLayerStackCache::UnmountFunction unmountFunction()
+    {
+        return [this](const std::string &) {
+            unmounts++;
+            return true;
+        };
+    }
+};
+
+const std::string kLayers = "/usr/share/gpu-layer/rootfs:/pkg/runtime:/pkg/app";
+}
+
+// ──────────────────────────────────────────────────────────────────────────────
+// acquire() / release() tests
+// ──────────────────────────────────────────────────────────────────────────────
+
+/* Test_RalfLayerStackCache_SameLayersShareOneMount
+ *
+ * Verifies that two instances on the same layers get the same stack from a
+ * single mount, and that the stack stays pinned until both released it.
+ */
+uint32_t Test_RalfLayerStackCache_SameLayersShareOneMount()
+{
+    L0Test::TestResult tr;
+
+    FakeMounts fake;
+    ralf::RalfLayerStackCache cache("/tmp/ralf_l0test_stacks/", 60000, fake.mountFunction(), fake.unmountFunction());
+    std::string firstPath;
+    std::string secondPath;
+
+    L0Test::ExpectTrue(tr, cache.acquire("youTube-1", kLayers, firstPath), "first instance pins a stack");
+    L0Test::ExpectTrue(tr, cache.acquire("youTube-2", kLayers, secondPath), "second instance pins a stack");
+    L0Test::ExpectEqStr(tr, secondPath, firstPath, "both instances share the stack");
+    L0Test::ExpectEqU32(tr, fake.mounts.load(), 1u, "stack mounted once");
+
+    ralf::RalfLayerStackCache::Stats stats = cache.stats();
+    L0Test::ExpectEqU32(tr, stats.pinned, 1u, "one stack pinned");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(stats.reuses), 1u, "second launch reused the stack");
+
+    cache.release("youTube-1");
+    L0Test::ExpectEqU32(tr, cache.stats().pinned, 1u, "stack still pinned by the second instance");
+    cache.release("youTube-2");
+    cache.release("youTube-2");
+    stats = cache.stats();
+    L0Test::ExpectEqU32(tr, stats.pinned, 0u, "no stack pinned after both released");
+    L0Test::ExpectEqU32(tr, stats.idle, 1u, "unused stack waits for its grace period");
+    L0Test::ExpectEqU32(tr, fake.unmounts.load(), 0u, "nothing detached inside the grace period");
+
+    return tr.failures;
+}
+
+/* Test_RalfLayerStackCache_RelaunchInGraceReusesStack
+ *
+ * Verifies that a relaunch on the same layers after the last instance exited,
+ * but inside the grace period, pins the mounted stack again without a mount.
+ */
+uint32_t Test_RalfLayerStackCache_RelaunchInGraceReusesStack()
+{
+    L0Test::TestResult tr;
+
+    FakeMounts fake;
+    ralf::RalfLayerStackCache cache("/tmp/ralf_l0test_stacks/", 60000, fake.mountFunction(), fake.unmountFunction());
+    std::string firstPath;
+    std::string relaunchPath;
+
+    cache.acquire("netflix-1", kLayers, firstPath);
+    cache.release("netflix-1");
+    L0Test::ExpectTrue(tr, cache.acquire("netflix-2", kLayers, relaunchPath), "relaunch pins a stack");
+    L0Test::ExpectEqStr(tr, relaunchPath, firstPath, "relaunch gets the idle stack");
+    L0Test::ExpectEqU32(tr, fake.mounts.load(), 1u, "relaunch does not mount again");
+
+    const ralf::RalfLayerStackCache::Stats stats = cache.stats();
+    L0Test::ExpectEqU32(tr, stats.pinned, 1u, "stack pinned again");
+    L0Test::ExpectEqU32(tr, stats.idle, 0u, "stack no longer idle");
+
+    std::string otherPath;
+    cache.acquire("netflix-3", "/usr/share/gpu-layer/rootfs:/pkg/other", otherPath);
+    L0Test::ExpectTrue(tr, otherPath != firstPath, "different layers get their own stack");
+    L0Test::ExpectEqU32(tr, fake.mounts.load(), 2u, "different layers are mounted separately");
+
+    return tr.failures;
+}
+
+/* Test_RalfLayerStackCache_IdleStackDetachedAfterGrace
+ *
+ * Verifies that an unused stack is detached once its grace period is over,
+ * and that a later launch on the same layers mounts it again.
+ */
+uint32_t Test_RalfLayerStackCache_IdleStackDetachedAfterGrace()
+{
+    L0Test::TestResult tr;
+
+    FakeMounts fake;
+    ralf::RalfLayerStackCache cache("/tmp/ralf_l0test_stacks/", 20, fake.mountFunction(), fake.unmountFunction());
+    std::string stackPath;
+
+    cache.acquire("youTube-1", kLayers, stackPath);
+    cache.release("youTube-1");
+    for (uint32_t waited = 0; fake.unmounts.load() == 0 && waited < 2000; waited += 5) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    L0Test::ExpectEqU32(tr, fake.unmounts.load(), 1u, "unused stack detached after the grace period");
+
+    const ralf::RalfLayerStackCache::Stats stats = cache.stats();
+    L0Test::ExpectEqU32(tr, stats.idle, 0u, "no idle stack left");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(stats.unmounts), 1u, "detach accounted");
+
+    cache.acquire("youTube-2", kLayers, stackPath);
+    L0Test::ExpectEqU32(tr, fake.mounts.load(), 2u, "launch after the grace period mounts again");
+
+    return tr.failures;
+}
+
+/* Test_RalfLayerStackCache_UnstackedLayerSets
+ *
+ * Verifies that a single layer and a failed stack mount leave the caller to
+ * mount the layers itself, without any reference being taken.
+ */
+uint32_t Test_RalfLayerStackCache_UnstackedLayerSets()
+{
+    L0Test::TestResult tr;
+
+    FakeMounts fake;
+    ralf::RalfLayerStackCache cache("/tmp/ralf_l0test_stacks/", 60000, fake.mountFunction(), fake.unmountFunction());
+    std::string stackPath;
+
+    L0Test::ExpectTrue(tr, !cache.acquire("single", "/usr/share/gpu-layer/rootfs", stackPath),
+                       "a single layer is not stacked");
+
+    fake.mountSucceeds = false;
+    L0Test::ExpectTrue(tr, !cache.acquire("failed", kLayers, stackPath), "failed stack mount is not pinned");
+    cache.release("failed");
+
+    const ralf::RalfLayerStackCache::Stats stats = cache.stats();
+    L0Test::ExpectEqU32(tr, stats.pinned, 0u, "nothing pinned");
+    L0Test::ExpectEqU32(tr, static_cast<uint32_t>(stats.mounts), 0u, "nothing mounted");
+
+    return tr.failures;
+}
+
+/* Test_RalfLayerStackCache_MountDoesNotBlockOtherLayers
+ *
+ * Verifies that a slow stack mount does not hold up launches on other layers,
+ * and that a launch on the same layers waits for the pending mount and shares
+ * it instead of mounting again.
+ */
+uint32_t Test_RalfLayerStackCache_MountDoesNotBlockOtherLayers()
+{
+    L0Test::TestResult tr;
+
+    std::mutex gateLock;
+    std::condition_variable gateChanged;
+    bool slowMountEntered = false;
+    bool slowMountReleased = false;
+    std::atomic<uint32_t> mounts{0};
+    const std::string otherLayers = "/usr/share/gpu-layer/rootfs:/pkg/other";
+
+    ralf::RalfLayerStackCache cache("/tmp/ralf_l0test_stacks/", 60000,
+        [&](const std::string &lowerDirs, const std::string &) {
+            mounts++;
+            if (lowerDirs == kLayers) {
+                std::unique_lock<std::mutex> lock(gateLock);
+                slowMountEntered = true;
+                gateChanged.notify_all();
+                gateChanged.wait(lock, [&]() { return slowMountReleased; });
+            }
+            return true;
+        },
+        [](const std::string &) { return true; });
+
+    std::string firstPath;
+    std::string sharedPath;
+    std::thread first([&]() { cache.acquire("youTube-1", kLayers, firstPath); });
+    {
+        std::unique_lock<std::mutex> lock(gateLock);
+        gateChanged.wait_for(lock, std::chrono::seconds(2), [&]() { return slowMountEntered; });
+    }
+    std::thread second([&]() { cache.acquire("youTube-2", kLayers, sharedPath); });
+
+    std::string otherPath;
+    L0Test::ExpectTrue(tr, cache.acquire("netflix-1", otherLayers, otherPath),
+                       "other layers stack while the first mount is pending");
+    L0Test::ExpectEqU32(tr, cache.stats().pinned, 1u, "only the finished stack counts as pinned");
+
+    {
+        std::lock_guard<std::mutex> lock(gateLock);
+        slowMountReleased = true;
+    }
+    gateChanged.notify_all();
+    first.join();
+    second.join();
+
+    L0Test::ExpectEqStr(tr, sharedPath, firstPath, "waiting launch shares the pending stack");
+    L0Test::ExpectEqU32(tr, mounts.load(), 2u, "each layer set mounted once");
+    L0Test::ExpectEqU32(tr, cache.stats().pinned, 2u, "both stacks pinned");
+
+    return tr.failures;
+}
+
+/* Test_RalfLayerStackCache_SweepDetachesStaleStacks
+ *
+ * Verifies that stacks left in the stack directory by an earlier run are
+ * detached, while stacks mounted by this cache are left alone.
+ */
+uint32_t Test_RalfLayerStackCache_SweepDetachesStaleStacks()
+{
+    L0Test::TestResult tr;
+
+    const std::string dir = "/tmp/ralf_l0test_sweep/";
+    const std::string stale[] = { dir + "1234-0", dir + "1234-1" };
+    mkdir(dir.c_str(), 0755);
+    for (const auto &path : stale) {
+        mkdir(path.c_str(), 0755);
+    }
+
+    std::set<std::string> detached;
+    std::string ownPath;
+    ralf::RalfLayerStackCache cache(dir,
+        60000,
+        [](const std::string &, const std::string &target) { return 0 == mkdir(target.c_str(), 0755); },
+        [&](const std::string &target) {
+            detached.insert(target);
+            return 0 == rmdir(target.c_str());
+        });
+    cache.acquire("youTube-1", kLayers, ownPath);
+
+    L0Test::ExpectEqU32(tr, cache.sweepStale(), 2u, "both stale stacks detached");
+    L0Test::ExpectTrue(tr, detached.count(stale[0]) == 1 && detached.count(stale[1]) == 1,
+                       "stale stacks passed to the unmount");
+    L0Test::ExpectTrue(tr, detached.count(ownPath) == 0, "own stack left mounted");
+    L0Test::ExpectEqU32(tr, cache.sweepStale(), 0u, "nothing left to sweep");
+
+    cache.release("youTube-1");
+    cache.expireIdle(true);
+    rmdir(dir.c_str());
+
+    return tr.failures;
+}
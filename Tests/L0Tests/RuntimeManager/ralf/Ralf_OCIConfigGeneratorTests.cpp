@@ -24,6 +24,7 @@
  *   - Construction and destruction
  *   - generateRalfOCIConfig() error paths (missing base spec file, missing
  *     graphics config file, etc.)
+ *   - Reuse of the generated config when none of its inputs changed
  *   - Exercises code paths that do not require a real OCI runtime environment.
  */
 
@@ -383,3 +384,94 @@ uint32_t Test_RalfOCIConfigGenerator_LogPathSetCorrectlyInOCIConfig()
 
     return tr.failures;
 }
+
+/* Test_RalfOCIConfigGenerator_PackageConfigSharedAcrossInstances
+ *
+ * Generates the OCI config for two instances of the same package set and
+ * verifies each output still carries its own instance specific fields while
+ * the package part is shared. Changing the base spec regenerates it.
+ */
+uint32_t Test_RalfOCIConfigGenerator_PackageConfigSharedAcrossInstances()
+{
+    L0Test::TestResult tr;
+
+    // Skip if system files are already present so production files are not overwritten.
+    if (ralf::checkIfPathExists(ralf::RALF_OCI_BASE_SPEC_FILE) ||
+        ralf::checkIfPathExists(ralf::RALF_GRAPHICS_LAYER_CONFIG)) {
+        L0Test::ExpectTrue(tr, true,
+                           "SKIP: system OCI base spec or graphics config present, skipping reuse test");
+        return tr.failures;
+    }
+
+    const bool baseSpecWritten  = WriteFile_OCIGen(ralf::RALF_OCI_BASE_SPEC_FILE, "{}");
+    const bool graphicsWritten  = WriteFile_OCIGen(ralf::RALF_GRAPHICS_LAYER_CONFIG, "{}");
+    if (!baseSpecWritten || !graphicsWritten) {
+        if (baseSpecWritten)  std::remove(ralf::RALF_OCI_BASE_SPEC_FILE.c_str());
+        if (graphicsWritten)  std::remove(ralf::RALF_GRAPHICS_LAYER_CONFIG.c_str());
+        L0Test::ExpectTrue(tr, true,
+                           "SKIP: could not write mock OCI spec files, skipping reuse test");
+        return tr.failures;
+    }
+
+    ralf::RalfOCIConfigGenerator::clearGeneratedConfigCache();
+    ralf::clearJsonFileCache();
+
+    const std::string firstConfigPath  = "/tmp/ralf_l0test_shared_config_1.json";
+    const std::string secondConfigPath = "/tmp/ralf_l0test_shared_config_2.json";
+    std::remove(firstConfigPath.c_str());
+    std::remove(secondConfigPath.c_str());
+
+    auto firstConfig = MakeAppConfig_OCI("com.test.sharedapp", "inst-shared-001");
+    firstConfig.mAppStorageInfo.path = "/tmp/ralf_l0test_appstorage";
+    auto secondConfig = MakeAppConfig_OCI("com.test.sharedapp", "inst-shared-002");
+    secondConfig.mAppStorageInfo.path = "/tmp/ralf_l0test_appstorage";
+    auto runtimeCfg = MakeRuntimeConfig_OCI();
+
+    std::vector<ralf::RalfPkgInfoPair> packages;
+    ralf::RalfOCIConfigGenerator firstGen(firstConfigPath, packages);
+    ralf::RalfOCIConfigGenerator secondGen(secondConfigPath, packages);
+
+    Json::Value firstOutput;
+    Json::Value secondOutput;
+    L0Test::ExpectTrue(tr, firstGen.generateRalfOCIConfig(firstConfig, runtimeCfg) &&
+                       ralf::JsonFromFile(firstConfigPath, firstOutput),
+                       "First instance config is generated");
+    L0Test::ExpectTrue(tr, secondGen.generateRalfOCIConfig(secondConfig, runtimeCfg) &&
+                       ralf::JsonFromFile(secondConfigPath, secondOutput),
+                       "Second instance config is generated");
+
+    // Hooks point at the instance's own config file
+    L0Test::ExpectEqStr(tr, secondOutput["hooks"]["createRuntime"][0]["args"][4].asString(), secondConfigPath,
+                        "Second instance hooks reference its own config");
+    L0Test::ExpectEqStr(tr, firstOutput["hooks"]["createRuntime"][0]["args"][4].asString(), firstConfigPath,
+                        "First instance hooks reference its own config");
+
+    // Apart from the instance specific fields (hooks, the Rialto socket mount and
+    // its environment variable) both outputs are the same
+    L0Test::ExpectTrue(tr, firstOutput["process"]["env"] != secondOutput["process"]["env"],
+                       "Each instance gets its own Rialto socket in the environment");
+    for (Json::Value* output : { &firstOutput, &secondOutput }) {
+        output->removeMember("hooks");
+        output->removeMember("mounts");
+        (*output)["process"].removeMember("env");
+    }
+    L0Test::ExpectTrue(tr, firstOutput == secondOutput,
+                       "Both instances get the same package config");
+
+    // A base spec of a different size always produces a new stamp
+    WriteFile_OCIGen(ralf::RALF_OCI_BASE_SPEC_FILE, "{\"ociVersion\": \"1.0.2\"}");
+    Json::Value regeneratedOutput;
+    L0Test::ExpectTrue(tr, firstGen.generateRalfOCIConfig(firstConfig, runtimeCfg) &&
+                       ralf::JsonFromFile(firstConfigPath, regeneratedOutput) &&
+                       regeneratedOutput["ociVersion"].asString() == "1.0.2",
+                       "Changing the base spec regenerates the package config");
+
+    std::remove(ralf::RALF_OCI_BASE_SPEC_FILE.c_str());
+    std::remove(ralf::RALF_GRAPHICS_LAYER_CONFIG.c_str());
+    std::remove(firstConfigPath.c_str());
+    std::remove(secondConfigPath.c_str());
+    ralf::RalfOCIConfigGenerator::clearGeneratedConfigCache();
+    ralf::clearJsonFileCache();
+
+    return tr.failures;
+}
@@ -26,6 +26,7 @@
  *   - checkIfPathExists()
  *   - create_directories()
  *   - JsonFromFile()
+ *   - JsonFromFileCached()
  *   - parseRalPkgInfo()
  *   - getDevNodeMajorMinor()
  *   - getGroupId()
@@ -563,6 +564,69 @@ uint32_t Test_Ralf_JsonFromFile_EmptyFileReturnsFalse()
     return tr.failures;
 }
 
+// ──────────────────────────────────────────────────────────────────────────────
+// JsonFromFileCached() tests
+// ──────────────────────────────────────────────────────────────────────────────
+
+/* Test_Ralf_JsonFromFileCached_ReloadsWhenFileChanges
+ *
+ * Reads the same file twice through the cache, rewrites it with different
+ * content and verifies the next read returns the new content.
+ */
+uint32_t Test_Ralf_JsonFromFileCached_ReloadsWhenFileChanges()
+{
+    L0Test::TestResult tr;
+
+    ralf::clearJsonFileCache();
+    const std::string tmpPath = "/tmp/ralf_l0test_cached.json";
+    WriteFile(tmpPath, "{\"key\": \"first\"}");
+
+    Json::Value node;
+    bool result = ralf::JsonFromFileCached(tmpPath, node);
+    L0Test::ExpectTrue(tr, result && node["key"].asString() == "first",
+                       "JsonFromFileCached() parses the file on first read");
+
+    Json::Value cached;
+    result = ralf::JsonFromFileCached(tmpPath, cached);
+    L0Test::ExpectTrue(tr, result && cached == node,
+                       "JsonFromFileCached() returns the same document while the file is unchanged");
+
+    WriteFile(tmpPath, "{\"key\": \"second value\"}");
+    Json::Value reloaded;
+    result = ralf::JsonFromFileCached(tmpPath, reloaded);
+    L0Test::ExpectTrue(tr, result && reloaded["key"].asString() == "second value",
+                       "JsonFromFileCached() reloads the file after it was rewritten");
+
+    ::remove(tmpPath.c_str());
+    ralf::clearJsonFileCache();
+
+    return tr.failures;
+}
+
+/* Test_Ralf_JsonFromFileCached_RemovedFileReturnsFalse
+ *
+ * Verifies that a cached document is not served once its file is removed.
+ */
+uint32_t Test_Ralf_JsonFromFileCached_RemovedFileReturnsFalse()
+{
+    L0Test::TestResult tr;
+
+    ralf::clearJsonFileCache();
+    const std::string tmpPath = "/tmp/ralf_l0test_cached_removed.json";
+    WriteFile(tmpPath, "{\"key\": 1}");
+
+    Json::Value node;
+    L0Test::ExpectTrue(tr, ralf::JsonFromFileCached(tmpPath, node),
+                       "JsonFromFileCached() succeeds for an existing file");
+
+    ::remove(tmpPath.c_str());
+    Json::Value after;
+    L0Test::ExpectTrue(tr, !ralf::JsonFromFileCached(tmpPath, after),
+                       "JsonFromFileCached() returns false after the file was removed");
+
+    return tr.failures;
+}
+
 // ──────────────────────────────────────────────────────────────────────────────
 // parseRalPkgInfo() tests
 // ──────────────────────────────────────────────────────────────────────────────